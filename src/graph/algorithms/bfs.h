@@ -0,0 +1,565 @@
+/**
+* @file bfs.h
+* @brief header for class BFS, a direction-optimizing breadth-first search over bitset graphs,
+*		 with BFS levels, k-hop neighborhoods and eccentricity / diameter estimates
+* @details: the frontier and the visited set are bitsets. Each level is expanded in one of two ways
+*			[Beamer, Asanovic and Patterson 2012]:
+*			- top-down: the rows of the frontier vertices are OR-ed into the next frontier (masked by visited)
+*			- bottom-up: each unvisited vertex checks if its (in-)row intersects the frontier
+*			The engine switches to bottom-up when the edges out of the frontier exceed 1/ALPHA of the edges
+*			of the unvisited vertices, and back to top-down when the frontier has less than |V|/BETA vertices.
+* @details: works with dense and sparse rows, for undirected (Ugraph) and directed (Graph) graphs - the
+*			bottom-up step of directed graphs uses the transposed rows, built at the first bottom-up step (searches
+*			which only go top-down do not allocate them; in-degrees are counted from the rows).
+* @details: levels are expanded by tiles of bitblocks taken from an atomic cursor. In top-down steps each thread
+*			writes to its own next frontier, merged block-wise at the end of the level; in bottom-up steps
+*			threads write disjoint blocks of the next frontier.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __BFS_H__
+#define __BFS_H__
+
+#include "graph/simple_graph.h"
+#include "graph/simple_ugraph.h"
+#include "bitscan/bitscan.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <utility>
+#include <type_traits>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////
+		//
+		// BFS class
+		//
+		// Direction-optimizing breadth-first search
+		//
+		////////////////////
+
+		template<class Graph_t>
+		class BFS {
+
+			using bbt_ = typename Graph_t::_bbt;
+			static_assert(std::is_same<bbt_, BBScan>::value || std::is_same<bbt_, BBScanSp>::value,
+				"BFS<Graph_t> requires graphs of BBScan or BBScanSp rows");
+			static_assert(std::is_same<bitgraph::Graph<bbt_>, Graph_t>::value ||
+				std::is_same<bitgraph::Ugraph<bbt_>, Graph_t>::value, "BFS<Graph_t> requires Graph<T> or Ugraph<T>");
+
+		public:
+			using type = BFS<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = bbt_;
+			using is_dense = std::is_same<basic_type, BBScan>;
+			using is_undirected = std::is_same<bitgraph::Ugraph<basic_type>, Graph_t>;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum step_t { TOP_DOWN = 0, BOTTOM_UP };
+			enum { ALPHA = 14, BETA = 24 };									//direction switching parameters
+			enum { BLOCK_TILE = 64 };										//bitblocks per task of a thread
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @param nThreads: number of threads (hardware threads if <= 0)
+			*/
+			explicit BFS(Graph_t& g, int nThreads = 1);
+
+			//copy and move semantics disallowed
+			BFS(const BFS&) = delete;
+			BFS& operator =			(const BFS&) = delete;
+			BFS(BFS&&) = delete;
+			BFS& operator =			(BFS&&) = delete;
+
+			~BFS() = default;
+
+			/////////////////////////////
+			// public interface
+
+			/*
+			* @brief BFS from @src, up to depth @maxDepth (no limit if negative)
+			* @returns last level reached (the eccentricity of @src if @maxDepth < 0), -1 if error
+			*/
+			int run(int src, int maxDepth = -1);
+
+			/*
+			* @brief BFS from all the vertices of @srcs (level 0), up to depth @maxDepth (no limit if negative)
+			* @returns last level reached, -1 if error
+			*/
+			int run(const BBScan& srcs, int maxDepth = -1);
+
+			/*
+			* @brief vertices at distance at most @k from @src
+			* @param bbk: output bitset (resized to |V| if required)
+			* @returns number of vertices of @bbk, -1 if error
+			*/
+			int k_hop(int src, int k, BBScan& bbk);
+
+			/*
+			* @brief eccentricity of @v in its (out-)reachable set
+			*/
+			int eccentricity(int v) { return run(v); }
+
+			/*
+			* @brief bounds of the diameter of the component of @src (undirected graphs) by repeated sweeps:
+			*		 each BFS starts from a farthest vertex of the previous one (lower bound), and
+			*		 diam <= 2 * ecc(v) for any v of the component (upper bound)
+			* @param nSweeps: number of BFS (at least 1)
+			* @returns (lower bound, upper bound), (-1, -1) if error
+			*/
+			std::pair<int, int> diameter_bounds(int src, int nSweeps = 4);
+
+			/////////////////////////////
+			// getters (after run())
+
+			/*
+			* @brief BFS level of each vertex, EMPTY_ELEM if not reached
+			*/
+			const vint& levels()							const { return level_; }
+			int level(int v)								const { return level_[v]; }
+
+			/*
+			* @brief vertices reached
+			*/
+			const BBScan& visited()							const { return visited_; }
+			int number_of_visited()							const { return nVisited_; }
+
+			/*
+			* @brief a vertex of the last level (the one with smallest index)
+			*/
+			int farthest_vertex()							const { return farthest_; }
+
+			/*
+			* @brief number of levels expanded by each kind of step in the last run
+			*/
+			int number_of_steps(step_t s)					const { return nSteps_[s]; }
+
+			//////////////
+			// private interface
+		private:
+
+			/*
+			* @brief OR of the (masked) row into @bb
+			*/
+			static void or_row(const BBScan& row, const BBScan& mask, BBScan& bb);
+			static void or_row(const BBScanSp& row, const BBScan& mask, BBScan& bb);
+
+			/*
+			* @brief TRUE if @row and @bb do not intersect
+			*/
+			static bool is_disjoint(const BBScan& row, const BBScan& bb);
+			static bool is_disjoint(const BBScanSp& row, const BBScan& bb);
+
+			/*
+			* @brief calls @f(w) for every bit w of @row
+			*/
+			template<class Func>
+			static void for_each_bit(const BBScan& row, Func f);
+			template<class Func>
+			static void for_each_bit(const BBScanSp& row, Func f);
+
+			static int degree(const BBScan& row) { return static_cast<int>(row.size()); }
+			static int degree(const BBScanSp& row) { return static_cast<int>(row.size()); }
+
+			/*
+			* @brief rows for the bottom-up step - the graph rows if undirected, otherwise the transposed rows
+			*/
+			const basic_type& in_row(int v)	const { return is_undirected::value ? g_.neighbors(v) : inRows_[v]; }
+			void build_in_rows();
+			void write_in_row(int v, const vint& lv, std::true_type /* dense */);
+			void write_in_row(int v, const vint& lv, std::false_type /* sparse */);
+
+			/*
+			* @brief next level - top-down or bottom-up
+			*/
+			void top_down();
+			void bottom_up();
+
+			/*
+			* @brief vertices of next_ are visited with level @d - also the frontier statistics
+			*/
+			void commit(int d);
+
+			///////////
+			// data members
+		private:
+
+			Graph_t& g_;
+			const int NV_;
+			const int NBB_;
+			int nThreads_;
+
+			vint outDeg_;
+			vint inDeg_;
+			std::vector<basic_type> inRows_;								//transposed rows (directed graphs)
+
+			BBScan visited_;
+			BBScan frontier_;
+			BBScan next_;
+			std::vector<BBScan> nextT_;										//next frontier of each thread (top-down)
+			vint level_;
+
+			//frontier statistics
+			int nVisited_ = 0;
+			int nFrontier_ = 0;
+			uint64_t mFrontier_ = 0;										//edges out of the frontier
+			uint64_t mUnvisited_ = 0;										//edges into the unvisited vertices
+			int farthest_ = EMPTY_ELEM;
+			int nSteps_[2] = { 0, 0 };
+		};
+
+	}//end namespace _impl
+
+	using _impl::BFS;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	inline
+		BFS<Graph_t>::BFS(Graph_t& g, int nThreads) :
+		g_(g), NV_(g.number_of_vertices()), NBB_(static_cast<int>(INDEX_1TO1(g.number_of_vertices()))), nThreads_(nThreads),
+		visited_(NV_), frontier_(NV_), next_(NV_), level_(NV_, EMPTY_ELEM)
+	{
+		outDeg_.resize(NV_);
+		for (auto v = 0; v < NV_; ++v) {
+			outDeg_[v] = degree(g_.neighbors(v));
+		}
+		if (is_undirected::value) {
+			inDeg_ = outDeg_;
+		}
+		else {
+			inDeg_.assign(NV_, 0);
+			for (auto u = 0; u < NV_; ++u) {
+				for_each_bit(g_.neighbors(u), [this](int v) { ++inDeg_[v]; });
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::or_row(const BBScan& row, const BBScan& mask, BBScan& bb)
+	{
+		const int nBB = row.number_of_blocks();
+		for (auto i = 0; i < nBB; ++i) {
+			bb.block(i) |= row.block(i) & ~mask.block(i);
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::or_row(const BBScanSp& row, const BBScan& mask, BBScan& bb)
+	{
+		for (auto it = row.cbegin(); it != row.cend(); ++it) {
+			bb.block(it->idx_) |= it->bb_ & ~mask.block(it->idx_);
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		bool BFS<Graph_t>::is_disjoint(const BBScan& row, const BBScan& bb)
+	{
+		const int nBB = row.number_of_blocks();
+		for (auto i = 0; i < nBB; ++i) {
+			if (row.block(i) & bb.block(i)) { return false; }
+		}
+		return true;
+	}
+
+	template<class Graph_t>
+	inline
+		bool BFS<Graph_t>::is_disjoint(const BBScanSp& row, const BBScan& bb)
+	{
+		for (auto it = row.cbegin(); it != row.cend(); ++it) {
+			if (it->bb_ & bb.block(it->idx_)) { return false; }
+		}
+		return true;
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void BFS<Graph_t>::for_each_bit(const BBScan& row, Func f)
+	{
+		const int nBB = row.number_of_blocks();
+		for (auto i = 0; i < nBB; ++i) {
+			for (BITBOARD bb = row.block(i); bb; bb &= bb - 1) {
+				f(WMUL(i) + bblock::lsb64_intrinsic(bb));
+			}
+		}
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void BFS<Graph_t>::for_each_bit(const BBScanSp& row, Func f)
+	{
+		for (auto it = row.cbegin(); it != row.cend(); ++it) {
+			for (BITBOARD bb = it->bb_; bb; bb &= bb - 1) {
+				f(WMUL(it->idx_) + bblock::lsb64_intrinsic(bb));
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::build_in_rows()
+	{
+		//in-neighbors in increasing order
+		std::vector<vint> in(NV_);
+		for (auto u = 0; u < NV_; ++u) {
+			for_each_bit(g_.neighbors(u), [&in, u](int v) { in[v].push_back(u); });
+		}
+
+		inRows_.assign(NV_, basic_type(NV_));
+		for (auto v = 0; v < NV_; ++v) {
+			write_in_row(v, in[v], is_dense());
+			vint().swap(in[v]);
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::write_in_row(int v, const vint& lv, std::true_type)
+	{
+		for (auto u : lv) {
+			inRows_[v].block(WDIV(u)) |= bblock::MASK_BIT(WMOD(u));
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::write_in_row(int v, const vint& lv, std::false_type)
+	{
+		auto& vBB = inRows_[v].bitset();
+		vBB.clear();
+		for (auto u : lv) {
+			const int idx = WDIV(u);
+			if (vBB.empty() || vBB.back().idx_ != idx) { vBB.emplace_back(idx, 0); }
+			vBB.back().bb_ |= bblock::MASK_BIT(WMOD(u));
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int BFS<Graph_t>::run(int src, int maxDepth)
+	{
+		if (src < 0 || src >= NV_) {
+			LOG_ERROR("bad source vertex - BFS<Graph_t>::run");
+			return -1;
+		}
+		BBScan srcs(NV_);
+		srcs.set_bit(src);
+		return run(srcs, maxDepth);
+	}
+
+	template<class Graph_t>
+	inline
+		int BFS<Graph_t>::run(const BBScan& srcs, int maxDepth)
+	{
+		if (srcs.capacity() < NBB_) {
+			LOG_ERROR("bad size of the source set - BFS<Graph_t>::run");
+			return -1;
+		}
+
+		//clears previous run
+		std::fill(level_.begin(), level_.end(), EMPTY_ELEM);
+		visited_.erase_bit();
+		frontier_.erase_bit();
+		nSteps_[TOP_DOWN] = nSteps_[BOTTOM_UP] = 0;
+		nVisited_ = 0;
+		farthest_ = EMPTY_ELEM;
+
+		//edges into unvisited vertices - all
+		mUnvisited_ = 0;
+		for (auto d : inDeg_) { mUnvisited_ += d; }
+
+		//level 0
+		for (auto i = 0; i < NBB_; ++i) {
+			next_.block(i) = srcs.block(i);
+		}
+		commit(0);
+		if (nFrontier_ == 0) { return -1; }
+
+		//////////////////////////
+		int d = 0;
+		step_t step = TOP_DOWN;
+		while (nFrontier_ > 0 && (maxDepth < 0 || d < maxDepth)) {
+
+			//direction
+			if (step == TOP_DOWN && mFrontier_ > mUnvisited_ / ALPHA) {
+				step = BOTTOM_UP;
+			}
+			else if (step == BOTTOM_UP && nFrontier_ < NV_ / BETA) {
+				step = TOP_DOWN;
+			}
+
+			if (step == TOP_DOWN) { top_down(); }
+			else { bottom_up(); }
+			++nSteps_[step];
+
+			commit(d + 1);
+			if (nFrontier_ > 0) { ++d; }
+		}
+		//////////////////////////
+
+		return d;
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::top_down()
+	{
+		const int nThreads = com::thread_count(nThreads_, NBB_ / BLOCK_TILE);
+		if (static_cast<int>(nextT_.size()) < nThreads) {
+			nextT_.resize(nThreads, BBScan(NV_));
+		}
+
+		std::atomic<int> next(0);
+		com::run_parallel(nThreads, [&](int t) {
+			auto& bbt = nextT_[t];
+			int first;
+			while ((first = next.fetch_add(BLOCK_TILE)) < NBB_) {
+				const int last = std::min(first + static_cast<int>(BLOCK_TILE), NBB_);
+				for (auto i = first; i < last; ++i) {
+					for (BITBOARD bb = frontier_.block(i); bb; bb &= bb - 1) {
+						or_row(g_.neighbors(WMUL(i) + bblock::lsb64_intrinsic(bb)), visited_, bbt);
+					}
+				}
+			}
+		});
+
+		//merge (and clear) the frontiers of the threads
+		std::atomic<int> nextM(0);
+		com::run_parallel(nThreads, [&](int) {
+			int first;
+			while ((first = nextM.fetch_add(BLOCK_TILE)) < NBB_) {
+				const int last = std::min(first + static_cast<int>(BLOCK_TILE), NBB_);
+				for (auto i = first; i < last; ++i) {
+					BITBOARD bb = 0;
+					for (auto t = 0; t < nThreads; ++t) {
+						bb |= nextT_[t].block(i);
+						nextT_[t].block(i) = 0;
+					}
+					next_.block(i) = bb;
+				}
+			}
+		});
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::bottom_up()
+	{
+		//transposed rows of directed graphs - only if a bottom-up step is taken
+		if (!is_undirected::value && inRows_.empty()) { build_in_rows(); }
+
+		const int nThreads = com::thread_count(nThreads_, NBB_ / BLOCK_TILE);
+		std::atomic<int> next(0);
+		com::run_parallel(nThreads, [&](int) {
+			int first;
+			while ((first = next.fetch_add(BLOCK_TILE)) < NBB_) {
+				const int last = std::min(first + static_cast<int>(BLOCK_TILE), NBB_);
+				for (auto i = first; i < last; ++i) {
+					BITBOARD nb = 0;
+					BITBOARD bb = ~visited_.block(i);
+					if (i == NBB_ - 1 && WMOD(NV_) != 0) {
+						bb &= ~bblock::MASK_1(WMOD(NV_), WORD_SIZE - 1);
+					}
+					for (; bb; bb &= bb - 1) {
+						const int b = bblock::lsb64_intrinsic(bb);
+						if (!is_disjoint(in_row(WMUL(i) + b), frontier_)) {
+							nb |= bblock::MASK_BIT(b);
+						}
+					}
+					next_.block(i) = nb;
+				}
+			}
+		});
+	}
+
+	template<class Graph_t>
+	inline
+		void BFS<Graph_t>::commit(int d)
+	{
+		nFrontier_ = 0;
+		mFrontier_ = 0;
+		uint64_t mIn = 0;
+		for (auto i = 0; i < NBB_; ++i) {
+			BITBOARD bb = next_.block(i) & ~visited_.block(i);
+			frontier_.block(i) = bb;
+			visited_.block(i) |= bb;
+			for (; bb; bb &= bb - 1) {
+				const int v = WMUL(i) + bblock::lsb64_intrinsic(bb);
+				if (nFrontier_ == 0) { farthest_ = v; }
+				level_[v] = d;
+				mFrontier_ += outDeg_[v];
+				mIn += inDeg_[v];
+				++nFrontier_;
+			}
+		}
+		nVisited_ += nFrontier_;
+		mUnvisited_ -= mIn;
+	}
+
+	template<class Graph_t>
+	inline
+		int BFS<Graph_t>::k_hop(int src, int k, BBScan& bbk)
+	{
+		if (k < 0 || run(src, k) == -1) {
+			LOG_ERROR("bad source vertex or number of hops - BFS<Graph_t>::k_hop");
+			return -1;
+		}
+		if (bbk.capacity() != NBB_) {
+			bbk.reset(NV_);
+		}
+		for (auto i = 0; i < NBB_; ++i) {
+			bbk.block(i) = visited_.block(i);
+		}
+		return nVisited_;
+	}
+
+	template<class Graph_t>
+	inline
+		std::pair<int, int> BFS<Graph_t>::diameter_bounds(int src, int nSweeps)
+	{
+		if (!is_undirected::value) {
+			LOG_ERROR("only for undirected graphs - BFS<Graph_t>::diameter_bounds");
+			return std::make_pair(-1, -1);
+		}
+
+		int ecc = run(src);
+		if (ecc == -1) { return std::make_pair(-1, -1); }
+		int lb = ecc, ub = 2 * ecc;
+
+		//sweeps - from a farthest vertex of the previous BFS
+		int v = farthest_;
+		for (auto s = 1; s < nSweeps && lb < ub; ++s) {
+			ecc = run(v);
+			lb = std::max(lb, ecc);
+			ub = std::min(ub, 2 * ecc);
+			v = farthest_;
+		}
+
+		return std::make_pair(lb, ub);
+	}
+
+}//end namespace bitgraph
+
+#endif
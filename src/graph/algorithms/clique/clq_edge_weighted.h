@@ -0,0 +1,457 @@
+/**
+* @file clq_edge_weighted.h
+* @brief header for class CliqueEdgeWeighted, an exact algorithm for the maximum edge-weighted
+*		 clique problem (MEWCP) in edge-weighted undirected graphs Graph_EW<ugraph, W>
+* @details: bit-parallel branch-and-bound. The objective is the sum of the edge weights of the clique
+*			(vertex weights are ignored). Edge weights are assumed non-negative.
+* @details: W(v, S) = sum of the weights of the edges between v and the current clique S is maintained
+*			incrementally for the candidate vertices as vertices enter and leave S.
+* @details: upper bound - the candidate set P is colored greedily. For v in P of color class C(v)
+*			c(v) = W(v, S) + 1/2 sum_{j != C(v)} max{ w(v, u) : u in C_j, u adjacent to v }
+*			and a clique in P contributes at most sum_j max{ c(v) : v in C_j } (at most one vertex per class).
+*			Values are computed doubled to remain exact for integer weights.
+* @details: edge weights are read through an array of row pointers, either into a copy of the
+*			per-row we_ layout of Graph_EW or into a contiguous row-major matrix (see layout_t)
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_EDGE_WEIGHTED_H__
+#define __CLIQUE_EDGE_WEIGHTED_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/simple_graph_ew.h"
+#include "graph/algorithms/graph_fast_sort.h"
+#include "graph/algorithms/decode.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_info.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class CliqueEdgeWeighted
+		// (exact maximum edge-weighted clique)
+		//
+		////////////////////////////
+
+		template<class GraphEW_t>
+		class CliqueEdgeWeighted {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, typename GraphEW_t::_gt>::value,
+				"CliqueEdgeWeighted<GraphEW_t> requires GraphEW_t = Graph_EW<Ugraph<BBScan>, W>");
+
+		public:
+			using type = CliqueEdgeWeighted<GraphEW_t>;
+			using basic_type = GraphEW_t;									//edge-weighted graph type
+			using ugtype = typename GraphEW_t::_gt;							//non-weighted graph type
+			using wtype = typename GraphEW_t::_wt;							//weight type
+			using _bbt = typename ugtype::_bbt;
+
+			static_assert(std::is_arithmetic<wtype>::value, "CliqueEdgeWeighted<GraphEW_t> requires arithmetic weights");
+
+			enum layout_t { WE_LAYOUT = 0, CONTIGUOUS };					//storage of the edge weights for the search
+			enum { CHECK_TIME_MASK = 0x3FF };								//time-out is checked every 1024 steps
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Preprocessing: the graph is reordered by minimum width (degeneracy), last to first,
+			*		 and the edge weights are stored in the chosen layout
+			* @param layout WE_LAYOUT (one vector per row, as Graph_EW::we_) or CONTIGUOUS (row-major matrix)
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup(layout_t layout = CONTIGUOUS);
+
+			/*
+			* @brief Runs the search (setup() with default values is called if required)
+			* @returns weight of the maximum edge-weighted clique found (the optimum if not TIME_OUT),
+			*		   -1 if error
+			*/
+			wtype run();
+
+			////////////////////////
+			//construction / destruction
+
+			explicit CliqueEdgeWeighted(GraphEW_t& gew, const com::paramBase& p = com::paramBase()) :
+				gew_(gew), info_(p), NV_(gew.number_of_vertices()), layout_(CONTIGUOUS), isSetup_(false)
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			CliqueEdgeWeighted(const CliqueEdgeWeighted&) = delete;
+			CliqueEdgeWeighted& operator=	(const CliqueEdgeWeighted&) = delete;
+			CliqueEdgeWeighted(CliqueEdgeWeighted&&) = delete;
+			CliqueEdgeWeighted& operator=	(CliqueEdgeWeighted&&) = delete;
+
+			~CliqueEdgeWeighted() = default;
+
+			//////////
+			// setters / getters
+
+			const infoClq<wtype>& info()		const { return info_; }
+			infoClq<wtype>& info() { return info_; }
+			const vint& clique()				const { return info_.sol_; }
+			layout_t layout()					const { return layout_; }
+			void time_out(double t) { info_.data_.TIME_OUT = t; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief colors the candidate set at @depth and computes the (doubled) cumulative
+			*		 class bounds of the vertices stored in L_[depth]
+			* @returns number of vertices in L_[depth]
+			*/
+			int color_bound(int depth);
+
+			/*
+			* @brief recursive branch-and-bound at depth @depth
+			*/
+			void expand(int depth);
+
+			/*
+			* @brief updates the incumbent with the current clique
+			*/
+			void report();
+
+			////////////////
+			// data members
+		private:
+			GraphEW_t& gew_;												//the input graph
+			ugtype gs_;														//the graph reordered for the search
+			Decode decode_;													//ordering of gs_ w.r.t. gew_
+
+			//edge weights of gs_
+			typename GraphEW_t::mat_t wrows_;								//WE_LAYOUT
+			std::vector<wtype> wmat_;										//CONTIGUOUS
+			std::vector<const wtype*> row_;									//row_[v][u] = w(v, u) in gs_
+
+			infoClq<wtype> info_;
+			const int NV_;
+			layout_t layout_;
+
+			//working memory - one entry per depth
+			std::vector<_bbt> P_;
+			std::vector<vint> L_;
+			std::vector<std::vector<wtype>> U_;								//doubled cumulative class bounds
+			std::vector<vint> upd_;											//vertices whose W(v, S) was updated
+			std::vector<std::vector<wtype>> old_;							//previous values of W(v, S)
+
+			//coloring
+			_bbt Ucol_, Qcol_;
+			vint cls_;														//color class of each vertex
+			vint order_;													//vertices in coloring order
+			vint first_;													//first position of each class in order_
+			std::vector<wtype> bmax_;										//best edge weight to each class
+			std::vector<wtype> cmax_;										//best (doubled) vertex bound of each class
+
+			std::vector<wtype> ws_;											//W(v, S) for the candidate vertices
+			vint clq_;														//current clique S
+			wtype wclq_;													//weight of S
+			vint best_;														//incumbent (vertices of gs_)
+			bool abort_;
+
+			bool isSetup_;
+		};
+
+	}//end namespace _impl
+
+	using _impl::CliqueEdgeWeighted;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class GraphEW_t>
+	inline
+		int CliqueEdgeWeighted<GraphEW_t>::setup(layout_t layout)
+	{
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(gew_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(gew_.graph().number_of_edges());
+
+		//minimum width ordering, last to first
+		GraphFastRootSort<ugtype> gfs(gew_.graph());
+		vint o2n = gfs.new_order(GraphFastRootSort<ugtype>::MIN_DEGEN, true, true);
+
+		decode_.clear();
+		if (gfs.reorder(o2n, gs_, &decode_) == -1) {
+			LOG_ERROR("error when reordering the graph - CliqueEdgeWeighted<GraphEW_t>::setup");
+			return -1;
+		}
+
+		//edge weights of the reordered graph
+		vint n2o = Decode::reverse(o2n);
+		const auto& we = gew_.weights();
+		layout_ = layout;
+		row_.assign(NV_, nullptr);
+		wrows_.clear();
+		wmat_.clear();
+
+		try {
+			if (layout_ == CONTIGUOUS) {
+				wmat_.assign(static_cast<std::size_t>(NV_) * NV_, 0);
+				for (auto i = 0; i < NV_; ++i) {
+					wtype* row = wmat_.data() + static_cast<std::size_t>(i) * NV_;
+					for (auto j = 0; j < NV_; ++j) {
+						row[j] = we[n2o[i]][n2o[j]];
+					}
+					row_[i] = row;
+				}
+			}
+			else {
+				wrows_.assign(NV_, std::vector<wtype>(NV_, 0));
+				for (auto i = 0; i < NV_; ++i) {
+					for (auto j = 0; j < NV_; ++j) {
+						wrows_[i][j] = we[n2o[i]][n2o[j]];
+					}
+					row_[i] = wrows_[i].data();
+				}
+			}
+		}
+		catch (const std::bad_alloc& e) {
+			LOGG_ERROR("memory for edge weights could not be allocated: ", e.what(), " - CliqueEdgeWeighted<GraphEW_t>::setup");
+			return -1;
+		}
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class GraphEW_t>
+	inline
+		typename CliqueEdgeWeighted<GraphEW_t>::wtype CliqueEdgeWeighted<GraphEW_t>::run()
+	{
+		if (!isSetup_ && setup() == -1) { return -1; }
+
+		//clears previous search results (preprocessing info is kept)
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.clearTimer(infoBase::phase_t::LAST_INCUMBENT);
+		info_.sol_.clear();
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+
+		info_.startTimer(infoBase::phase_t::SEARCH);
+		info_.startTimer(infoBase::phase_t::LAST_INCUMBENT);
+
+		if (NV_ == 0) {
+			info_.readTimer(infoBase::phase_t::SEARCH);
+			return 0;
+		}
+
+		//working memory - the depth of the search is bounded by the size of a coloring of G
+		_bbt bbroot(NV_, true);
+		const int maxDepth = gfunc::clq::SEQ(gs_, bbroot) + 2;
+		P_.assign(maxDepth, _bbt(NV_));
+		L_.assign(maxDepth, vint(NV_));
+		U_.assign(maxDepth, std::vector<wtype>(NV_));
+		upd_.assign(maxDepth, vint(NV_));
+		old_.assign(maxDepth, std::vector<wtype>(NV_));
+		Ucol_.reset(NV_);
+		Qcol_.reset(NV_);
+		cls_.assign(NV_, EMPTY_ELEM);
+		order_.assign(NV_, EMPTY_ELEM);
+		first_.assign(NV_ + 1, 0);
+		bmax_.assign(NV_ + 1, 0);
+		cmax_.assign(NV_ + 1, 0);
+		ws_.assign(NV_, 0);
+		clq_.clear();
+		clq_.reserve(maxDepth);
+		wclq_ = 0;
+		abort_ = false;
+
+		//initial solution - greedy clique in the initial ordering
+		gfunc::clq::find_clique(gs_, best_, bbroot);
+		info_.lb_ = 0;
+		for (auto i = 0; i < (int)best_.size(); ++i) {
+			for (auto j = i + 1; j < (int)best_.size(); ++j) {
+				info_.lb_ += row_[best_[i]][best_[j]];
+			}
+		}
+
+		//root bound
+		P_[0] = bbroot;
+		int nL = color_bound(0);
+		info_.ub_ = (nL > 0) ? U_[0][nL - 1] / 2 : 0;
+
+		//////////////////////////
+		expand(0);
+		//////////////////////////
+
+		//decode the incumbent to the original graph
+		info_.sol_ = decode_.decode(best_);
+		std::sort(info_.sol_.begin(), info_.sol_.end());
+		info_.isTimeOut_ = abort_;
+
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return info_.lb_;
+	}
+
+	template<class GraphEW_t>
+	inline
+		int CliqueEdgeWeighted<GraphEW_t>::color_bound(int depth)
+	{
+		const _bbt& P = P_[depth];
+		vint& L = L_[depth];
+		std::vector<wtype>& U = U_[depth];
+
+		int pc = static_cast<int>(P.size());
+		int nCls = 0, nO = 0, v = bbo::noBit;
+
+		//////////////////////////
+		// greedy coloring of P
+		Ucol_ = P;
+		while (pc > 0) {
+			first_[nCls] = nO;
+			Qcol_ = Ucol_;
+			Qcol_.init_scan(bbo::DESTRUCTIVE);
+			while ((v = Qcol_.next_bit_del()) != bbo::noBit) {
+				Ucol_.erase_bit(v);
+				Qcol_.erase_block(WDIV(v), -1, gs_.neighbors(v));
+				cls_[v] = nCls;
+				order_[nO++] = v;
+
+				/////////////////
+				if ((--pc) == 0) { break; }
+				/////////////////
+			}
+			++nCls;
+		}
+		first_[nCls] = nO;
+
+		//////////////////////////
+		// (doubled) vertex bounds: 2 W(v, S) + sum of the best edge weights to the other classes
+		for (auto j = 0; j < nCls; ++j) { cmax_[j] = 0; }
+		for (auto k = 0; k < nO; ++k) {
+			v = order_[k];
+			const wtype* rowv = row_[v];
+			for (auto j = 0; j < nCls; ++j) { bmax_[j] = 0; }
+
+			//neighbors of v in P
+			const auto& nv = gs_.neighbors(v);
+			for (auto nBB = 0; nBB < P.number_of_blocks(); ++nBB) {
+				BITBOARD bb = P.block(nBB) & nv.block(nBB);
+				while (bb) {
+					int u = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+					bb &= bb - 1;
+					if (rowv[u] > bmax_[cls_[u]]) { bmax_[cls_[u]] = rowv[u]; }
+				}
+			}
+
+			wtype c = 2 * ws_[v];
+			for (auto j = 0; j < nCls; ++j) { c += bmax_[j]; }
+			if (c > cmax_[cls_[v]]) { cmax_[cls_[v]] = c; }
+		}
+
+		//////////////////////////
+		// cumulative class bounds in coloring order
+		wtype ub = 0;
+		for (auto j = 0; j < nCls; ++j) {
+			ub += cmax_[j];
+			for (auto k = first_[j]; k < first_[j + 1]; ++k) {
+				L[k] = order_[k];
+				U[k] = ub;
+			}
+		}
+
+		return nO;
+	}
+
+	template<class GraphEW_t>
+	inline
+		void CliqueEdgeWeighted<GraphEW_t>::expand(int depth)
+	{
+		++info_.nSteps_;
+
+		//time-out check
+		if ((info_.nSteps_ & CHECK_TIME_MASK) == 0 &&
+			com::_time::elapsedTime(info_.startTimeSearch_) >= info_.data_.TIME_OUT) {
+			abort_ = true;
+		}
+		if (abort_) { return; }
+
+		_bbt& P = P_[depth];
+		vint& L = L_[depth];
+		std::vector<wtype>& U = U_[depth];
+		int nL = color_bound(depth);
+
+		//branch on vertices in reverse coloring order
+		for (auto k = nL - 1; k >= 0; --k) {
+
+			///////////////////////////////////////////////////
+			if (2 * wclq_ + U[k] <= 2 * info_.lb_) { return; }
+			///////////////////////////////////////////////////
+
+			int v = L[k];
+			const wtype* rowv = row_[v];
+			_bbt& Pnext = P_[depth + 1];
+			AND(P, gs_.neighbors(v), Pnext);
+
+			//v enters S - incremental update of W(u, S) for u in Pnext
+			vint& upd = upd_[depth + 1];
+			std::vector<wtype>& old = old_[depth + 1];
+			int nUpd = 0;
+			for (auto nBB = 0; nBB < Pnext.number_of_blocks(); ++nBB) {
+				BITBOARD bb = Pnext.block(nBB);
+				while (bb) {
+					int u = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+					bb &= bb - 1;
+					upd[nUpd] = u;
+					old[nUpd] = ws_[u];
+					ws_[u] += rowv[u];
+					++nUpd;
+				}
+			}
+			wtype wprev = wclq_;
+			clq_.push_back(v);
+			wclq_ += ws_[v];
+
+			if (nUpd == 0) {
+				report();
+			}
+			else {
+				expand(depth + 1);
+			}
+
+			//v leaves S
+			wclq_ = wprev;
+			clq_.pop_back();
+			for (auto i = 0; i < nUpd; ++i) {
+				ws_[upd[i]] = old[i];
+			}
+
+			if (abort_) { return; }
+			P.erase_bit(v);
+		}
+	}
+
+	template<class GraphEW_t>
+	inline
+		void CliqueEdgeWeighted<GraphEW_t>::report()
+	{
+		if (wclq_ > info_.lb_) {
+			info_.lb_ = wclq_;
+			best_ = clq_;
+			info_.readTimer(infoBase::phase_t::LAST_INCUMBENT);
+		}
+	}
+
+}//end namespace bitgraph
+
+#endif
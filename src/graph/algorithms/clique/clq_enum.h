@@ -0,0 +1,435 @@
+/**
+* @file clq_enum.h
+* @brief header for class CliqueEnum, a bit-parallel enumerator of all the maximal cliques
+*		 of an undirected graph (Bron-Kerbosch with Tomita pivoting)
+* @details: P (candidates) and X (excluded) are bitsets. The pivot u in P U X maximizes |P & N(u)|,
+*			computed block-wise over the non-empty block range of P in the same loop that scans
+*			P U X, with early exit when |P & N(u)| = |P|.
+* @details: the outer loop follows a degeneracy ordering (KCore::kcore_ordering), so that
+*			each root candidate set has at most degeneracy(G) vertices [Eppstein, Löffler and Strash 2010].
+* @details: cliques are streamed to a visitor, never stored. A visitor is any callable with signature
+*			bool(const vint& clq) - returning false stops the enumeration. In parallel mode the
+*			outer loop is split across threads and the visitor is called concurrently, so it must be thread-safe.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_ENUM_H__
+#define __CLIQUE_ENUM_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/clique/clq_info.h"
+#include "bitscan/bitblock.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class CliqueEnum
+		// (maximal clique enumeration)
+		//
+		////////////////////////////
+
+		template<class Graph_t>
+		class CliqueEnum {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value,
+				"CliqueEnum<Graph_t> requires Graph_t = Ugraph<BBScan>");
+
+		public:
+			using type = CliqueEnum<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum { CHECK_TIME_MASK = 0x3FF };					//time-out is checked every 1024 steps (per thread)
+
+			///////////////////
+			//per-thread working memory
+
+			struct Arena {
+				std::vector<_bbt> P_;							//candidates - one per depth
+				std::vector<_bbt> X_;							//excluded - one per depth
+				vint clq_;										//current clique R
+				uint64_t nCliques_ = 0;
+				uint64_t nSteps_ = 0;
+				std::size_t maxSize_ = 0;
+
+				Arena(int NV, int maxDepth) : P_(maxDepth, _bbt(NV)), X_(maxDepth, _bbt(NV)) {
+					clq_.reserve(maxDepth);
+				}
+			};
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Computes the degeneracy ordering of the graph (called by run if required)
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup();
+
+			/*
+			* @brief Enumerates all the maximal cliques of the graph sequentially
+			* @param vis visitor - bool(const vint& clq), returns false to stop
+			* @returns number of maximal cliques reported
+			*/
+			template<class Visitor>
+			uint64_t run(Visitor&& vis);
+
+			/*
+			* @brief Enumerates all the maximal cliques, splitting the outer loop over the vertices
+			*		 into tasks pulled by @nThreads threads (hardware threads if <= 0)
+			* @param vis thread-safe visitor - bool(const vint& clq), returns false to stop
+			* @returns number of maximal cliques reported
+			*/
+			template<class Visitor>
+			uint64_t run_parallel(Visitor&& vis, int nThreads);
+
+			////////////////////////
+			//construction / destruction
+
+			explicit CliqueEnum(Graph_t& g, const com::paramBase& p = com::paramBase()) :
+				g_(g), info_(p), NV_(g.number_of_vertices()), maxDepth_(0), isSetup_(false)
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			CliqueEnum(const CliqueEnum&) = delete;
+			CliqueEnum& operator=	(const CliqueEnum&) = delete;
+			CliqueEnum(CliqueEnum&&) = delete;
+			CliqueEnum& operator=	(CliqueEnum&&) = delete;
+
+			~CliqueEnum() = default;
+
+			//////////
+			// setters / getters
+
+			const infoClq<int>& info()				const { return info_; }
+			uint64_t number_of_cliques()			const { return nCliques_; }
+			int max_clique_size()					const { return info_.lb_; }
+			void time_out(double t) { info_.data_.TIME_OUT = t; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief initializes P and X of the root task in position @pos of the degeneracy ordering
+			*/
+			void init_task(int pos, Arena& a) const;
+
+			/*
+			* @brief recursive Bron-Kerbosch with Tomita pivoting at depth @depth
+			* @returns false if the enumeration must stop
+			*/
+			template<class Visitor>
+			bool expand(int depth, Arena& a, Visitor& vis);
+
+			/*
+			* @brief pivot u in P U X which maximizes |P & N(u)|
+			*/
+			int select_pivot(const _bbt& P, const _bbt& X) const;
+
+			/*
+			* @brief clears search results and starts timers
+			*/
+			void start();
+
+			/*
+			* @brief collects the results of the arena @a
+			*/
+			void collect(const Arena& a);
+
+			////////////////
+			// data members
+		private:
+			Graph_t& g_;
+			infoClq<int> info_;									//lb_: size of the largest maximal clique
+			const int NV_;
+
+			vint ord_;											//degeneracy ordering
+			vint pos_;											//position of each vertex in ord_
+			int maxDepth_;
+
+			uint64_t nCliques_ = 0;
+			std::atomic<bool> abort_{ false };					//stops the enumeration (visitor or TIME_OUT)
+			std::atomic<bool> timeOut_{ false };
+			bool isSetup_;
+		};
+
+	}//end namespace _impl
+
+	using _impl::CliqueEnum;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	inline
+		int CliqueEnum<Graph_t>::setup()
+	{
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(g_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(g_.number_of_edges());
+
+		if (NV_ == 0) {
+			ord_.clear();
+			pos_.clear();
+			maxDepth_ = 1;
+			info_.readTimer(infoBase::phase_t::PREPROC);
+			isSetup_ = true;
+			return 0;
+		}
+
+		//degeneracy ordering - at most max core number later neighbors
+		KCore<Graph_t> kc(g_);
+		if (kc.find_kcore() == -1) {
+			LOG_ERROR("error when computing the degeneracy ordering - CliqueEnum<Graph_t>::setup");
+			return -1;
+		}
+		ord_ = kc.kcore_ordering();
+		pos_.assign(NV_, EMPTY_ELEM);
+		for (auto i = 0; i < NV_; ++i) {
+			pos_[ord_[i]] = i;
+		}
+
+		//the size of a clique is at most the max core number + 1
+		maxDepth_ = kc.max_core_number() + 3;
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class Graph_t>
+	template<class Visitor>
+	inline
+		uint64_t CliqueEnum<Graph_t>::run(Visitor&& vis)
+	{
+		if (!isSetup_ && setup() == -1) { return 0; }
+		start();
+
+		Arena a(NV_, maxDepth_);
+		for (auto pos = 0; pos < NV_; ++pos) {
+			init_task(pos, a);
+			if (!expand(0, a, vis)) { break; }
+		}
+		collect(a);
+
+		info_.isTimeOut_ = timeOut_.load();
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return nCliques_;
+	}
+
+	template<class Graph_t>
+	template<class Visitor>
+	inline
+		uint64_t CliqueEnum<Graph_t>::run_parallel(Visitor&& vis, int nThreads)
+	{
+		if (!isSetup_ && setup() == -1) { return 0; }
+		start();
+
+		nThreads = com::thread_count(nThreads, NV_);
+		info_.number_of_threads(nThreads);
+
+		std::atomic<int> next{ 0 };
+		std::mutex mtx;
+
+		auto worker = [&]() {
+			Arena a(NV_, maxDepth_);
+			int pos = 0;
+			while (!abort_.load(std::memory_order_relaxed) &&
+				(pos = next.fetch_add(1, std::memory_order_relaxed)) < NV_) {
+				init_task(pos, a);
+				if (!expand(0, a, vis)) { abort_.store(true); }
+			}
+
+			std::lock_guard<std::mutex> lck(mtx);
+			collect(a);
+		};
+
+		com::run_parallel(nThreads, [&worker](int) { worker(); });
+
+		info_.isTimeOut_ = timeOut_.load();
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return nCliques_;
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueEnum<Graph_t>::start()
+	{
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.lb_ = 0;
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+		nCliques_ = 0;
+		abort_.store(false);
+		timeOut_.store(false);
+		info_.startTimer(infoBase::phase_t::SEARCH);
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueEnum<Graph_t>::collect(const Arena& a)
+	{
+		nCliques_ += a.nCliques_;
+		info_.nSteps_ += a.nSteps_;
+		info_.lb_ = std::max(info_.lb_, static_cast<int>(a.maxSize_));
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueEnum<Graph_t>::init_task(int pos, Arena& a) const
+	{
+		int v = ord_[pos];
+		_bbt& P = a.P_[0];
+		_bbt& X = a.X_[0];
+		P.erase_bit();
+		X.erase_bit();
+
+		//later neighbors are candidates, earlier neighbors are excluded
+		const _bbt& nv = g_.neighbors(v);
+		for (auto nBB = 0; nBB < nv.number_of_blocks(); ++nBB) {
+			BITBOARD bb = nv.block(nBB);
+			while (bb) {
+				int u = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+				bb &= bb - 1;
+				if (pos_[u] > pos) { P.set_bit(u); }
+				else { X.set_bit(u); }
+			}
+		}
+
+		a.clq_.clear();
+		a.clq_.push_back(v);
+	}
+
+	template<class Graph_t>
+	inline
+		int CliqueEnum<Graph_t>::select_pivot(const _bbt& P, const _bbt& X) const
+	{
+		const int NBB = P.number_of_blocks();
+
+		//block range of P
+		int first = 0, last = NBB - 1;
+		while (first < NBB && P.block(first) == 0) { ++first; }
+		while (last > first && P.block(last) == 0) { --last; }
+
+		int pc = 0;
+		for (auto nBB = first; nBB <= last; ++nBB) { pc += bblock::popc64(P.block(nBB)); }
+
+		//scans P U X and computes |P & N(u)| in the same loop
+		int pivot = bbo::noBit, best = -1;
+		for (auto nBB = 0; nBB < NBB; ++nBB) {
+			BITBOARD bb = P.block(nBB) | X.block(nBB);
+			while (bb) {
+				int u = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+				bb &= bb - 1;
+
+				const _bbt& nu = g_.neighbors(u);
+				int cnt = 0;
+				for (auto i = first; i <= last; ++i) {
+					cnt += bblock::popc64(P.block(i) & nu.block(i));
+				}
+
+				if (cnt > best) {
+					best = cnt;
+					pivot = u;
+
+					/////////////////////////////////////
+					if (best == pc) { return pivot; }		//early exit - cannot be improved
+					/////////////////////////////////////
+				}
+			}
+		}
+
+		return pivot;
+	}
+
+	template<class Graph_t>
+	template<class Visitor>
+	inline
+		bool CliqueEnum<Graph_t>::expand(int depth, Arena& a, Visitor& vis)
+	{
+		++a.nSteps_;
+
+		//time-out check
+		if ((a.nSteps_ & CHECK_TIME_MASK) == 0 &&
+			com::_time::elapsedTime(info_.startTimeSearch_) >= info_.data_.TIME_OUT) {
+			timeOut_.store(true, std::memory_order_relaxed);
+			abort_.store(true, std::memory_order_relaxed);
+		}
+		if (abort_.load(std::memory_order_relaxed)) { return false; }
+
+		_bbt& P = a.P_[depth];
+		_bbt& X = a.X_[depth];
+
+		if (P.is_empty()) {
+			if (X.is_empty()) {
+
+				//R is maximal
+				++a.nCliques_;
+				a.maxSize_ = std::max(a.maxSize_, a.clq_.size());
+
+				/////////////////////////////////////
+				if (!vis(a.clq_)) { return false; }
+				/////////////////////////////////////
+			}
+			return true;
+		}
+
+		//branch on P \ N(pivot)
+		const _bbt& npiv = g_.neighbors(select_pivot(P, X));
+		_bbt& Pnext = a.P_[depth + 1];
+		_bbt& Xnext = a.X_[depth + 1];
+
+		for (auto nBB = 0; nBB < P.number_of_blocks(); ++nBB) {
+			BITBOARD bb = P.block(nBB) & ~npiv.block(nBB);
+			while (bb) {
+				int v = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+				bb &= bb - 1;
+
+				const _bbt& nv = g_.neighbors(v);
+				AND(P, nv, Pnext);
+				AND(X, nv, Xnext);
+
+				a.clq_.push_back(v);
+				bool go_on = expand(depth + 1, a, vis);
+				a.clq_.pop_back();
+
+				/////////////////////
+				if (!go_on) { return false; }
+				/////////////////////
+
+				P.erase_bit(v);
+				X.set_bit(v);
+			}
+		}
+
+		return true;
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,451 @@
+/**
+* @file clq_heur.h
+* @brief header for class CliqueHeurParallel, a multi-start greedy maximum clique heuristic
+*		 for undirected graphs which runs the constructions concurrently under a time budget
+* @details: vertices are ranked by a degeneracy ordering (last vertex of the ordering first, see KCoreParallel).
+*			Start s grows a clique from the (s mod |V|)-th ranked vertex, adding each time a candidate
+*			adjacent to all the clique:
+*				- first pass (s < |V|): the best ranked candidate, as in KCore::find_heur_clique
+*				- later passes: a random candidate among the best ranked ceil(alpha |P|) (GRASP),
+*				  with the random stream Xoshiro256(seed, s)
+*			Starts are pulled by the worker threads from a shared atomic cursor. The incumbent is shared
+*			through an atomic, and starts which cannot improve it are cut early.
+* @details: the clique found is the same for any number of threads (ties are broken in favour
+*			of the first start), unless the run is stopped by TIME_OUT_HEUR or by the target size
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_HEUR_H__
+#define __CLIQUE_HEUR_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/graph_fast_sort.h"
+#include "graph/algorithms/kcore_parallel.h"
+#include "graph/algorithms/decode.h"
+#include "graph/algorithms/clique/clq_info.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class CliqueHeurParallel
+		// (multi-start maximum clique heuristic - multi-threaded)
+		//
+		////////////////////////////
+
+		template<class Graph_t>
+		class CliqueHeurParallel {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<bitgraph::Ugraph<BBScanSp>, Graph_t>::value,
+				"CliqueHeurParallel<Graph_t> requires Graph_t = Ugraph<BBScan> or Ugraph<BBScanSp>");
+
+		public:
+			using type = CliqueHeurParallel<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			//dense graphs are relabelled by rank, sparse graphs keep their labels
+			using is_dense = std::is_same<basic_type, BBScan>;
+
+			static constexpr double DEFAULT_ALPHA = 0.2;
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Preprocessing: degeneracy ranking of the vertices (and relabelling for dense graphs)
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup();
+
+			/*
+			* @brief Runs the constructions with paramBase::nThreads threads (setup() is called if required)
+			*		 until all starts are done, paramBase::TIME_OUT_HEUR is reached or a clique of
+			*		 the target size is found. If nThreads <= 0 the number of hardware threads is used
+			* @returns size of the largest clique found, -1 if error
+			*/
+			int run();
+
+			////////////////////////
+			//construction / destruction
+
+			explicit CliqueHeurParallel(Graph_t& g, const com::paramBase& p = com::paramBase()) :
+				g_(g), info_(p), NV_(g.number_of_vertices()), nStarts_(g.number_of_vertices()),
+				target_(0), alpha_(DEFAULT_ALPHA), seed_(_rand::RandomUniformGen<>::FIXED_RANDOM_SEED), isSetup_(false)
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			CliqueHeurParallel(const CliqueHeurParallel&) = delete;
+			CliqueHeurParallel& operator=	(const CliqueHeurParallel&) = delete;
+			CliqueHeurParallel(CliqueHeurParallel&&) = delete;
+			CliqueHeurParallel& operator=	(CliqueHeurParallel&&) = delete;
+
+			~CliqueHeurParallel() = default;
+
+			//////////
+			// setters / getters
+
+			const infoClq<int>& info()			const { return info_; }
+			infoClq<int>& info() { return info_; }
+			const vint& clique()				const { return info_.sol_; }
+			int number_of_threads()				const { return info_.data_.nThreads; }
+			void number_of_threads(int n) { info_.data_.nThreads = n; }
+			void time_out(double t) { info_.data_.TIME_OUT_HEUR = t; }
+
+			/*
+			* @brief number of constructions (the first |V| are greedy, the rest randomized), |V| by default
+			*/
+			void number_of_starts(int n) { nStarts_ = n; }
+			int number_of_starts()				const { return nStarts_; }
+
+			/*
+			* @brief the run stops as soon as a clique of size @t is found (0, by default, for no target)
+			*/
+			void target(int t) { target_ = t; }
+
+			/*
+			* @brief fraction of the candidates in the restricted candidate list of randomized starts, in (0, 1]
+			*/
+			void alpha(double a) { alpha_ = a; }
+			void seed(uint64_t s) { seed_ = s; }
+
+			/*
+			* @brief true if the last run stopped because a clique of the target size was found
+			*/
+			bool is_target_reached()			const { return target_ > 0 && info_.lb_ >= target_; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief packs an incumbent (size @s, found in start @t) in a 64-bit key
+			*		 larger keys are better (larger size, then earlier start)
+			*/
+			static uint64_t pack(int s, int t) {
+				return (static_cast<uint64_t>(s) << 32) | (0xFFFFFFFFu - static_cast<uint32_t>(t));
+			}
+
+			/*
+			* @brief minimum size of a clique found in start @t which improves the incumbent
+			*/
+			int need(int t) const {
+				uint64_t key = best_.load(std::memory_order_relaxed);
+				int s = static_cast<int>(key >> 32);
+				uint32_t owner = 0xFFFFFFFFu - static_cast<uint32_t>(key & 0xFFFFFFFFu);
+				return (owner > static_cast<uint32_t>(t)) ? s : s + 1;
+			}
+
+			/*
+			* @brief candidate of @P with the @k-th best rank (0 <= k < |P|)
+			*/
+			int select(const _bbt& P, int k, vint& buf, std::true_type /* dense */) const;
+			int select(const _bbt& P, int k, vint& buf, std::false_type /* sparse */) const;
+
+			/*
+			* @brief worker thread main loop - pulls starts until exhausted or stopped
+			*/
+			void worker();
+
+			/*
+			* @brief greedy construction of start @t
+			*/
+			void construct(int t, _bbt& P, vint& clq, vint& buf);
+
+			/*
+			* @brief reports clique @clq (found in start @t) as candidate incumbent
+			*/
+			void report(int t, const vint& clq);
+
+			////////////////
+			// data members
+		private:
+			Graph_t& g_;										//the input graph
+			Graph_t gs_;										//dense graphs - the graph relabelled by rank
+			const Graph_t* pg_ = nullptr;						//graph of the constructions (gs_ or g_)
+			Decode decode_;										//dense graphs - ordering of gs_ w.r.t. g_
+
+			infoClq<int> info_;
+			const int NV_;
+
+			vint vrank_;										//vertex of each rank (identity for dense graphs)
+			vint rank_;											//rank of each vertex (sparse graphs)
+			vint core_;											//coreness of vertices of *pg_
+
+			//parameters
+			int nStarts_;
+			int target_;
+			double alpha_;
+			uint64_t seed_;
+
+			//shared state
+			std::atomic<uint64_t> best_;						//packed incumbent (see pack(...))
+			std::atomic<int> next_;								//next start to pull
+			std::atomic<bool> abort_;							//TIME_OUT_HEUR or target reached
+			std::atomic<bool> timeOut_;
+			std::atomic<uint64_t> nSteps_;						//number of constructions
+			vint bestClq_;										//incumbent (labels of *pg_)
+			std::mutex mtx_;									//protects bestClq_ and incumbent timer
+
+			bool isSetup_;
+		};
+
+	}//end namespace _impl
+
+	using _impl::CliqueHeurParallel;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	constexpr double CliqueHeurParallel<Graph_t>::DEFAULT_ALPHA;
+
+	template<class Graph_t>
+	inline
+		int CliqueHeurParallel<Graph_t>::setup()
+	{
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(g_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(g_.number_of_edges());
+
+		//degeneracy ordering - rank 0 is the last vertex
+		KCoreParallel kc(g_, info_.data_.nThreads);
+		if (kc.find_kcore() == -1) {
+			LOG_ERROR("error computing the degeneracy ordering - CliqueHeurParallel<Graph_t>::setup");
+			return -1;
+		}
+		const vint& ord = kc.kcore_ordering();
+
+		decode_.clear();
+		if (is_dense::value) {
+
+			//vertex of rank r is relabelled r
+			vint o2n(NV_);
+			core_.assign(NV_, 0);
+			for (auto r = 0; r < NV_; ++r) {
+				o2n[ord[NV_ - 1 - r]] = r;
+				core_[r] = kc.coreness(ord[NV_ - 1 - r]);
+			}
+			GraphFastRootSort<Graph_t> gfs(g_);
+			if (gfs.reorder(o2n, gs_, &decode_) == -1) {
+				LOG_ERROR("error when reordering the graph - CliqueHeurParallel<Graph_t>::setup");
+				return -1;
+			}
+			vrank_.resize(NV_);
+			std::iota(vrank_.begin(), vrank_.end(), 0);
+			pg_ = &gs_;
+		}
+		else {
+			core_ = kc.coreness_numbers();
+			vrank_.assign(ord.rbegin(), ord.rend());
+			rank_.assign(NV_, 0);
+			for (auto r = 0; r < NV_; ++r) {
+				rank_[vrank_[r]] = r;
+			}
+			pg_ = &g_;
+		}
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int CliqueHeurParallel<Graph_t>::run()
+	{
+		if (!isSetup_ && setup() == -1) { return -1; }
+
+		//clears previous results (preprocessing info is kept)
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.clearTimer(infoBase::phase_t::LAST_INCUMBENT);
+		info_.sol_.clear();
+		info_.lb_ = 0;
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+
+		info_.startTimer(infoBase::phase_t::SEARCH);
+		info_.startTimer(infoBase::phase_t::LAST_INCUMBENT);
+
+		//empty graph - no starts
+		bestClq_.clear();
+		if (NV_ == 0) {
+			info_.readTimer(infoBase::phase_t::SEARCH);
+			return 0;
+		}
+
+		//initial incumbent - any vertex (improved by any start of size 1)
+		bestClq_.push_back(vrank_[0]);
+		best_.store(pack(static_cast<int>(bestClq_.size()), std::max(nStarts_, 0)));
+		next_.store(0);
+		abort_.store(target_ > 0 && static_cast<int>(bestClq_.size()) >= target_);
+		timeOut_.store(false);
+		nSteps_.store(0);
+
+		//////////////////////////
+		// parallel constructions
+		int nThreads = com::thread_count(info_.data_.nThreads, nStarts_);
+
+		com::run_parallel(nThreads, [this](int) { worker(); });
+		//////////////////////////
+
+		//decode the incumbent to the original graph
+		info_.lb_ = static_cast<int>(bestClq_.size());
+		info_.sol_ = is_dense::value ? decode_.decode(bestClq_) : bestClq_;
+		std::sort(info_.sol_.begin(), info_.sol_.end());
+		info_.nSteps_ = nSteps_.load();
+		info_.isTimeOut_ = timeOut_.load();
+
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return info_.lb_;
+	}
+
+	template<class Graph_t>
+	inline
+		int CliqueHeurParallel<Graph_t>::select(const _bbt& P, int k, vint&, std::true_type) const
+	{
+		//k-th bit of P
+		const int nBB = P.number_of_blocks();
+		for (auto i = 0; i < nBB; ++i) {
+			BITBOARD bb = P.block(i);
+			int pc = bblock::popc64(bb);
+			if (k >= pc) { k -= pc; continue; }
+			for (; k > 0; --k) { bb &= bb - 1; }
+			return WMUL(i) + bblock::lsb64_intrinsic(bb);
+		}
+		return BBObject::noBit;
+	}
+
+	template<class Graph_t>
+	inline
+		int CliqueHeurParallel<Graph_t>::select(const _bbt& P, int k, vint& buf, std::false_type) const
+	{
+		//k-th smallest rank in P
+		buf.clear();
+		for (auto it = P.cbegin(); it != P.cend(); ++it) {
+			BITBOARD bb = it->bb_;
+			while (bb) {
+				buf.push_back(rank_[WMUL(it->idx_) + bblock::lsb64_intrinsic(bb)]);
+				bb &= bb - 1;
+			}
+		}
+		if (k == 0) {
+			return vrank_[*std::min_element(buf.begin(), buf.end())];
+		}
+		std::nth_element(buf.begin(), buf.begin() + k, buf.end());
+		return vrank_[buf[k]];
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueHeurParallel<Graph_t>::worker()
+	{
+		_bbt P(NV_);
+		vint clq, buf;
+		clq.reserve(NV_);
+
+		int t = 0;
+		while (!abort_.load(std::memory_order_relaxed)) {
+
+			/////////////////////////////////////////////////////////
+			if ((t = next_.fetch_add(1, std::memory_order_relaxed)) >= nStarts_) { break; }
+			/////////////////////////////////////////////////////////
+
+			construct(t, P, clq, buf);
+			nSteps_.fetch_add(1, std::memory_order_relaxed);
+
+			//time-out check (after each construction)
+			if (com::_time::elapsedTime(info_.startTimeSearch_) >= info_.data_.TIME_OUT_HEUR) {
+				timeOut_.store(true, std::memory_order_relaxed);
+				abort_.store(true, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueHeurParallel<Graph_t>::construct(int t, _bbt& P, vint& clq, vint& buf)
+	{
+		const int v = vrank_[t % NV_];
+
+		//////////////////////////////////////
+		if (core_[v] + 1 < need(t)) { return; }
+		//////////////////////////////////////
+
+		const bool greedy = (t < NV_);
+		_rand::Xoshiro256 rng(seed_, static_cast<uint64_t>(t));
+
+		clq.clear();
+		clq.push_back(v);
+		P = pg_->neighbors(v);
+		int pc = P.is_empty() ? 0 : static_cast<int>(P.size());
+
+		while (pc > 0) {
+
+			/////////////////////////////////////////////////////////
+			if (static_cast<int>(clq.size()) + pc < need(t)) { return; }
+			/////////////////////////////////////////////////////////
+
+			int k = 0;
+			if (!greedy) {
+				int nRCL = std::max(1, static_cast<int>(std::ceil(alpha_ * pc)));
+				k = std::min(nRCL - 1, static_cast<int>((1.0 - rng.uniform_pos()) * nRCL));
+			}
+
+			int w = select(P, k, buf, is_dense());
+			clq.push_back(w);
+			P &= pg_->neighbors(w);
+			pc = P.is_empty() ? 0 : static_cast<int>(P.size());
+		}
+
+		report(t, clq);
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueHeurParallel<Graph_t>::report(int t, const vint& clq)
+	{
+		uint64_t key = pack(static_cast<int>(clq.size()), t);
+		if (key <= best_.load()) { return; }
+
+		std::lock_guard<std::mutex> lck(mtx_);
+		if (key <= best_.load()) { return; }
+
+		//new incumbent
+		bestClq_ = clq;
+		best_.store(key);
+		info_.timeIncumbent_ = com::_time::elapsedTime(info_.startTimeIncumbent_);
+		LOGG_DEBUG("clq_heur[lb:", clq.size(), " start:", t, " t:", info_.timeIncumbent_, "]");
+
+		if (target_ > 0 && static_cast<int>(clq.size()) >= target_) {
+			abort_.store(true, std::memory_order_relaxed);
+		}
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,87 @@
+/**
+* @file clq_info.h
+* @brief header for struct infoClq which reports results of exact and heuristic clique algorithms
+* @details: extends com::infoBase with incumbent, bound and search-tree information
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_INFO_H__
+#define __CLIQUE_INFO_H__
+
+#include "utils/info/info_base.h"
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		//////////////////////
+		//
+		// infoClq
+		//
+		// @brief results of clique algorithms (size or weight of the incumbent,
+		//		  the incumbent clique, number of steps and time-out condition)
+		//
+		// @details: W is the value type of the incumbent (int for cardinality,
+		//			 int or double for weighted cliques)
+		//
+		///////////////////////
+
+		template<class W = int>
+		struct infoClq : public com::infoBase {
+
+			using value_type = W;
+
+			W lb_ = 0;											//value of the incumbent (best clique found)
+			W ub_ = 0;											//upper bound at the root
+			std::vector<int> sol_;								//incumbent clique (vertices of the original graph)
+			uint64_t nSteps_ = 0;								//number of nodes of the search tree
+			bool isTimeOut_ = false;							//TRUE if the search was aborted by TIME_OUT
+
+			///////////////////////
+			//constructors / destructor
+
+			infoClq() = default;
+			explicit infoClq(const com::paramBase& p) : com::infoBase(p) {}
+
+			/////////////////////
+			// getters
+
+			W incumbent() const noexcept { return lb_; }
+			W upper_bound() const noexcept { return ub_; }
+			const std::vector<int>& solution() const noexcept { return sol_; }
+			uint64_t number_of_steps() const noexcept { return nSteps_; }
+			bool is_time_out() const noexcept { return isTimeOut_; }
+
+			/*
+			* @brief resets to default values
+			* @param lazy - if true general info is NOT cleared, only timers and results
+			*/
+			void clear(bool lazy = false) override {
+				com::infoBase::clear(lazy);
+				lb_ = 0;
+				ub_ = 0;
+				sol_.clear();
+				nSteps_ = 0;
+				isTimeOut_ = false;
+			}
+
+			//I/O
+			std::ostream& printReport(std::ostream& o = std::cout, bool is_endl = true) const override {
+				com::infoBase::printReport(o, false);
+				o << lb_ << "\t" << ub_ << "\t" << nSteps_ << "\t" << isTimeOut_ << "\t";
+				if (is_endl) { o << std::endl; }
+				return o;
+			}
+		};
+
+	}//end namespace _impl
+
+	using _impl::infoClq;
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,598 @@
+/**
+* @file clq_kclique.h
+* @brief header for class KClique, which counts and lists all the cliques of a fixed size k
+*		 of an undirected graph (dense or sparse)
+* @details: edges are oriented by a degeneracy ordering (KCore::kcore_ordering), so that every k-clique
+*			is found exactly once from its first vertex in the ordering, and the out-neighborhood N+(v)
+*			of every root v has at most degeneracy(G) vertices [Chiba and Nishizeki 1985, Danisch et al. 2018].
+* @details: for each root v, the subgraph induced by N+(v) is copied into a local (dense) bit matrix,
+*			oriented as well. The recursion then reduces to AND of local bitsets and popcount at the
+*			last level, independently of the global number of vertices and of the bitset type of the graph.
+* @details: the counter type Count_t is a template parameter - uint64_t by default; unsigned __int128
+*			may be used (GCC/Clang) for very large counts.
+* @details: listing mode streams the k-cliques to a visitor, any callable with signature bool(const vint& clq)
+*			- returning false stops the enumeration. In parallel mode root vertices are pulled by the threads
+*			from a shared cursor and the visitor is called concurrently, so it must be thread-safe.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_KCLIQUE_H__
+#define __CLIQUE_KCLIQUE_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/clique/clq_info.h"
+#include "bitscan/bitblock.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class KClique
+		// (k-clique counting and listing)
+		//
+		// @details: Graph_t is Ugraph<BBScan> or Ugraph<BBScanSp>
+		//
+		////////////////////////////
+
+		template<class Graph_t, class Count_t = uint64_t>
+		class KClique {
+
+		public:
+			using type = KClique<Graph_t, Count_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+			using count_type = Count_t;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum { CHECK_TIME_MASK = 0x3FF };					//time-out is checked every 1024 steps (per thread)
+
+			///////////////////
+			//per-thread working memory
+
+			struct Arena {
+				vint loc_;										//local index in N+(root) of each vertex, EMPTY_ELEM otherwise
+				std::vector<bitarray> adj_;						//oriented subgraph induced by N+(root) (local indexes)
+				std::vector<bitarray> P_;						//candidates - one per depth
+				int nBB_ = 0;									//number of blocks of the local bitsets of the current root
+				vint clq_;										//current clique (listing mode)
+				std::vector<Count_t> cnt_;						//cnt_[s]: number of s-cliques found (count_all)
+				Count_t nCliques_ = 0;
+				uint64_t nSteps_ = 0;
+
+				Arena(int NV, int dmax, int maxDepth) :
+					loc_(NV, EMPTY_ELEM),
+					adj_(dmax, bitarray(std::max(dmax, 1))),
+					P_(maxDepth, bitarray(std::max(dmax, 1)))
+				{
+					clq_.reserve(maxDepth + 1);
+				}
+			};
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Computes the degeneracy ordering and the oriented graph (called on first use if required)
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup();
+
+			/*
+			* @brief Number of cliques of size @k of the graph, roots are split among @nThreads threads
+			*		 (hardware threads if <= 0)
+			* @param k: size of the cliques (k >= 1)
+			* @returns number of k-cliques (0 if error)
+			*/
+			Count_t count(int k, int nThreads = 1);
+
+			/*
+			* @brief Number of cliques of every size 1..@kmax in a single traversal
+			* @param kmax: maximum size of the cliques (kmax >= 1)
+			* @returns vector cnt of size kmax + 1 where cnt[s] is the number of s-cliques (cnt[0] = 0),
+			*		   empty if error
+			*/
+			std::vector<Count_t> count_all(int kmax, int nThreads = 1);
+
+			/*
+			* @brief Streams all the cliques of size @k to the visitor @vis
+			* @param vis: visitor bool(const vint& clq), returns false to stop (thread-safe if nThreads != 1)
+			* @returns number of k-cliques reported
+			*/
+			template<class Visitor>
+			Count_t list(int k, Visitor&& vis, int nThreads = 1);
+
+			////////////////////////
+			//construction / destruction
+
+			explicit KClique(Graph_t& g, const com::paramBase& p = com::paramBase()) :
+				g_(g), info_(p), NV_(g.number_of_vertices()), dmax_(0), isSetup_(false)
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			KClique(const KClique&) = delete;
+			KClique& operator=	(const KClique&) = delete;
+			KClique(KClique&&) = delete;
+			KClique& operator=	(KClique&&) = delete;
+
+			~KClique() = default;
+
+			//////////
+			// setters / getters
+
+			/*
+			* @brief lb_ is the largest clique size for which a clique was found in the last run
+			*/
+			const infoClq<int>& info()				const { return info_; }
+			int degeneracy()						const { return dmax_; }
+			void time_out(double t) { info_.data_.TIME_OUT = t; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief runs @task(v, a) for every vertex v in the ordering with a thread pool of
+			*		 @nThreads threads, each one with its own arena. Stops when a task returns false.
+			*		 Arenas are reduced with @reduce(a) under a lock.
+			*/
+			template<class Task, class Reduce>
+			void for_each_root(int nThreads, int maxDepth, Task&& task, Reduce&& reduce);
+
+			/*
+			* @brief builds the local oriented subgraph induced by N+(@v) in the arena @a
+			* @returns |N+(v)|
+			*/
+			int init_root(int v, Arena& a) const;
+
+			/*
+			* @brief number of cliques of size @l in P_[depth] (local indexes)
+			*/
+			Count_t count_rec(int l, int depth, Arena& a);
+
+			/*
+			* @brief adds to cnt_[s + 1..kmax] the cliques which extend a clique of size @s with vertices in P_[depth]
+			*/
+			void count_all_rec(int s, int kmax, int depth, Arena& a);
+
+			/*
+			* @brief streams cliques of size @l in P_[depth] (extensions of a.clq_)
+			* @returns false if the enumeration must stop
+			*/
+			template<class Visitor>
+			bool list_rec(int l, int depth, Arena& a, Visitor& vis);
+
+			/*
+			* @brief time-out check every CHECK_TIME_MASK + 1 steps
+			* @returns true if the search must stop
+			*/
+			bool check_stop(Arena& a);
+
+			/*
+			* @brief clears search results and starts timers
+			*/
+			void start();
+
+			/*
+			* @brief closes the run (timers and time-out flag)
+			*/
+			void stop();
+
+			////////////////
+			// data members
+		private:
+			Graph_t& g_;
+			infoClq<int> info_;
+			const int NV_;
+
+			vint ord_;											//degeneracy ordering
+			vint outStart_;										//out-neighbors of v: outAdj_[outStart_[v]..outStart_[v + 1])
+			vint outAdj_;										//	(sorted by position in ord_)
+			int dmax_;											//maximum out-degree (degeneracy of the graph)
+
+			std::atomic<bool> abort_{ false };					//stops the enumeration (visitor or TIME_OUT)
+			std::atomic<bool> timeOut_{ false };
+			bool isSetup_;
+		};
+
+	}//end namespace _impl
+
+	using _impl::KClique;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t, class Count_t>
+	inline
+		int KClique<Graph_t, Count_t>::setup()
+	{
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(g_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(g_.number_of_edges());
+
+		ord_.clear();
+		outStart_.assign(NV_ + 1, 0);
+		outAdj_.clear();
+		dmax_ = 0;
+
+		if (NV_ > 0) {
+
+			//degeneracy ordering
+			KCore<Graph_t> kc(g_);
+			if (kc.find_kcore() == -1) {
+				LOG_ERROR("error when computing the degeneracy ordering - KClique<Graph_t>::setup");
+				return -1;
+			}
+			ord_ = kc.kcore_ordering();
+			vint pos(NV_, EMPTY_ELEM);
+			for (auto i = 0; i < NV_; ++i) {
+				pos[ord_[i]] = i;
+			}
+
+			//oriented graph v -> u iff pos[v] < pos[u], in CSR form
+			outAdj_.reserve(static_cast<std::size_t>(g_.number_of_edges()));
+			for (auto v = 0; v < NV_; ++v) {
+				outStart_[v] = static_cast<int>(outAdj_.size());
+
+				_bbt& nv = g_.neighbors(v);
+				if (!nv.is_empty() && nv.init_scan(bbo::NON_DESTRUCTIVE) != -1) {
+					int u = BBObject::noBit;
+					while ((u = nv.next_bit()) != BBObject::noBit) {
+						if (pos[u] > pos[v]) { outAdj_.push_back(u); }
+					}
+				}
+
+				//out-neighbors follow the ordering - local indexes preserve the orientation
+				std::sort(outAdj_.begin() + outStart_[v], outAdj_.end(),
+					[&pos](int a, int b) { return pos[a] < pos[b]; });
+
+				dmax_ = std::max(dmax_, static_cast<int>(outAdj_.size()) - outStart_[v]);
+			}
+			outStart_[NV_] = static_cast<int>(outAdj_.size());
+		}
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		Count_t KClique<Graph_t, Count_t>::count(int k, int nThreads)
+	{
+		if (k < 1) {
+			LOGG_ERROR("bad clique size: ", k, " - KClique<Graph_t>::count");
+			return 0;
+		}
+		if (!isSetup_ && setup() == -1) { return 0; }
+		start();
+
+		Count_t total = 0;
+		for_each_root(nThreads, k,
+			[this, k](int v, Arena& a) {
+				if (k == 1) { ++a.nCliques_; return true; }
+				if (outStart_[v + 1] - outStart_[v] < k - 1) { return true; }
+				init_root(v, a);
+				a.nCliques_ += count_rec(k - 1, 0, a);
+				return !abort_.load(std::memory_order_relaxed);
+			},
+			[&total](Arena& a) { total += a.nCliques_; }
+		);
+
+		if (total > 0) { info_.lb_ = k; }
+		stop();
+		return total;
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		std::vector<Count_t> KClique<Graph_t, Count_t>::count_all(int kmax, int nThreads)
+	{
+		if (kmax < 1) {
+			LOGG_ERROR("bad clique size: ", kmax, " - KClique<Graph_t>::count_all");
+			return std::vector<Count_t>();
+		}
+		if (!isSetup_ && setup() == -1) { return std::vector<Count_t>(); }
+		start();
+
+		std::vector<Count_t> total(kmax + 1, 0);
+		for_each_root(nThreads, kmax,
+			[this, kmax](int v, Arena& a) {
+				if (a.cnt_.empty()) { a.cnt_.assign(kmax + 1, 0); }
+				++a.cnt_[1];
+				if (kmax > 1 && outStart_[v + 1] > outStart_[v]) {
+					init_root(v, a);
+					count_all_rec(1, kmax, 0, a);
+				}
+				return !abort_.load(std::memory_order_relaxed);
+			},
+			[&total](Arena& a) {
+				for (std::size_t s = 0; s < a.cnt_.size(); ++s) { total[s] += a.cnt_[s]; }
+			}
+		);
+
+		for (auto s = kmax; s > 0; --s) {
+			if (total[s] > 0) { info_.lb_ = s; break; }
+		}
+		stop();
+		return total;
+	}
+
+	template<class Graph_t, class Count_t>
+	template<class Visitor>
+	inline
+		Count_t KClique<Graph_t, Count_t>::list(int k, Visitor&& vis, int nThreads)
+	{
+		if (k < 1) {
+			LOGG_ERROR("bad clique size: ", k, " - KClique<Graph_t>::list");
+			return 0;
+		}
+		if (!isSetup_ && setup() == -1) { return 0; }
+		start();
+
+		Count_t total = 0;
+		for_each_root(nThreads, k,
+			[this, k, &vis](int v, Arena& a) {
+				a.clq_.clear();
+				a.clq_.push_back(v);
+				if (k == 1) {
+					++a.nCliques_;
+					return static_cast<bool>(vis(a.clq_));
+				}
+				if (outStart_[v + 1] - outStart_[v] < k - 1) { return true; }
+				init_root(v, a);
+				return list_rec(k - 1, 0, a, vis);
+			},
+			[&total](Arena& a) { total += a.nCliques_; }
+		);
+
+		if (total > 0) { info_.lb_ = k; }
+		stop();
+		return total;
+	}
+
+	template<class Graph_t, class Count_t>
+	template<class Task, class Reduce>
+	inline
+		void KClique<Graph_t, Count_t>::for_each_root(int nThreads, int maxDepth, Task&& task, Reduce&& reduce)
+	{
+		nThreads = com::thread_count(nThreads, NV_);
+		info_.number_of_threads(nThreads);
+
+		std::atomic<int> next{ 0 };
+		std::mutex mtx;
+
+		auto worker = [&]() {
+			Arena a(NV_, dmax_, maxDepth);
+			int pos = 0;
+			while (!abort_.load(std::memory_order_relaxed) &&
+				(pos = next.fetch_add(1, std::memory_order_relaxed)) < NV_) {
+				if (!task(ord_[pos], a)) { abort_.store(true); }
+			}
+
+			std::lock_guard<std::mutex> lck(mtx);
+			info_.nSteps_ += a.nSteps_;
+			reduce(a);
+		};
+
+		com::run_parallel(nThreads, [&worker](int) { worker(); });
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		int KClique<Graph_t, Count_t>::init_root(int v, Arena& a) const
+	{
+		const int first = outStart_[v];
+		const int d = outStart_[v + 1] - first;
+		a.nBB_ = INDEX_1TO1(d);
+
+		for (auto i = 0; i < d; ++i) {
+			a.loc_[outAdj_[first + i]] = i;
+		}
+
+		//local oriented subgraph - i -> j iff j in N+(u_i) ∩ N+(v) (j > i)
+		for (auto i = 0; i < d; ++i) {
+			bitarray& row = a.adj_[i];
+			for (auto nBB = 0; nBB < a.nBB_; ++nBB) { row.block(nBB) = 0; }
+
+			int u = outAdj_[first + i];
+			for (auto j = outStart_[u]; j < outStart_[u + 1]; ++j) {
+				int l = a.loc_[outAdj_[j]];
+				if (l != EMPTY_ELEM) { row.set_bit(l); }
+			}
+		}
+
+		for (auto i = 0; i < d; ++i) {
+			a.loc_[outAdj_[first + i]] = EMPTY_ELEM;
+		}
+
+		//root candidates: all of N+(v)
+		bitarray& P = a.P_[0];
+		for (auto nBB = 0; nBB < a.nBB_; ++nBB) { P.block(nBB) = 0; }
+		if (d > 0) { P.set_bit(0, d - 1); }
+
+		return d;
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		Count_t KClique<Graph_t, Count_t>::count_rec(int l, int depth, Arena& a)
+	{
+		const bitarray& P = a.P_[depth];
+		Count_t res = 0;
+
+		//leaf - every candidate closes a clique
+		if (l == 1) {
+			for (auto nBB = 0; nBB < a.nBB_; ++nBB) { res += bblock::popc64(P.block(nBB)); }
+			return res;
+		}
+
+		if (check_stop(a)) { return 0; }
+
+		bitarray& Pnext = a.P_[depth + 1];
+		for (auto nBB = 0; nBB < a.nBB_; ++nBB) {
+			BITBOARD bb = P.block(nBB);
+			while (bb) {
+				int i = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+				bb &= bb - 1;
+
+				//candidates which follow i and are adjacent to i (only blocks >= nBB are non-empty)
+				const bitarray& ni = a.adj_[i];
+				int pc = 0;
+				for (auto b = nBB; b < a.nBB_; ++b) {
+					BITBOARD w = P.block(b) & ni.block(b);
+					Pnext.block(b) = w;
+					pc += bblock::popc64(w);
+				}
+
+				/////////////////////////////////////
+				if (pc < l - 1) { continue; }
+				if (l == 2) { res += pc; continue; }
+				/////////////////////////////////////
+
+				for (auto b = 0; b < nBB; ++b) { Pnext.block(b) = 0; }
+				res += count_rec(l - 1, depth + 1, a);
+			}
+		}
+
+		return res;
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		void KClique<Graph_t, Count_t>::count_all_rec(int s, int kmax, int depth, Arena& a)
+	{
+		const bitarray& P = a.P_[depth];
+
+		//every candidate extends the current s-clique
+		int pc = 0;
+		for (auto nBB = 0; nBB < a.nBB_; ++nBB) { pc += bblock::popc64(P.block(nBB)); }
+		a.cnt_[s + 1] += pc;
+
+		if (s + 1 == kmax || pc <= 1) { return; }
+		if (check_stop(a)) { return; }
+
+		bitarray& Pnext = a.P_[depth + 1];
+		for (auto nBB = 0; nBB < a.nBB_; ++nBB) {
+			BITBOARD bb = P.block(nBB);
+			while (bb) {
+				int i = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+				bb &= bb - 1;
+
+				const bitarray& ni = a.adj_[i];
+				bool empty = true;
+				for (auto b = 0; b < nBB; ++b) { Pnext.block(b) = 0; }
+				for (auto b = nBB; b < a.nBB_; ++b) {
+					Pnext.block(b) = P.block(b) & ni.block(b);
+					empty = empty && (Pnext.block(b) == 0);
+				}
+
+				if (!empty) { count_all_rec(s + 1, kmax, depth + 1, a); }
+			}
+		}
+	}
+
+	template<class Graph_t, class Count_t>
+	template<class Visitor>
+	inline
+		bool KClique<Graph_t, Count_t>::list_rec(int l, int depth, Arena& a, Visitor& vis)
+	{
+		if (check_stop(a)) { return false; }
+
+		const bitarray& P = a.P_[depth];
+		bitarray& Pnext = a.P_[depth + 1];
+		const int* out = &outAdj_[outStart_[a.clq_.front()]];		//local to global index
+
+		for (auto nBB = 0; nBB < a.nBB_; ++nBB) {
+			BITBOARD bb = P.block(nBB);
+			while (bb) {
+				int i = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+				bb &= bb - 1;
+
+				a.clq_.push_back(out[i]);
+				bool go_on = true;
+
+				if (l == 1) {
+					++a.nCliques_;
+
+					/////////////////////////////////////
+					go_on = vis(a.clq_);
+					/////////////////////////////////////
+				}
+				else {
+					const bitarray& ni = a.adj_[i];
+					int pc = 0;
+					for (auto b = 0; b < nBB; ++b) { Pnext.block(b) = 0; }
+					for (auto b = nBB; b < a.nBB_; ++b) {
+						Pnext.block(b) = P.block(b) & ni.block(b);
+						pc += bblock::popc64(Pnext.block(b));
+					}
+					if (pc >= l - 1) { go_on = list_rec(l - 1, depth + 1, a, vis); }
+				}
+
+				a.clq_.pop_back();
+				if (!go_on) { return false; }
+			}
+		}
+
+		return true;
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		bool KClique<Graph_t, Count_t>::check_stop(Arena& a)
+	{
+		++a.nSteps_;
+		if ((a.nSteps_ & CHECK_TIME_MASK) == 0 &&
+			com::_time::elapsedTime(info_.startTimeSearch_) >= info_.data_.TIME_OUT) {
+			timeOut_.store(true, std::memory_order_relaxed);
+			abort_.store(true, std::memory_order_relaxed);
+		}
+		return abort_.load(std::memory_order_relaxed);
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		void KClique<Graph_t, Count_t>::start()
+	{
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.lb_ = 0;
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+		abort_.store(false);
+		timeOut_.store(false);
+		info_.startTimer(infoBase::phase_t::SEARCH);
+	}
+
+	template<class Graph_t, class Count_t>
+	inline
+		void KClique<Graph_t, Count_t>::stop()
+	{
+		info_.isTimeOut_ = timeOut_.load();
+		info_.readTimer(infoBase::phase_t::SEARCH);
+	}
+
+}//end namespace bitgraph
+
+#endif
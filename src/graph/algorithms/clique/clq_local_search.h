@@ -0,0 +1,669 @@
+/**
+* @file clq_local_search.h
+* @brief header for class CliqueLocalSearch, a local search for the maximum (weight) clique problem
+*		 in large dense or sparse undirected graphs, with optional vertex weights
+* @details: multi-neighborhood tabu search in the style of MN/TS [Wu, Hao and Glover 2012]:
+*			- ADD: a vertex adjacent to all the current clique C (set PA)
+*			- SWAP: a vertex adjacent to all of C but one, which leaves C (set OM)
+*			- DROP: a vertex of C
+*			The best non-tabu ADD is taken if there is one, otherwise the best of SWAP and DROP.
+*			Vertices which leave C are tabu for 7 (+ a random number up to |OM| for SWAP) moves.
+*			The walk restarts from a random vertex after a number of moves without improvement.
+* @details: moves are incremental. cnt[v] = |N(v) and C| is updated over N(u) when u enters or leaves
+*			C, and PA / OM are position-indexed sets rebuilt from the neighbors of the two vertices of C
+*			with smallest degree, so a move costs O(deg) and never O(|V|) (C and the tabu state are
+*			per-walker bitset / stamp arrays)
+* @details: pruning - a clique with v has at most coreness(v) more vertices, all neighbors of v, so its
+*			weight is at most ub(v) = w(v) + the coreness(v) largest weights of N(v). Vertices with
+*			ub(v) <= incumbent are never added again, and if no vertex is left the incumbent is optimal
+* @details: parallel walkers share the incumbent (and therefore pruning). Throughput is recorded per second
+*			of the run, see throughput() and moves_per_second()
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_LOCAL_SEARCH_H__
+#define __CLIQUE_LOCAL_SEARCH_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/simple_graph_w.h"
+#include "graph/algorithms/kcore_parallel.h"
+#include "graph/algorithms/clique/clq_info.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <memory>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class CliqueLocalSearch
+		// (maximum (weight) clique local search - single or parallel walkers)
+		//
+		////////////////////////////
+
+		template<class Graph_t, class W = int>
+		class CliqueLocalSearch {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<bitgraph::Ugraph<BBScanSp>, Graph_t>::value,
+				"CliqueLocalSearch<Graph_t, W> requires Graph_t = Ugraph<BBScan> or Ugraph<BBScanSp>");
+			static_assert(std::is_arithmetic<W>::value, "CliqueLocalSearch<Graph_t, W> requires arithmetic weights");
+
+		public:
+			using type = CliqueLocalSearch<Graph_t, W>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+			using wtype = W;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+			using _wt = W;
+
+			using is_dense = std::is_same<basic_type, BBScan>;
+
+			enum { CHECK_MASK = 0xFF };										//stop conditions are checked every 256 moves
+			static constexpr uint64_t DEFAULT_MAX_MOVES = 1000000;			//per walker
+			static constexpr int DEFAULT_MAX_STALL = 4000;					//moves without improvement before a restart
+			static constexpr int TABU_TENURE = 7;
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Preprocessing: coreness (KCoreParallel) and weight upper bounds of the vertices
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup();
+
+			/*
+			* @brief Runs paramBase::nThreads independent walkers (setup() is called if required) until
+			*		 the number of moves, paramBase::TIME_OUT_HEUR or the target is reached, or the
+			*		 incumbent is proved optimal. If nThreads <= 0 the number of hardware threads is used
+			* @returns weight (size if unweighted) of the best clique found, -1 if error
+			*/
+			W run();
+
+			////////////////////////
+			//construction / destruction
+
+			/*
+			* @brief unweighted graph (unit weights)
+			*/
+			explicit CliqueLocalSearch(Graph_t& g, const com::paramBase& p = com::paramBase()) :
+				g_(g), w_(g.number_of_vertices(), W(1)), info_(p), NV_(g.number_of_vertices())
+			{}
+
+			/*
+			* @brief vertex-weighted graph (positive weights)
+			*/
+			explicit CliqueLocalSearch(Base_Graph_W<Graph_t, W>& gw, const com::paramBase& p = com::paramBase()) :
+				g_(gw.graph()), w_(gw.weight()), info_(p), NV_(gw.graph().number_of_vertices())
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			CliqueLocalSearch(const CliqueLocalSearch&) = delete;
+			CliqueLocalSearch& operator=	(const CliqueLocalSearch&) = delete;
+			CliqueLocalSearch(CliqueLocalSearch&&) = delete;
+			CliqueLocalSearch& operator=	(CliqueLocalSearch&&) = delete;
+
+			~CliqueLocalSearch() = default;
+
+			//////////
+			// setters / getters
+
+			const infoClq<W>& info()			const { return info_; }
+			infoClq<W>& info() { return info_; }
+			const vint& clique()				const { return info_.sol_; }
+			int number_of_threads()				const { return info_.data_.nThreads; }
+			void number_of_threads(int n) { info_.data_.nThreads = n; }
+			void time_out(double t) { info_.data_.TIME_OUT_HEUR = t; }
+
+			void max_moves(uint64_t n) { maxMoves_ = n; }						//per walker
+			void max_stall(int n) { maxStall_ = n; }
+			void target(W t) { target_ = t; isTarget_ = true; }
+			void seed(uint64_t s) { seed_ = s; }
+
+			/*
+			* @brief true if the last run proved the incumbent optimal (every vertex was pruned)
+			*/
+			bool is_optimal()					const { return isOptimal_; }
+			uint64_t number_of_restarts()		const { return nRestarts_; }
+
+			/*
+			* @brief average moves per second of the last run (all walkers)
+			*/
+			double moves_per_second()			const;
+
+			/*
+			* @brief moves (all walkers) in each whole second of the last run
+			*/
+			const std::vector<uint64_t>& throughput() const { return throughput_; }
+
+			/*
+			* @brief upper bound of the weight of any clique with vertex v (after setup())
+			*/
+			W upper_bound(int v)				const { return ub_[v]; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief set of vertices with O(1) insertion / deletion / membership and O(size) enumeration
+			*/
+			struct IndexSet {
+				vint items_;
+				vint pos_;
+
+				explicit IndexSet(int NV) : pos_(NV, EMPTY_ELEM) { items_.reserve(NV); }
+				bool contains(int v) const { return pos_[v] != EMPTY_ELEM; }
+				int size() const { return static_cast<int>(items_.size()); }
+				void insert(int v) {
+					if (pos_[v] == EMPTY_ELEM) { pos_[v] = static_cast<int>(items_.size()); items_.push_back(v); }
+				}
+				void erase(int v) {
+					int p = pos_[v];
+					if (p == EMPTY_ELEM) { return; }
+					items_[p] = items_.back();
+					pos_[items_[p]] = p;
+					items_.pop_back();
+					pos_[v] = EMPTY_ELEM;
+				}
+				void clear() {
+					for (auto v : items_) { pos_[v] = EMPTY_ELEM; }
+					items_.clear();
+				}
+			};
+
+			/*
+			* @brief per-walker state
+			*/
+			struct Walker {
+				vint C_;										//current clique
+				BBScan inC_;									//members of C_
+				W wC_ = W(0);									//weight of C_
+				vint cnt_;										//|N(v) and C_|
+				IndexSet PA_;									//ADD candidates - cnt = |C|
+				IndexSet OM_;									//SWAP candidates - cnt = |C| - 1 >= 1
+				std::vector<uint64_t> tabu_;					//vertex v is tabu while move < tabu_[v]
+				_rand::Xoshiro256 rng_;
+
+				uint64_t nMoves_ = 0;
+				uint64_t nRestarts_ = 0;
+				std::vector<uint64_t> movesAt_;					//moves at the end of each whole second
+
+				Walker(int NV, uint64_t seed, uint64_t stream) : inC_(NV), cnt_(NV, 0), PA_(NV), OM_(NV),
+					tabu_(NV, 0), rng_(seed, stream) {
+					C_.reserve(NV);
+				}
+
+				int rand_int(int n) { return std::min(n - 1, static_cast<int>((1.0 - rng_.uniform_pos()) * n)); }
+			};
+
+			/*
+			* @brief calls @f(w) for every neighbor w of v
+			*/
+			template<class Func>
+			void for_each_neighbor(int v, Func f, std::true_type /* dense */) const;
+			template<class Func>
+			void for_each_neighbor(int v, Func f, std::false_type /* sparse */) const;
+			template<class Func>
+			void for_each_neighbor(int v, Func f) const { for_each_neighbor(v, f, is_dense()); }
+
+			bool is_pruned(int v) const { return ub_[v] <= best_.load(std::memory_order_relaxed); }
+
+			void add(Walker& wk, int v);
+			void drop(Walker& wk, int u);
+
+			/*
+			* @brief rebuilds PA and OM from cnt after a DROP
+			*/
+			void rebuild(Walker& wk);
+
+			/*
+			* @brief empties the clique and starts again from a random vertex which is not pruned
+			* @returns false if every vertex is pruned
+			*/
+			bool restart(Walker& wk);
+
+			/*
+			* @brief the unique vertex of C not adjacent to @v (v in OM)
+			*/
+			int missing(const Walker& wk, int v) const;
+
+			/*
+			* @brief walker main loop
+			*/
+			void walk(int id);
+
+			/*
+			* @brief reports the clique of @wk as candidate incumbent
+			*/
+			void report(const Walker& wk);
+
+			////////////////
+			// data members
+		private:
+			Graph_t& g_;
+			std::vector<W> w_;									//vertex weights
+			infoClq<W> info_;
+			const int NV_;
+
+			vint deg_;
+			std::vector<W> ub_;									//weight bound of cliques with v
+
+			//parameters
+			uint64_t maxMoves_ = DEFAULT_MAX_MOVES;
+			int maxStall_ = DEFAULT_MAX_STALL;
+			W target_ = W(0);
+			bool isTarget_ = false;
+			uint64_t seed_ = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED;
+
+			//shared state
+			std::atomic<W> best_;
+			std::atomic<bool> abort_;
+			std::atomic<bool> timeOut_;
+			std::atomic<int> nExhausted_;						//walkers which found every vertex pruned
+			std::mutex mtx_;									//protects the incumbent and the run statistics
+
+			//run statistics
+			uint64_t nRestarts_ = 0;
+			std::vector<uint64_t> throughput_;
+			bool isOptimal_ = false;
+			bool isSetup_ = false;
+		};
+
+	}//end namespace _impl
+
+	using _impl::CliqueLocalSearch;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t, class W>
+	constexpr uint64_t CliqueLocalSearch<Graph_t, W>::DEFAULT_MAX_MOVES;
+
+	template<class Graph_t, class W>
+	template<class Func>
+	inline
+		void CliqueLocalSearch<Graph_t, W>::for_each_neighbor(int v, Func f, std::true_type) const
+	{
+		const auto& row = g_.neighbors(v);
+		const int nBB = row.number_of_blocks();
+		for (auto i = 0; i < nBB; ++i) {
+			BITBOARD bb = row.block(i);
+			while (bb) {
+				f(WMUL(i) + bblock::lsb64_intrinsic(bb));
+				bb &= bb - 1;
+			}
+		}
+	}
+
+	template<class Graph_t, class W>
+	template<class Func>
+	inline
+		void CliqueLocalSearch<Graph_t, W>::for_each_neighbor(int v, Func f, std::false_type) const
+	{
+		const auto& row = g_.neighbors(v);
+		for (auto it = row.cbegin(); it != row.cend(); ++it) {
+			BITBOARD bb = it->bb_;
+			while (bb) {
+				f(WMUL(it->idx_) + bblock::lsb64_intrinsic(bb));
+				bb &= bb - 1;
+			}
+		}
+	}
+
+	template<class Graph_t, class W>
+	inline
+		int CliqueLocalSearch<Graph_t, W>::setup()
+	{
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(g_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(g_.number_of_edges());
+
+		if (static_cast<int>(w_.size()) != NV_) {
+			LOG_ERROR("bad number of weights - CliqueLocalSearch<Graph_t, W>::setup");
+			return -1;
+		}
+
+		KCoreParallel kc(g_, info_.data_.nThreads);
+		if (kc.find_kcore() == -1) {
+			LOG_ERROR("error computing coreness - CliqueLocalSearch<Graph_t, W>::setup");
+			return -1;
+		}
+
+		//ub(v) = w(v) + the coreness(v) largest weights of N(v)
+		deg_.assign(NV_, 0);
+		ub_.assign(NV_, W(0));
+		std::vector<W> wn;
+		W ubMax = W(0);
+		for (auto v = 0; v < NV_; ++v) {
+			wn.clear();
+			for_each_neighbor(v, [&](int u) { wn.push_back(w_[u]); });
+			deg_[v] = static_cast<int>(wn.size());
+			const int k = std::min(kc.coreness(v), deg_[v]);
+			std::nth_element(wn.begin(), wn.begin() + k, wn.end(), std::greater<W>());
+			ub_[v] = w_[v];
+			for (auto i = 0; i < k; ++i) { ub_[v] += wn[i]; }
+			ubMax = std::max(ubMax, ub_[v]);
+		}
+		info_.ub_ = ubMax;
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class Graph_t, class W>
+	inline
+		W CliqueLocalSearch<Graph_t, W>::run()
+	{
+		if (!isSetup_ && setup() == -1) { return W(-1); }
+
+		//clears previous results (preprocessing info is kept)
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.clearTimer(infoBase::phase_t::LAST_INCUMBENT);
+		info_.sol_.clear();
+		info_.lb_ = W(0);
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+		nRestarts_ = 0;
+		throughput_.clear();
+		isOptimal_ = false;
+
+		info_.startTimer(infoBase::phase_t::SEARCH);
+		info_.startTimer(infoBase::phase_t::LAST_INCUMBENT);
+
+		best_.store(W(0));
+		abort_.store(false);
+		timeOut_.store(false);
+		nExhausted_.store(0);
+
+		//////////////////////////
+		// parallel walkers
+		int nThreads = com::thread_count(info_.data_.nThreads);
+
+		if (NV_ > 0) {
+			com::run_parallel(nThreads, [this](int i) { walk(i); });
+		}
+		//////////////////////////
+
+		info_.lb_ = best_.load();
+		std::sort(info_.sol_.begin(), info_.sol_.end());
+		info_.isTimeOut_ = timeOut_.load();
+		isOptimal_ = (nExhausted_.load() > 0);
+
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return info_.lb_;
+	}
+
+	template<class Graph_t, class W>
+	inline
+		double CliqueLocalSearch<Graph_t, W>::moves_per_second() const
+	{
+		return (info_.timeSearch_ > 0) ? info_.nSteps_ / info_.timeSearch_ : 0.0;
+	}
+
+	template<class Graph_t, class W>
+	inline
+		void CliqueLocalSearch<Graph_t, W>::add(Walker& wk, int v)
+	{
+		wk.C_.push_back(v);
+		wk.inC_.set_bit(v);
+		wk.wC_ += w_[v];
+		wk.PA_.erase(v);
+		wk.OM_.erase(v);
+		for_each_neighbor(v, [&wk](int u) { ++wk.cnt_[u]; });
+
+		const int sC = static_cast<int>(wk.C_.size());
+		if (sC == 1) {
+			for_each_neighbor(v, [&wk](int u) { wk.PA_.insert(u); });
+			return;
+		}
+
+		//OM - vertices still missing one vertex of C
+		for (auto i = wk.OM_.size() - 1; i >= 0; --i) {
+			int u = wk.OM_.items_[i];
+			if (wk.cnt_[u] != sC - 1) { wk.OM_.erase(u); }
+		}
+
+		//PA - vertices not adjacent to v move to OM
+		for (auto i = wk.PA_.size() - 1; i >= 0; --i) {
+			int u = wk.PA_.items_[i];
+			if (wk.cnt_[u] != sC) {
+				wk.PA_.erase(u);
+				wk.OM_.insert(u);
+			}
+		}
+	}
+
+	template<class Graph_t, class W>
+	inline
+		void CliqueLocalSearch<Graph_t, W>::drop(Walker& wk, int u)
+	{
+		auto it = std::find(wk.C_.begin(), wk.C_.end(), u);
+		*it = wk.C_.back();
+		wk.C_.pop_back();
+		wk.inC_.erase_bit(u);
+		wk.wC_ -= w_[u];
+		for_each_neighbor(u, [&wk](int x) { --wk.cnt_[x]; });
+		rebuild(wk);
+	}
+
+	template<class Graph_t, class W>
+	inline
+		void CliqueLocalSearch<Graph_t, W>::rebuild(Walker& wk)
+	{
+		wk.PA_.clear();
+		wk.OM_.clear();
+		const int sC = static_cast<int>(wk.C_.size());
+		if (sC == 0) { return; }
+
+		//the two vertices of C with smallest degree - PA is in N(a), OM in N(a) or N(b)
+		int a = wk.C_[0], b = EMPTY_ELEM;
+		for (auto i = 1; i < sC; ++i) {
+			int c = wk.C_[i];
+			if (deg_[c] < deg_[a]) { b = a; a = c; }
+			else if (b == EMPTY_ELEM || deg_[c] < deg_[b]) { b = c; }
+		}
+
+		for_each_neighbor(a, [&](int x) {
+			if (wk.inC_.is_bit(x)) { return; }
+			if (wk.cnt_[x] == sC) { wk.PA_.insert(x); }
+			else if (sC > 1 && wk.cnt_[x] == sC - 1) { wk.OM_.insert(x); }
+		});
+		if (b != EMPTY_ELEM) {
+			for_each_neighbor(b, [&](int x) {
+				if (!wk.inC_.is_bit(x) && wk.cnt_[x] == sC - 1) { wk.OM_.insert(x); }
+			});
+		}
+	}
+
+	template<class Graph_t, class W>
+	inline
+		bool CliqueLocalSearch<Graph_t, W>::restart(Walker& wk)
+	{
+		for (auto c : wk.C_) {
+			wk.inC_.erase_bit(c);
+			for_each_neighbor(c, [&wk](int x) { --wk.cnt_[x]; });
+		}
+		wk.C_.clear();
+		wk.wC_ = W(0);
+		wk.PA_.clear();
+		wk.OM_.clear();
+		++wk.nRestarts_;
+
+		//random vertex which is not pruned (linear scan from a random position if sampling fails)
+		int v = wk.rand_int(NV_);
+		for (auto i = 0; i < 32 && is_pruned(v); ++i) {
+			v = wk.rand_int(NV_);
+		}
+		for (auto i = 0; i < NV_ && is_pruned(v); ++i) {
+			v = (v + 1 == NV_) ? 0 : v + 1;
+		}
+		if (is_pruned(v)) { return false; }
+
+		add(wk, v);
+		return true;
+	}
+
+	template<class Graph_t, class W>
+	inline
+		int CliqueLocalSearch<Graph_t, W>::missing(const Walker& wk, int v) const
+	{
+		const auto& row = g_.neighbors(v);
+		for (auto c : wk.C_) {
+			if (!row.is_bit(c)) { return c; }
+		}
+		return EMPTY_ELEM;
+	}
+
+	template<class Graph_t, class W>
+	inline
+		void CliqueLocalSearch<Graph_t, W>::walk(int id)
+	{
+		Walker wk(NV_, seed_, static_cast<uint64_t>(id));
+		W wBest = W(0);											//best weight since the last restart
+		uint64_t lastImprove = 0;
+
+		bool exhausted = !restart(wk);
+		if (!exhausted && wk.wC_ > best_.load(std::memory_order_relaxed)) { report(wk); }
+
+		while (!exhausted && !abort_.load(std::memory_order_relaxed)) {
+
+			const uint64_t it = wk.nMoves_++;
+
+			//stop conditions and throughput
+			if ((it & CHECK_MASK) == 0) {
+				const double elapsed = com::_time::elapsedTime(info_.startTimeSearch_);
+				while (wk.movesAt_.size() < static_cast<std::size_t>(elapsed)) { wk.movesAt_.push_back(it); }
+				if (elapsed >= info_.data_.TIME_OUT_HEUR) {
+					timeOut_.store(true, std::memory_order_relaxed);
+					abort_.store(true, std::memory_order_relaxed);
+					break;
+				}
+				if (it >= maxMoves_) { break; }
+			}
+
+			//stagnation
+			if (it - lastImprove > static_cast<uint64_t>(maxStall_)) {
+				if (!restart(wk)) { exhausted = true; break; }
+				wBest = wk.wC_;
+				lastImprove = it;
+				continue;
+			}
+
+			/////////////////////
+			// ADD - best weight, random ties (tabu vertices only if they improve the incumbent)
+			const W bestW = best_.load(std::memory_order_relaxed);
+			int vAdd = EMPTY_ELEM, nTies = 0;
+			for (auto v : wk.PA_.items_) {
+				if (ub_[v] <= bestW) { continue; }
+				if (wk.tabu_[v] > it && wk.wC_ + w_[v] <= bestW) { continue; }
+				if (vAdd == EMPTY_ELEM || w_[v] > w_[vAdd]) { vAdd = v; nTies = 1; }
+				else if (w_[v] == w_[vAdd] && wk.rand_int(++nTies) == 0) { vAdd = v; }
+			}
+
+			if (vAdd != EMPTY_ELEM) {
+				add(wk, vAdd);
+			}
+			else {
+				/////////////////////
+				// SWAP - best gain w(v) - w(u), u the vertex of C not adjacent to v
+				int vSwap = EMPTY_ELEM, uSwap = EMPTY_ELEM;
+				W gSwap = W(0);
+				nTies = 0;
+				for (auto v : wk.OM_.items_) {
+					if (wk.tabu_[v] > it || ub_[v] <= bestW) { continue; }
+					int u = missing(wk, v);
+					W g = w_[v] - w_[u];
+					if (vSwap == EMPTY_ELEM || g > gSwap) { vSwap = v; uSwap = u; gSwap = g; nTies = 1; }
+					else if (g == gSwap && wk.rand_int(++nTies) == 0) { vSwap = v; uSwap = u; }
+				}
+
+				/////////////////////
+				// DROP - lightest vertex of C
+				int uDrop = wk.C_[0];
+				for (auto c : wk.C_) {
+					if (w_[c] < w_[uDrop]) { uDrop = c; }
+				}
+
+				if (vSwap != EMPTY_ELEM && gSwap >= -w_[uDrop]) {
+					const int nOM = wk.OM_.size();
+					drop(wk, uSwap);
+					add(wk, vSwap);
+					wk.tabu_[uSwap] = it + TABU_TENURE + wk.rand_int(nOM + 1);
+				}
+				else if (wk.C_.size() > 1) {
+					drop(wk, uDrop);
+					wk.tabu_[uDrop] = it + TABU_TENURE;
+				}
+				else {
+					if (!restart(wk)) { exhausted = true; break; }
+					wBest = wk.wC_;
+					lastImprove = it;
+				}
+			}
+
+			//improvements
+			if (wk.wC_ > wBest) {
+				wBest = wk.wC_;
+				lastImprove = it;
+				if (wk.wC_ > best_.load(std::memory_order_relaxed)) { report(wk); }
+			}
+		}
+
+		if (exhausted) { nExhausted_.fetch_add(1); }
+
+		//run statistics
+		std::lock_guard<std::mutex> lck(mtx_);
+		info_.nSteps_ += wk.nMoves_;
+		nRestarts_ += wk.nRestarts_;
+		uint64_t prev = 0;
+		for (std::size_t s = 0; s < wk.movesAt_.size(); ++s) {
+			if (throughput_.size() <= s) { throughput_.push_back(0); }
+			throughput_[s] += wk.movesAt_[s] - prev;
+			prev = wk.movesAt_[s];
+		}
+	}
+
+	template<class Graph_t, class W>
+	inline
+		void CliqueLocalSearch<Graph_t, W>::report(const Walker& wk)
+	{
+		std::lock_guard<std::mutex> lck(mtx_);
+		if (wk.wC_ <= best_.load()) { return; }
+
+		//new incumbent
+		best_.store(wk.wC_);
+		info_.sol_ = wk.C_;
+		info_.timeIncumbent_ = com::_time::elapsedTime(info_.startTimeIncumbent_);
+		LOGG_DEBUG("clq_ls[lb:", wk.wC_, " size:", wk.C_.size(), " move:", wk.nMoves_, " t:", info_.timeIncumbent_, "]");
+
+		if (isTarget_ && wk.wC_ >= target_) {
+			abort_.store(true, std::memory_order_relaxed);
+		}
+	}
+
+}//end namespace bitgraph
+
+#endif
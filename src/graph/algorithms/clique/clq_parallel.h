@@ -0,0 +1,452 @@
+/**
+* @file clq_parallel.h
+* @brief header for class CliqueParallel, a multi-threaded exact maximum clique algorithm
+*		 for undirected graphs (bit-parallel branch-and-bound with greedy coloring bounds)
+* @details: the root of the search tree is split into one task per candidate vertex. Tasks are pulled
+*			by the worker threads from a shared atomic cursor and the incumbent is shared through
+*			an atomic, so that bounds tighten across threads. Each thread owns an arena
+*			of preallocated bitsets (one per depth).
+* @details: the final clique is deterministic, i.e., it does not depend on the number of threads
+*			or on thread scheduling. Ties between cliques of the same size are broken in favour
+*			of the task which comes first in sequential order (see need(...))
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_PARALLEL_H__
+#define __CLIQUE_PARALLEL_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/graph_fast_sort.h"
+#include "graph/algorithms/decode.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_info.h"
+#include "graph/algorithms/clique/clq_heur.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class CliqueParallel
+		// (exact maximum clique - multi-threaded)
+		//
+		////////////////////////////
+
+		template<class Graph_t>
+		class CliqueParallel {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value,
+				"CliqueParallel<Graph_t> requires Graph_t = Ugraph<BBScan>");
+
+		public:
+			using type = CliqueParallel<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum { CHECK_TIME_MASK = 0x3FF };					//time-out is checked every 1024 steps (per thread)
+
+			///////////////////
+			//per-thread working memory
+
+			struct Arena {
+				std::vector<_bbt> P_;							//candidate sets - one per depth
+				std::vector<vint> L_;							//vertices to branch on - one per depth
+				std::vector<vint> C_;							//colors of vertices in L_ - one per depth
+				_bbt U_;										//coloring - uncolored vertices
+				_bbt Q_;										//coloring - vertices that may enter the current color class
+				vint clq_;										//current clique
+				uint64_t nSteps_ = 0;
+
+				Arena(int NV, int maxDepth) : P_(maxDepth, _bbt(NV)), L_(maxDepth, vint(NV)), C_(maxDepth, vint(NV)),
+					U_(NV), Q_(NV) {
+					clq_.reserve(maxDepth);
+				}
+			};
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Preprocessing: the graph is reordered by minimum width (degeneracy), last to first
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup();
+
+			/*
+			* @brief Runs the parallel search with paramBase::nThreads threads (setup() is called if required)
+			*		 If nThreads <= 0 the number of hardware threads is used
+			* @returns size of the maximum clique found (the optimum if not TIME_OUT), -1 if error
+			*/
+			int run();
+
+			////////////////////////
+			//construction / destruction
+
+			explicit CliqueParallel(Graph_t& g, const com::paramBase& p = com::paramBase()) :
+				g_(g), info_(p), NV_(g.number_of_vertices()), nTasks_(0), nHeurStarts_(0), isSetup_(false)
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			CliqueParallel(const CliqueParallel&) = delete;
+			CliqueParallel& operator=	(const CliqueParallel&) = delete;
+			CliqueParallel(CliqueParallel&&) = delete;
+			CliqueParallel& operator=	(CliqueParallel&&) = delete;
+
+			~CliqueParallel() = default;
+
+			//////////
+			// setters / getters
+
+			const infoClq<int>& info()			const { return info_; }
+			infoClq<int>& info() { return info_; }
+			const vint& clique()				const { return info_.sol_; }
+			int number_of_threads()				const { return info_.data_.nThreads; }
+			void number_of_threads(int n) { info_.data_.nThreads = n; }
+			void time_out(double t) { info_.data_.TIME_OUT = t; }
+
+			/*
+			* @brief number of starts of the initial CliqueHeurParallel heuristic, limited by TIME_OUT_HEUR
+			*		 (0, by default, for the single greedy clique of find_clique)
+			*/
+			void heuristic_starts(int n) { nHeurStarts_ = n; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief packs an incumbent (size @s, found in task @t) in a 64-bit key
+			*		 larger keys are better (larger size, then earlier task)
+			*/
+			static uint64_t pack(int s, int t) {
+				return (static_cast<uint64_t>(s) << 32) | (0xFFFFFFFFu - static_cast<uint32_t>(t));
+			}
+
+			/*
+			* @brief minimum size of a clique found in task @t which improves the incumbent
+			*		 (a tie improves the incumbent if it was found in a task after @t)
+			*/
+			int need(int t) const {
+				uint64_t key = best_.load(std::memory_order_relaxed);
+				int s = static_cast<int>(key >> 32);
+				uint32_t owner = 0xFFFFFFFFu - static_cast<uint32_t>(key & 0xFFFFFFFFu);
+				return (owner > static_cast<uint32_t>(t)) ? s : s + 1;
+			}
+
+			/*
+			* @brief greedy sequential coloring of the candidate set @P. Only vertices with color >= @kmin
+			*		 are stored in @L (colors in @C), in non-decreasing color order
+			* @returns number of vertices in @L
+			*/
+			int color(const _bbt& P, int kmin, vint& L, vint& C, Arena& a) const;
+
+			/*
+			* @brief worker thread main loop - pulls root tasks until exhausted
+			*/
+			void worker();
+
+			/*
+			* @brief search of the subtree rooted at the @t-th root branch
+			*/
+			void run_task(int t, Arena& a);
+
+			/*
+			* @brief recursive branch-and-bound of task @t at depth @depth
+			*/
+			void expand(int t, int depth, Arena& a);
+
+			/*
+			* @brief reports the clique in the arena @a (found in task @t) as candidate incumbent
+			*/
+			void report(int t, const Arena& a);
+
+			////////////////
+			// data members
+		private:
+			Graph_t& g_;										//the input graph
+			Graph_t gs_;										//the graph reordered for the search
+			Decode decode_;										//ordering of gs_ w.r.t. g_
+
+			infoClq<int> info_;
+			const int NV_;
+
+			//root tasks
+			vint lroot_;										//vertices at the root in branching order (last to first)
+			vint croot_;										//colors of vertices in lroot_
+			int nTasks_;
+			int maxDepth_;
+			int nHeurStarts_;									//starts of the initial heuristic
+
+			//shared state
+			std::atomic<uint64_t> best_;						//packed incumbent (see pack(...))
+			std::atomic<int> next_;								//next root task to pull
+			std::atomic<bool> abort_;							//TIME_OUT flag
+			std::atomic<uint64_t> nSteps_;
+			std::vector<vint> slots_;							//best clique found in each task (+1 for the initial heuristic)
+			std::mutex mtx_;									//protects slots_ and incumbent timer
+
+			bool isSetup_;
+		};
+
+	}//end namespace _impl
+
+	using _impl::CliqueParallel;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	inline
+		int CliqueParallel<Graph_t>::setup()
+	{
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(g_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(g_.number_of_edges());
+
+		//minimum width ordering, last to first
+		GraphFastRootSort<Graph_t> gfs(g_);
+		vint o2n = gfs.new_order(GraphFastRootSort<Graph_t>::MIN_DEGEN, true, true);
+
+		decode_.clear();
+		if (gfs.reorder(o2n, gs_, &decode_) == -1) {
+			LOG_ERROR("error when reordering the graph - CliqueParallel<Graph_t>::setup");
+			return -1;
+		}
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int CliqueParallel<Graph_t>::run()
+	{
+		if (!isSetup_ && setup() == -1) { return -1; }
+
+		//clears previous search results (preprocessing info is kept)
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.clearTimer(infoBase::phase_t::LAST_INCUMBENT);
+		info_.sol_.clear();
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+
+		info_.startTimer(infoBase::phase_t::SEARCH);
+		info_.startTimer(infoBase::phase_t::LAST_INCUMBENT);
+
+		//////////////////////////
+		// root coloring - one task for each vertex, in branching order
+		_bbt bbroot(NV_, true);
+		Arena a(NV_, 1);
+		lroot_.assign(NV_, EMPTY_ELEM);
+		croot_.assign(NV_, 0);
+		nTasks_ = color(bbroot, 1, lroot_, croot_, a);
+		info_.ub_ = (nTasks_ > 0) ? croot_[nTasks_ - 1] : 0;
+		maxDepth_ = info_.ub_ + 2;
+
+		//initial lower bound - ties are improved by any task
+		slots_.assign(nTasks_ + 1, vint());
+		gfunc::clq::find_clique(gs_, slots_[nTasks_], bbroot);
+		if (nHeurStarts_ > 0) {
+			CliqueHeurParallel<Graph_t> heur(gs_, info_.data_);
+			heur.number_of_starts(nHeurStarts_);
+			if (heur.run() > static_cast<int>(slots_[nTasks_].size())) {
+				slots_[nTasks_] = heur.clique();
+				info_.timeIncumbent_ = com::_time::elapsedTime(info_.startTimeIncumbent_);
+			}
+		}
+		best_.store(pack(static_cast<int>(slots_[nTasks_].size()), nTasks_));
+		next_.store(0);
+		abort_.store(false);
+		nSteps_.store(0);
+
+		//////////////////////////
+		// parallel search
+		int nThreads = com::thread_count(info_.data_.nThreads, nTasks_);
+
+		com::run_parallel(nThreads, [this](int) { worker(); });
+		//////////////////////////
+
+		//decode the incumbent to the original graph
+		uint64_t key = best_.load();
+		int owner = static_cast<int>(0xFFFFFFFFu - static_cast<uint32_t>(key & 0xFFFFFFFFu));
+		info_.lb_ = static_cast<int>(key >> 32);
+		info_.sol_ = decode_.decode(slots_[owner]);
+		std::sort(info_.sol_.begin(), info_.sol_.end());
+		info_.nSteps_ = nSteps_.load();
+		info_.isTimeOut_ = abort_.load();
+
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return info_.lb_;
+	}
+
+	template<class Graph_t>
+	inline
+		int CliqueParallel<Graph_t>::color(const _bbt& P, int kmin, vint& L, vint& C, Arena& a) const
+	{
+		int pc = static_cast<int>(P.size());
+		int col = 1, nL = 0, v = bbo::noBit;
+
+		a.U_ = P;
+		while (pc > 0) {
+
+			//new color class with the remaining uncolored vertices
+			a.Q_ = a.U_;
+			a.Q_.init_scan(bbo::DESTRUCTIVE);
+			while ((v = a.Q_.next_bit_del()) != bbo::noBit) {
+
+				a.U_.erase_bit(v);
+				a.Q_.erase_block(WDIV(v), -1, gs_.neighbors(v));
+
+				//only vertices which may improve the incumbent are stored
+				if (col >= kmin) {
+					L[nL] = v;
+					C[nL] = col;
+					++nL;
+				}
+
+				/////////////////
+				if ((--pc) == 0) { break; }
+				/////////////////
+			}
+			++col;
+		}
+
+		return nL;
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueParallel<Graph_t>::worker()
+	{
+		Arena a(NV_, maxDepth_);
+
+		int t = 0;
+		while (!abort_.load(std::memory_order_relaxed)) {
+
+			/////////////////////////////////////////////////////////
+			if ((t = next_.fetch_add(1, std::memory_order_relaxed)) >= nTasks_) { break; }
+			/////////////////////////////////////////////////////////
+
+			run_task(t, a);
+		}
+
+		nSteps_.fetch_add(a.nSteps_, std::memory_order_relaxed);
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueParallel<Graph_t>::run_task(int t, Arena& a)
+	{
+		//task t branches on the t-th vertex from the end of the root list
+		int pos = nTasks_ - 1 - t;
+		int v = lroot_[pos];
+
+		/////////////////////////////////////////
+		if (1 + croot_[pos] < need(t)) { return; }
+		/////////////////////////////////////////
+
+		//candidate set: neighbors of v which precede v in the root list
+		_bbt& P = a.P_[1];
+		P = gs_.neighbors(v);
+		for (auto i = pos; i < nTasks_; ++i) {
+			P.erase_bit(lroot_[i]);
+		}
+
+		a.clq_.clear();
+		a.clq_.push_back(v);
+		if (P.is_empty()) {
+			report(t, a);
+		}
+		else {
+			expand(t, 1, a);
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueParallel<Graph_t>::expand(int t, int depth, Arena& a)
+	{
+		++a.nSteps_;
+
+		//time-out check
+		if ((a.nSteps_ & CHECK_TIME_MASK) == 0 &&
+			com::_time::elapsedTime(info_.startTimeSearch_) >= info_.data_.TIME_OUT) {
+			abort_.store(true, std::memory_order_relaxed);
+		}
+		if (abort_.load(std::memory_order_relaxed)) { return; }
+
+		_bbt& P = a.P_[depth];
+		vint& L = a.L_[depth];
+		vint& C = a.C_[depth];
+		int nL = color(P, need(t) - static_cast<int>(a.clq_.size()), L, C, a);
+
+		//branch on vertices in reverse coloring order
+		for (auto k = nL - 1; k >= 0; --k) {
+
+			////////////////////////////////////////////////////////////////
+			if (static_cast<int>(a.clq_.size()) + C[k] < need(t)) { return; }
+			////////////////////////////////////////////////////////////////
+
+			int v = L[k];
+			_bbt& Pnext = a.P_[depth + 1];
+			AND(P, gs_.neighbors(v), Pnext);
+
+			a.clq_.push_back(v);
+			if (Pnext.is_empty()) {
+				report(t, a);
+			}
+			else {
+				expand(t, depth + 1, a);
+			}
+			a.clq_.pop_back();
+
+			if (abort_.load(std::memory_order_relaxed)) { return; }
+			P.erase_bit(v);
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void CliqueParallel<Graph_t>::report(int t, const Arena& a)
+	{
+		uint64_t key = pack(static_cast<int>(a.clq_.size()), t);
+		uint64_t cur = best_.load();
+
+		while (key > cur) {
+			if (best_.compare_exchange_weak(cur, key)) {
+
+				//new incumbent
+				std::lock_guard<std::mutex> lck(mtx_);
+				slots_[t] = a.clq_;
+				double tinc = com::_time::elapsedTime(info_.startTimeIncumbent_);
+				info_.timeIncumbent_ = std::max(info_.timeIncumbent_, tinc);
+				return;
+			}
+		}
+	}
+
+}//end namespace bitgraph
+
+#endif
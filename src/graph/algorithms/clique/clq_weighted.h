@@ -0,0 +1,365 @@
+/**
+* @file clq_weighted.h
+* @brief header for class CliqueWeighted, an exact maximum weight clique algorithm
+*		 for vertex-weighted undirected graphs Graph_W<ugraph, W> (W = int or double)
+* @details: bit-parallel branch-and-bound with weighted (partition-based) coloring bounds.
+*			The candidate set is partitioned greedily into independent sets; the bound of a color
+*			class is the sum of the maximum weights of the classes up to and including it,
+*			and the bound of a vertex v in class k is the bound of class k-1 plus w(v).
+* @details: weights are copied into a contiguous std::vector<W> of the reordered graph, so that
+*			there is no virtual dispatch in the search
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CLIQUE_WEIGHTED_H__
+#define __CLIQUE_WEIGHTED_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/simple_graph_w.h"
+#include "graph/algorithms/graph_fast_sort_weighted.h"
+#include "graph/algorithms/decode.h"
+#include "graph/algorithms/graph_func.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_info.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include <vector>
+#include <algorithm>
+#include <type_traits>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class CliqueWeighted
+		// (exact maximum weight clique)
+		//
+		////////////////////////////
+
+		template<class GraphW_t>
+		class CliqueWeighted {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, typename GraphW_t::_gt>::value,
+				"CliqueWeighted<GraphW_t> requires GraphW_t = Graph_W<Ugraph<BBScan>, W>");
+
+		public:
+			using type = CliqueWeighted<GraphW_t>;
+			using basic_type = GraphW_t;									//weighted graph type
+			using ugtype = typename GraphW_t::_gt;							//non-weighted graph type
+			using wtype = typename GraphW_t::_wt;							//weight type
+			using _bbt = typename ugtype::_bbt;
+			using sort_type = GraphFastRootSort_W<GraphW_t>;
+
+			static_assert(std::is_arithmetic<wtype>::value, "CliqueWeighted<GraphW_t> requires arithmetic weights");
+
+			enum { CHECK_TIME_MASK = 0x3FF };								//time-out is checked every 1024 steps
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Preprocessing: the graph is reordered by weight
+			* @param alg sorting algorithm (sort_type::MAX_WEIGHT or sort_type::MIN_WEIGHT)
+			* @param ltf last to first if TRUE
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup(int alg = sort_type::MAX_WEIGHT, bool ltf = false);
+
+			/*
+			* @brief Runs the search (setup() with default values is called if required)
+			* @returns weight of the maximum weight clique found (the optimum if not TIME_OUT),
+			*		   -1 if error
+			*/
+			wtype run();
+
+			////////////////////////
+			//construction / destruction
+
+			explicit CliqueWeighted(GraphW_t& gw, const com::paramBase& p = com::paramBase()) :
+				gw_(gw), info_(p), NV_(gw.number_of_vertices()), isSetup_(false)
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			CliqueWeighted(const CliqueWeighted&) = delete;
+			CliqueWeighted& operator=	(const CliqueWeighted&) = delete;
+			CliqueWeighted(CliqueWeighted&&) = delete;
+			CliqueWeighted& operator=	(CliqueWeighted&&) = delete;
+
+			~CliqueWeighted() = default;
+
+			//////////
+			// setters / getters
+
+			const infoClq<wtype>& info()		const { return info_; }
+			infoClq<wtype>& info() { return info_; }
+			const vint& clique()				const { return info_.sol_; }
+			void time_out(double t) { info_.data_.TIME_OUT = t; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief weighted coloring of the candidate set @P. Only color classes whose bound
+			*		 exceeds @wmin are stored in @L, together with the class bound in @Ucls
+			*		 and the vertex bound in @Uv
+			* @returns number of vertices in @L
+			*/
+			int color(const _bbt& P, wtype wmin, int depth);
+
+			/*
+			* @brief recursive branch-and-bound at depth @depth
+			*/
+			void expand(int depth);
+
+			/*
+			* @brief updates the incumbent with the current clique
+			*/
+			void report();
+
+			////////////////
+			// data members
+		private:
+			GraphW_t& gw_;													//the input graph
+			GraphW_t gs_;													//the graph reordered for the search
+			Decode decode_;													//ordering of gs_ w.r.t. gw_
+			std::vector<wtype> w_;											//weights of gs_ (contiguous, no dispatch)
+
+			infoClq<wtype> info_;
+			const int NV_;
+
+			//working memory - one entry per depth
+			std::vector<_bbt> P_;
+			std::vector<vint> L_;
+			std::vector<std::vector<wtype>> Ucls_;
+			std::vector<std::vector<wtype>> Uv_;
+			_bbt U_, Q_;													//coloring
+			vint iset_;														//coloring - current class
+
+			vint clq_;														//current clique
+			wtype wclq_;													//weight of the current clique
+			vint best_;														//incumbent (vertices of gs_)
+			bool abort_;
+
+			bool isSetup_;
+		};
+
+	}//end namespace _impl
+
+	using _impl::CliqueWeighted;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class GraphW_t>
+	inline
+		int CliqueWeighted<GraphW_t>::setup(int alg, bool ltf)
+	{
+		if (alg != sort_type::MAX_WEIGHT && alg != sort_type::MIN_WEIGHT) {
+			LOGG_ERROR("unknown sorting algorithm: ", alg, " - CliqueWeighted<GraphW_t>::setup");
+			return -1;
+		}
+
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(gw_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(gw_.number_of_edges());
+
+		//initial ordering by weight
+		sort_type gfs(gw_);
+		vint o2n = gfs.new_order(alg, ltf, true);
+
+		decode_.clear();
+		if (gfs.reorder(o2n, gs_, &decode_) == -1) {
+			LOG_ERROR("error when reordering the graph - CliqueWeighted<GraphW_t>::setup");
+			return -1;
+		}
+		w_ = gs_.weight();
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class GraphW_t>
+	inline
+		typename CliqueWeighted<GraphW_t>::wtype CliqueWeighted<GraphW_t>::run()
+	{
+		if (!isSetup_ && setup() == -1) { return -1; }
+
+		//clears previous search results (preprocessing info is kept)
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.clearTimer(infoBase::phase_t::LAST_INCUMBENT);
+		info_.sol_.clear();
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+
+		info_.startTimer(infoBase::phase_t::SEARCH);
+		info_.startTimer(infoBase::phase_t::LAST_INCUMBENT);
+
+		if (NV_ == 0) {
+			info_.readTimer(infoBase::phase_t::SEARCH);
+			return 0;
+		}
+
+		//working memory - the depth of the search is bounded by the size of a coloring of G
+		_bbt bbroot(NV_, true);
+		const int maxDepth = gfunc::clq::SEQ(gs_.graph(), bbroot) + 2;
+		P_.assign(maxDepth, _bbt(NV_));
+		L_.assign(maxDepth, vint(NV_));
+		Ucls_.assign(maxDepth, std::vector<wtype>(NV_));
+		Uv_.assign(maxDepth, std::vector<wtype>(NV_));
+		U_.reset(NV_);
+		Q_.reset(NV_);
+		iset_.assign(NV_, EMPTY_ELEM);
+		clq_.clear();
+		clq_.reserve(NV_);
+		wclq_ = 0;
+		abort_ = false;
+
+		//initial solution - greedy clique in the initial ordering
+		P_[0] = bbroot;
+		gfunc::clq::find_clique(gs_.graph(), best_, bbroot);
+		info_.lb_ = gfunc::vertexW::wsum(gs_, best_);
+
+		//root bound
+		int nL = color(P_[0], 0, 0);
+		info_.ub_ = (nL > 0) ? Ucls_[0][nL - 1] : 0;
+
+		//////////////////////////
+		expand(0);
+		//////////////////////////
+
+		//decode the incumbent to the original graph
+		info_.sol_ = decode_.decode(best_);
+		std::sort(info_.sol_.begin(), info_.sol_.end());
+		info_.isTimeOut_ = abort_;
+
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return info_.lb_;
+	}
+
+	template<class GraphW_t>
+	inline
+		int CliqueWeighted<GraphW_t>::color(const _bbt& P, wtype wmin, int depth)
+	{
+		vint& L = L_[depth];
+		std::vector<wtype>& Ucls = Ucls_[depth];
+		std::vector<wtype>& Uv = Uv_[depth];
+		const auto& g = gs_.graph();
+
+		int pc = static_cast<int>(P.size());
+		int nL = 0, v = bbo::noBit;
+		wtype ub = 0;
+
+		U_ = P;
+		while (pc > 0) {
+
+			//new color class (independent set) with the remaining vertices
+			int nI = 0;
+			wtype wmax = 0;
+			Q_ = U_;
+			Q_.init_scan(bbo::DESTRUCTIVE);
+			while ((v = Q_.next_bit_del()) != bbo::noBit) {
+				U_.erase_bit(v);
+				Q_.erase_block(WDIV(v), -1, g.neighbors(v));
+				iset_[nI++] = v;
+				wmax = std::max(wmax, w_[v]);
+
+				/////////////////
+				if ((--pc) == 0) { break; }
+				/////////////////
+			}
+
+			//only classes which may improve the incumbent are stored
+			if (ub + wmax > wmin) {
+				for (auto i = 0; i < nI; ++i) {
+					L[nL] = iset_[i];
+					Ucls[nL] = ub + wmax;
+					Uv[nL] = ub + w_[iset_[i]];
+					++nL;
+				}
+			}
+			ub += wmax;
+		}
+
+		return nL;
+	}
+
+	template<class GraphW_t>
+	inline
+		void CliqueWeighted<GraphW_t>::expand(int depth)
+	{
+		++info_.nSteps_;
+
+		//time-out check
+		if ((info_.nSteps_ & CHECK_TIME_MASK) == 0 &&
+			com::_time::elapsedTime(info_.startTimeSearch_) >= info_.data_.TIME_OUT) {
+			abort_ = true;
+		}
+		if (abort_) { return; }
+
+		_bbt& P = P_[depth];
+		vint& L = L_[depth];
+		std::vector<wtype>& Ucls = Ucls_[depth];
+		std::vector<wtype>& Uv = Uv_[depth];
+		int nL = color(P, info_.lb_ - wclq_, depth);
+
+		//branch on vertices in reverse coloring order
+		for (auto k = nL - 1; k >= 0; --k) {
+
+			///////////////////////////////////////////////
+			if (wclq_ + Ucls[k] <= info_.lb_) { return; }
+			///////////////////////////////////////////////
+
+			int v = L[k];
+
+			//vertex bound - v cannot improve the incumbent
+			if (wclq_ + Uv[k] <= info_.lb_) {
+				P.erase_bit(v);
+				continue;
+			}
+
+			_bbt& Pnext = P_[depth + 1];
+			AND(P, gs_.neighbors(v), Pnext);
+
+			wtype wprev = wclq_;
+			clq_.push_back(v);
+			wclq_ += w_[v];
+			if (Pnext.is_empty()) {
+				report();
+			}
+			else {
+				expand(depth + 1);
+			}
+			wclq_ = wprev;
+			clq_.pop_back();
+
+			if (abort_) { return; }
+			P.erase_bit(v);
+		}
+	}
+
+	template<class GraphW_t>
+	inline
+		void CliqueWeighted<GraphW_t>::report()
+	{
+		if (wclq_ > info_.lb_) {
+			info_.lb_ = wclq_;
+			best_ = clq_;
+			info_.readTimer(infoBase::phase_t::LAST_INCUMBENT);
+		}
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,374 @@
+/**
+* @file col_dsatur.h
+* @brief header for class ColorDSATUR, an exact bit-parallel vertex coloring algorithm
+*		 (DSATUR-based branch and bound [Brélaz 1979, San Segundo 2012])
+* @details: the search always branches on the uncolored vertex of maximum saturation degree (ties by degree),
+*			trying every feasible color in use and, if it may still improve the incumbent, a new color.
+* @details: for each color c, A[c] is the union of the neighborhoods of the vertices in color class c.
+*			Assigning v to c is A[c] |= N(v), and the vertices whose saturation increases are exactly
+*			(N(v) & ~A[c]) & U, with U the set of uncolored vertices - both computed in the same block loop.
+*			A[c] is saved per depth to undo the assignment.
+* @details: lower bound is the size of a clique found by KCore::find_heur_clique, whose vertices are precolored
+*			with different colors (symmetry breaking). Upper bound is the best of the DSATUR and RLF heuristics.
+* @details: a node is pruned when the number of colors in use reaches the incumbent, or when an uncolored vertex
+*			sees every color in use and a new color cannot improve the incumbent.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __COLOR_DSATUR_H__
+#define __COLOR_DSATUR_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/coloring/col_info.h"
+#include "graph/algorithms/coloring/col_func.h"
+#include "bitscan/bitblock.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include <vector>
+#include <algorithm>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////////////
+		//
+		// class ColorDSATUR
+		// (exact vertex coloring)
+		//
+		////////////////////////////
+
+		template<class Graph_t>
+		class ColorDSATUR {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value,
+				"ColorDSATUR<Graph_t> requires Graph_t = Ugraph<BBScan>");
+
+		public:
+			using type = ColorDSATUR<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum { CHECK_TIME_MASK = 0x3FF };					//time-out is checked every 1024 steps
+
+			////////////////
+			// public interface
+		public:
+
+			/*
+			* @brief Computes the initial bounds - clique lower bound and heuristic upper bound
+			*		 (called by run if required)
+			* @returns 0 if successful, -1 otherwise
+			*/
+			int setup();
+
+			/*
+			* @brief Exact coloring. If TIME_OUT is reached the incumbent coloring is returned.
+			* @returns number of colors of the best coloring found (chromatic number if not time-out), -1 if error
+			*/
+			int run();
+
+			////////////////////////
+			//construction / destruction
+
+			explicit ColorDSATUR(Graph_t& g, const com::paramBase& p = com::paramBase()) :
+				g_(g), info_(p), NV_(g.number_of_vertices()), NBB_(g.number_of_blocks()),
+				k_(0), isSetup_(false)
+			{}
+
+			//move and copy semantics - copy and move semantics forbidden
+			ColorDSATUR(const ColorDSATUR&) = delete;
+			ColorDSATUR& operator=	(const ColorDSATUR&) = delete;
+			ColorDSATUR(ColorDSATUR&&) = delete;
+			ColorDSATUR& operator=	(ColorDSATUR&&) = delete;
+
+			~ColorDSATUR() = default;
+
+			//////////
+			// setters / getters
+
+			const infoCol& info()					const { return info_; }
+			const vint& coloring()					const { return info_.sol_; }
+			void time_out(double t) { info_.data_.TIME_OUT = t; }
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief recursive DSATUR branch and bound at depth @depth
+			*/
+			void expand(int depth);
+
+			/*
+			* @brief uncolored vertex of maximum saturation (ties by degree), EMPTY_ELEM if all are colored
+			* @param maxSat: output saturation of the vertex
+			*/
+			int select_vertex(int& maxSat) const;
+
+			/*
+			* @brief assigns color @c to vertex @v, saving A[c] at @depth
+			*/
+			void assign(int v, int c, int depth);
+
+			/*
+			* @brief undoes assign(v, c, depth)
+			*/
+			void unassign(int v, int c, int depth);
+
+			/*
+			* @brief records the current (complete) coloring as incumbent
+			*/
+			void new_incumbent();
+
+			////////////////
+			// data members
+		private:
+			Graph_t& g_;
+			infoCol info_;
+			const int NV_;
+			const int NBB_;
+
+			vint clq_;											//clique of the lower bound (precolored)
+			vint deg_;											//degree of each vertex (tie-breaking)
+			vint col_;											//current partial coloring
+			vint sat_;											//saturation degree of each vertex
+			_bbt U_;											//uncolored vertices
+			std::vector<_bbt> A_;								//A_[c]: vertices adjacent to color class c
+			std::vector<_bbt> oldA_;							//A_[c] saved at each depth
+			int k_;												//number of colors in use
+
+			bool abort_ = false;
+			bool isSetup_;
+		};
+
+	}//end namespace _impl
+
+	using _impl::ColorDSATUR;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	inline
+		int ColorDSATUR<Graph_t>::setup()
+	{
+		info_.startTimer(infoBase::phase_t::PREPROC);
+
+		info_.name(g_.name());
+		info_.number_of_vertices(NV_);
+		info_.number_of_edges(g_.number_of_edges());
+
+		clq_.clear();
+		info_.lb_ = 0;
+		info_.ub_ = 0;
+		info_.sol_.clear();
+
+		if (NV_ > 0) {
+
+			//lower bound - clique from the degeneracy ordering
+			KCore<Graph_t> kc(g_);
+			if (kc.find_kcore() == -1) {
+				LOG_ERROR("error when computing the degeneracy ordering - ColorDSATUR<Graph_t>::setup");
+				return -1;
+			}
+			clq_ = kc.find_heur_clique();
+			info_.lb_ = static_cast<int>(clq_.size());
+
+			//upper bound - best heuristic coloring
+			vint col;
+			info_.ub_ = gfunc::col::dsatur(g_, info_.sol_);
+			if (gfunc::col::rlf(g_, col) < info_.ub_) {
+				info_.ub_ = *std::max_element(col.begin(), col.end()) + 1;
+				info_.sol_ = std::move(col);
+			}
+		}
+
+		deg_.assign(NV_, 0);
+		for (auto v = 0; v < NV_; ++v) {
+			deg_[v] = g_.degree(v);
+		}
+
+		info_.readTimer(infoBase::phase_t::PREPROC);
+		isSetup_ = true;
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int ColorDSATUR<Graph_t>::run()
+	{
+		if (!isSetup_ && setup() == -1) { return -1; }
+
+		info_.clearTimer(infoBase::phase_t::SEARCH);
+		info_.clearTimer(infoBase::phase_t::LAST_INCUMBENT);
+		info_.nSteps_ = 0;
+		info_.isTimeOut_ = false;
+		abort_ = false;
+		info_.startTimer(infoBase::phase_t::SEARCH);
+		info_.startTimer(infoBase::phase_t::LAST_INCUMBENT);
+
+		if (info_.ub_ > info_.lb_) {
+
+			//allocation - new colors are only opened below the incumbent
+			col_.assign(NV_, EMPTY_ELEM);
+			sat_.assign(NV_, 0);
+			U_.reset(NV_);
+			U_.set_bit(0, NV_ - 1);
+			A_.assign(info_.ub_, _bbt(NV_));
+			oldA_.assign(NV_ + 1, _bbt(NV_));
+			k_ = 0;
+
+			//precolored clique - symmetry breaking
+			int depth = 0;
+			for (auto v : clq_) {
+				assign(v, k_++, depth++);
+			}
+
+			///////////////
+			expand(depth);
+			///////////////
+		}
+
+		info_.readTimer(infoBase::phase_t::SEARCH);
+		return info_.ub_;
+	}
+
+	template<class Graph_t>
+	inline
+		void ColorDSATUR<Graph_t>::expand(int depth)
+	{
+		++info_.nSteps_;
+
+		//time-out check
+		if ((info_.nSteps_ & CHECK_TIME_MASK) == 0 &&
+			com::_time::elapsedTime(info_.startTimeSearch_) >= info_.data_.TIME_OUT) {
+			info_.isTimeOut_ = true;
+			abort_ = true;
+		}
+		if (abort_) { return; }
+
+		//bound - every extension uses at least k_ colors
+		if (k_ >= info_.ub_) { return; }
+
+		int maxSat = 0;
+		int v = select_vertex(maxSat);
+		if (v == EMPTY_ELEM) {
+			new_incumbent();
+			return;
+		}
+
+		//bound - v sees every color in use and a new color cannot improve
+		if (maxSat == k_ && k_ + 1 >= info_.ub_) { return; }
+
+		//colors in use
+		for (auto c = 0; c < k_; ++c) {
+			if (A_[c].is_bit(v)) { continue; }
+
+			assign(v, c, depth);
+			expand(depth + 1);
+			unassign(v, c, depth);
+
+			/////////////////////////////////////
+			if (abort_ || k_ >= info_.ub_) { return; }
+			/////////////////////////////////////
+		}
+
+		//new color
+		if (k_ + 1 < info_.ub_) {
+			int c = k_++;
+			assign(v, c, depth);
+			expand(depth + 1);
+			unassign(v, c, depth);
+			--k_;
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int ColorDSATUR<Graph_t>::select_vertex(int& maxSat) const
+	{
+		int best = EMPTY_ELEM;
+		maxSat = -1;
+		for (auto nBB = 0; nBB < NBB_; ++nBB) {
+			BITBOARD bb = U_.block(nBB);
+			while (bb) {
+				int v = WMUL(nBB) + bblock::lsb64_intrinsic(bb);
+				bb &= bb - 1;
+				if (sat_[v] > maxSat || (sat_[v] == maxSat && deg_[v] > deg_[best])) {
+					maxSat = sat_[v];
+					best = v;
+				}
+			}
+		}
+		return best;
+	}
+
+	template<class Graph_t>
+	inline
+		void ColorDSATUR<Graph_t>::assign(int v, int c, int depth)
+	{
+		col_[v] = c;
+		U_.erase_bit(v);
+
+		//A[c] |= N(v) - uncolored vertices new to A[c] increase their saturation
+		_bbt& Ac = A_[c];
+		_bbt& old = oldA_[depth];
+		const _bbt& nv = g_.neighbors(v);
+		for (auto nBB = 0; nBB < NBB_; ++nBB) {
+			old.block(nBB) = Ac.block(nBB);
+			BITBOARD bb = nv.block(nBB) & ~Ac.block(nBB) & U_.block(nBB);
+			Ac.block(nBB) |= nv.block(nBB);
+			while (bb) {
+				++sat_[WMUL(nBB) + bblock::lsb64_intrinsic(bb)];
+				bb &= bb - 1;
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void ColorDSATUR<Graph_t>::unassign(int v, int c, int depth)
+	{
+		_bbt& Ac = A_[c];
+		const _bbt& old = oldA_[depth];
+		for (auto nBB = 0; nBB < NBB_; ++nBB) {
+			BITBOARD bb = Ac.block(nBB) & ~old.block(nBB) & U_.block(nBB);
+			Ac.block(nBB) = old.block(nBB);
+			while (bb) {
+				--sat_[WMUL(nBB) + bblock::lsb64_intrinsic(bb)];
+				bb &= bb - 1;
+			}
+		}
+
+		U_.set_bit(v);
+		col_[v] = EMPTY_ELEM;
+	}
+
+	template<class Graph_t>
+	inline
+		void ColorDSATUR<Graph_t>::new_incumbent()
+	{
+		info_.ub_ = k_;
+		info_.sol_ = col_;
+		info_.readTimer(infoBase::phase_t::LAST_INCUMBENT);
+
+		LOGG_DEBUG("new coloring - k: ", k_, " - ColorDSATUR<Graph_t>::new_incumbent");
+
+		//optimum - matches the clique bound
+		if (info_.ub_ <= info_.lb_) { abort_ = true; }
+	}
+
+}//end namespace bitgraph
+
+#endif
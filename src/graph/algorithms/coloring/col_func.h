@@ -0,0 +1,289 @@
+/**
+* @file col_func.h
+* @brief header for greedy vertex coloring heuristics (DSATUR, RLF) and coloring utilities
+* @details: colorings are vectors with the color (0-based) of each vertex
+* @details: the heuristics only scan neighborhoods (init_scan / next_bit), so they apply to
+*			dense (Ugraph<BBScan>) and sparse (Ugraph<BBScanSp>) graphs alike. Working sets
+*			(color classes, saturation buckets, candidates) are dense bitsets over the vertices.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __COLOR_FUNC_H__
+#define __COLOR_FUNC_H__
+
+#include "bitscan/bitscan.h"
+#include "graph/simple_ugraph.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include <vector>
+#include <numeric>
+#include <algorithm>
+
+namespace bitgraph {
+
+	namespace gfunc {
+
+		namespace col {
+
+			/**
+			* @brief Applies @f(u) to every neighbor u of @v in @g
+			* @details: non-destructive scan - valid for dense and sparse bitsets
+			**/
+			template<class Graph_t, class Func>
+			inline
+				void for_each_neighbor(Graph_t& g, int v, Func f) {
+
+				auto& nv = g.neighbors(v);
+				if (nv.is_empty() || nv.init_scan(bbo::NON_DESTRUCTIVE) == -1) { return; }
+
+				int u = bbo::noBit;
+				while ((u = nv.next_bit()) != bbo::noBit) {
+					f(u);
+				}
+			}
+
+			/**
+			* @brief Applies @f(u) to every neighbor u of @v in @g which belongs to @bb
+			* @details: generic version - scans N(v) and filters by @bb
+			**/
+			template<class Graph_t, class Func>
+			inline
+				void for_each_neighbor(Graph_t& g, int v, const bitarray& bb, Func f) {
+
+				for_each_neighbor(g, v, [&](int u) { if (bb.is_bit(u)) { f(u); } });
+			}
+
+			/**
+			* @brief Applies @f(u) to every neighbor u of @v in @g which belongs to @bb
+			* @details: dense graphs - scans N(v) & @bb block by block
+			**/
+			template<class Func>
+			inline
+				void for_each_neighbor(Ugraph<bitarray>& g, int v, const bitarray& bb, Func f) {
+
+				const auto& nv = g.neighbors(v);
+				for (auto nBB = 0; nBB < nv.number_of_blocks(); ++nBB) {
+					BITBOARD b = nv.block(nBB) & bb.block(nBB);
+					while (b) {
+						f(WMUL(nBB) + bblock::lsb64_intrinsic(b));
+						b &= b - 1;
+					}
+				}
+			}
+
+			/**
+			* @brief Element of the bitset @bb which maximizes @key (lowest index on ties)
+			* @returns the element or EMPTY_ELEM if @bb is empty
+			**/
+			template<class Key>
+			inline
+				int argmax(const bitarray& bb, Key key) {
+
+				int best = EMPTY_ELEM;
+				long long bestKey = 0;
+				for (auto nBB = 0; nBB < bb.number_of_blocks(); ++nBB) {
+					BITBOARD b = bb.block(nBB);
+					while (b) {
+						int v = WMUL(nBB) + bblock::lsb64_intrinsic(b);
+						b &= b - 1;
+						long long kv = key(v);
+						if (best == EMPTY_ELEM || kv > bestKey) { best = v; bestKey = kv; }
+					}
+				}
+				return best;
+			}
+
+			/**
+			* @brief Determines if @col is a proper coloring of @g
+			* @param g: input graph
+			* @param col: color of each vertex (0-based)
+			* @returns TRUE if every vertex is colored and no edge joins two vertices of the same color
+			**/
+			template<class Graph_t>
+			inline
+				bool is_coloring(Graph_t& g, const std::vector<int>& col) {
+
+				const int NV = g.number_of_vertices();
+				if (static_cast<int>(col.size()) != NV) { return false; }
+
+				for (auto v = 0; v < NV; ++v) {
+					if (col[v] < 0) { return false; }
+
+					bool ok = true;
+					for_each_neighbor(g, v, [&](int u) { ok = ok && (col[u] != col[v]); });
+					if (!ok) { return false; }
+				}
+
+				return true;
+			}
+
+			/**
+			* @brief Color classes of the coloring @col
+			* @returns vector of bitsets (population size |@col|), one per color
+			**/
+			inline
+				std::vector<bitarray> color_classes(const std::vector<int>& col) {
+
+				const int NV = static_cast<int>(col.size());
+				int k = 0;
+				for (auto c : col) { k = std::max(k, c + 1); }
+
+				std::vector<bitarray> res(k, bitarray(std::max(NV, 1)));
+				for (auto v = 0; v < NV; ++v) {
+					if (col[v] >= 0) { res[col[v]].set_bit(v); }
+				}
+				return res;
+			}
+
+			/**
+			* @brief DSATUR greedy coloring [Brélaz 1979]. At each step the uncolored vertex with maximum
+			*		 saturation degree (number of different colors in its neighborhood) is assigned the smallest
+			*		 feasible color. Ties are broken by maximum degree, then by minimum index.
+			* @param g: input graph
+			* @param col: output coloring
+			* @returns number of colors
+			* @details: forb[c] is the set of vertices adjacent to color class c (union of neighborhoods),
+			*			vertices are kept in saturation buckets (bitsets) over the positions of a
+			*			non-increasing degree ordering, so the lsb of the highest non-empty bucket is the next vertex.
+			**/
+			template<class Graph_t>
+			inline
+				int dsatur(Graph_t& g, std::vector<int>& col) {
+
+				const int NV = g.number_of_vertices();
+				col.assign(NV, EMPTY_ELEM);
+				if (NV == 0) { return 0; }
+
+				//positions by non-increasing degree
+				vint ord(NV), pos(NV), deg(NV);
+				std::iota(ord.begin(), ord.end(), 0);
+				for (auto v = 0; v < NV; ++v) { deg[v] = g.degree(v); }
+				std::stable_sort(ord.begin(), ord.end(), [&deg](int a, int b) { return deg[a] > deg[b]; });
+				for (auto p = 0; p < NV; ++p) { pos[ord[p]] = p; }
+
+				vint sat(NV, 0);
+				std::vector<bitarray> forb;						//forb[c]: vertices adjacent to color class c
+				std::vector<bitarray> bucket;					//bucket[s]: positions of uncolored vertices with saturation s
+				vint bsize;										//bsize[s]: population of bucket[s]
+				bucket.emplace_back(NV);
+				bucket[0].set_bit(0, NV - 1);
+				bsize.push_back(NV);
+
+				int maxSat = 0, k = 0;
+				for (auto n = 0; n < NV; ++n) {
+
+					//vertex of maximum saturation (max degree)
+					while (bsize[maxSat] == 0) { --maxSat; }
+					int p = bucket[maxSat].lsb();
+					int v = ord[p];
+					bucket[maxSat].erase_bit(p);
+					--bsize[maxSat];
+
+					//smallest feasible color
+					int c = 0;
+					while (c < k && forb[c].is_bit(v)) { ++c; }
+					if (c == k) {
+						forb.emplace_back(NV);
+						++k;
+					}
+					col[v] = c;
+
+					//forb[c] |= N(v) - uncolored neighbors not yet adjacent to c increase their saturation
+					bitarray& fc = forb[c];
+					for_each_neighbor(g, v, [&](int u) {
+						if (fc.is_bit(u)) { return; }
+						fc.set_bit(u);
+						if (col[u] != EMPTY_ELEM) { return; }
+
+						int s = sat[u]++;
+						bucket[s].erase_bit(pos[u]);
+						--bsize[s];
+						if (s + 1 == static_cast<int>(bucket.size())) {
+							bucket.emplace_back(NV);
+							bsize.push_back(0);
+						}
+						bucket[s + 1].set_bit(pos[u]);
+						++bsize[s + 1];
+						maxSat = std::max(maxSat, s + 1);
+					});
+				}
+
+				return k;
+			}
+
+			/**
+			* @brief RLF (Recursive Largest First) greedy coloring [Leighton 1979]. Color classes are
+			*		 built one at a time: the first vertex has maximum degree in the uncolored subgraph,
+			*		 the following ones maximize the number of neighbors which can no longer join the class
+			*		 (ties: minimum number of neighbors which still can)
+			* @param g: input graph
+			* @param col: output coloring
+			* @returns number of colors
+			* @details: U (uncolored), W (candidates for the current class) and Y (uncolored vertices adjacent to the
+			*			current class) are bitsets, |N(w) & Y| and |N(w) & U| are maintained incrementally
+			**/
+			template<class Graph_t>
+			inline
+				int rlf(Graph_t& g, std::vector<int>& col) {
+
+				const int NV = g.number_of_vertices();
+				col.assign(NV, EMPTY_ELEM);
+				if (NV == 0) { return 0; }
+
+				bitarray U(NV), W(NV), Y(NV);
+				U.set_bit(0, NV - 1);
+				vint degU(NV), cntY(NV, 0);
+				for (auto v = 0; v < NV; ++v) { degU[v] = g.degree(v); }
+
+				int k = 0, nLeft = NV;
+				while (nLeft > 0) {
+
+					//new class - all uncolored vertices are candidates
+					W = U;
+					Y.erase_bit();
+					for (auto nBB = 0; nBB < U.number_of_blocks(); ++nBB) {
+						BITBOARD bb = U.block(nBB);
+						while (bb) {
+							cntY[WMUL(nBB) + bblock::lsb64_intrinsic(bb)] = 0;
+							bb &= bb - 1;
+						}
+					}
+
+					int v = argmax(W, [&degU](int w) { return static_cast<long long>(degU[w]); });
+					while (v != EMPTY_ELEM) {
+
+						col[v] = k;
+						U.erase_bit(v);
+						W.erase_bit(v);
+						--nLeft;
+
+						//candidates adjacent to v move to Y
+						for_each_neighbor(g, v, U, [&](int u) {
+							--degU[u];
+							if (!W.is_bit(u)) { return; }
+
+							W.erase_bit(u);
+							Y.set_bit(u);
+							for_each_neighbor(g, u, W, [&cntY](int w) { ++cntY[w]; });
+						});
+
+						//max |N(w) & Y|, then min |N(w) & W| = degU[w] - cntY[w]
+						v = argmax(W, [&](int w) {
+							return (static_cast<long long>(cntY[w]) << 32) - (degU[w] - cntY[w]);
+						});
+					}
+
+					++k;
+				}
+
+				return k;
+			}
+
+		}//end namespace col
+
+	}//end namespace gfunc
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,86 @@
+/**
+* @file col_info.h
+* @brief header for struct infoCol which reports results of exact and heuristic vertex coloring algorithms
+* @details: extends com::infoBase with bounds, coloring and search-tree information
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __COLOR_INFO_H__
+#define __COLOR_INFO_H__
+
+#include "utils/info/info_base.h"
+#include <iostream>
+#include <vector>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		//////////////////////
+		//
+		// infoCol
+		//
+		// @brief results of vertex coloring algorithms (clique lower bound, number of colors
+		//		  of the incumbent coloring, the coloring, number of steps and time-out condition)
+		//
+		///////////////////////
+
+		struct infoCol : public com::infoBase {
+
+			int lb_ = 0;										//lower bound (size of a clique)
+			int ub_ = 0;										//number of colors of the incumbent coloring
+			std::vector<int> sol_;								//incumbent coloring - color of each vertex (0-based)
+			uint64_t nSteps_ = 0;								//number of nodes of the search tree
+			bool isTimeOut_ = false;							//TRUE if the search was aborted by TIME_OUT
+
+			///////////////////////
+			//constructors / destructor
+
+			infoCol() = default;
+			explicit infoCol(const com::paramBase& p) : com::infoBase(p) {}
+
+			/////////////////////
+			// getters
+
+			int lower_bound() const noexcept { return lb_; }
+			int number_of_colors() const noexcept { return ub_; }
+			const std::vector<int>& coloring() const noexcept { return sol_; }
+			uint64_t number_of_steps() const noexcept { return nSteps_; }
+			bool is_time_out() const noexcept { return isTimeOut_; }
+
+			/*
+			* @brief TRUE if the incumbent coloring is proved optimal
+			*/
+			bool is_optimal() const noexcept { return !isTimeOut_ || lb_ == ub_; }
+
+			/*
+			* @brief resets to default values
+			* @param lazy - if true general info is NOT cleared, only timers and results
+			*/
+			void clear(bool lazy = false) override {
+				com::infoBase::clear(lazy);
+				lb_ = 0;
+				ub_ = 0;
+				sol_.clear();
+				nSteps_ = 0;
+				isTimeOut_ = false;
+			}
+
+			//I/O
+			std::ostream& printReport(std::ostream& o = std::cout, bool is_endl = true) const override {
+				com::infoBase::printReport(o, false);
+				o << lb_ << "\t" << ub_ << "\t" << nSteps_ << "\t" << isTimeOut_ << "\t";
+				if (is_endl) { o << std::endl; }
+				return o;
+			}
+		};
+
+	}//end namespace _impl
+
+	using _impl::infoCol;
+
+}//end namespace bitgraph
+
+#endif
@@ -2,18 +2,39 @@
 * @file decode.cpp
 * @brief implementation of the Decode class, which decodes orderings in graphs
 * @date 29/11/13
-* @last_update 17/12/24
+* @last_update 17/10/2026
 */
 
 #include "graph/algorithms/decode.h"
 
 using namespace bitgraph;
 
+void Decode::add_ordering(const vint& o)
+{
+	if (ords_.empty()) {
+		comp_ = o;
+	}
+	else {
+		//comp[new] = comp_prev[o[new]]
+		vint comp(o.size());
+		const auto NV = comp_.size();
+		for (std::size_t i = 0; i < o.size(); ++i) {
+			comp[i] = (static_cast<std::size_t>(o[i]) < NV) ? comp_[o[i]] : EMPTY_ELEM;
+		}
+		comp_ = std::move(comp);
+	}
+	ords_.emplace_back(o);
+}
+
 int Decode::decode(int v) const
 { 
-	DecodeVertex df(ords_);
-	return df(v); 
-};
+	if (ords_.empty()) { return v; }
+	if (static_cast<std::size_t>(v) >= comp_.size()) {
+		LOGG_ERROR("vertex out of range: ", v, " - Decode::decode");
+		return EMPTY_ELEM;
+	}
+	return comp_[v];
+}
 
 void Decode::reverse_in_place(vint& o)
 {
@@ -35,11 +56,9 @@ vint Decode::reverse(const vint& o)
 
 vint Decode::decode(const vint& l) const
 {
-	vint res;
+	vint res(l);
 	if (!l.empty()) {
-		res.resize(l.size());
-		DecodeVertex df(ords_);
-		transform(l.cbegin(), l.cend(), res.begin(), df);
+		decode_in_place(res);
 	}
 	return res;
 }
@@ -66,8 +85,102 @@ vint Decode::decode(const vint& l) const
 int Decode::decode_in_place(vint& l) const
 {
 	if (l.empty()) return -1;
-	DecodeVertex df(ords_);
-	transform(l.begin(), l.end(), l.begin(), df);
+	if (ords_.empty()) return 0;
+
+	//branch-free bounds check, errors are reported once
+	const auto NV = comp_.size();
+	bool isBad = false;
+	for (auto& v : l) {
+		const bool isIn = static_cast<std::size_t>(v) < NV;
+		isBad |= !isIn;
+		v = isIn ? comp_[v] : EMPTY_ELEM;
+	}
+	if (isBad) {
+		LOG_ERROR("vertex out of range - Decode::decode_in_place");
+		return -1;
+	}
 	return 0;
 }
 
+int Decode::decode(const BitSet& bbn, BitSet& bbo) const
+{
+	bbo.erase_bit();
+	const int NVO = WMUL(bbo.capacity());
+	const int nBB = bbn.capacity();
+	const int NV = ords_.empty() ? NVO : static_cast<int>(comp_.size());
+	int retVal = 0;
+
+	//permutation kernel - bits of each block are scattered to their decoded blocks
+	for (auto i = 0; i < nBB; ++i) {
+		BITBOARD bb = bbn.block(i);
+		while (bb) {
+			const int v = WMUL(i) + bblock::lsb64_intrinsic(bb);
+			bb &= bb - 1;
+			const int u = (v < NV) ? (ords_.empty() ? v : comp_[v]) : EMPTY_ELEM;
+			if (u < 0 || u >= NVO) { retVal = -1; continue; }
+			bbo.block(WDIV(u)) |= bblock::MASK_BIT(WMOD(u));
+		}
+	}
+
+	if (retVal == -1) {
+		LOG_ERROR("vertex out of range - Decode::decode");
+	}
+	return retVal;
+}
+
+int Decode::decode(const BitSetSp& bbn, BitSetSp& bbo) const
+{
+	const int NVO = WMUL(bbo.capacity());
+	const int NV = ords_.empty() ? NVO : static_cast<int>(comp_.size());
+	int retVal = 0;
+
+	//decoded vertices, sorted to write the blocks of @bbo in order
+	vint lv;
+	lv.reserve(bbn.size());
+	for (auto it = bbn.cbegin(); it != bbn.cend(); ++it) {
+		BITBOARD bb = it->bb_;
+		while (bb) {
+			const int v = WMUL(it->idx_) + bblock::lsb64_intrinsic(bb);
+			bb &= bb - 1;
+			const int u = (v < NV) ? (ords_.empty() ? v : comp_[v]) : EMPTY_ELEM;
+			if (u < 0 || u >= NVO) { retVal = -1; continue; }
+			lv.push_back(u);
+		}
+	}
+	std::sort(lv.begin(), lv.end());
+
+	auto& vBB = bbo.bitset();
+	vBB.clear();
+	for (auto u : lv) {
+		const int idx = WDIV(u);
+		if (vBB.empty() || vBB.back().idx_ != idx) { vBB.emplace_back(idx, 0); }
+		vBB.back().bb_ |= bblock::MASK_BIT(WMOD(u));
+	}
+
+	if (retVal == -1) {
+		LOG_ERROR("vertex out of range - Decode::decode");
+	}
+	return retVal;
+}
+
+int Decode::decode_values(const vint& fnew, vint& fold) const
+{
+	const auto NVO = fold.size();
+	const auto NV = ords_.empty() ? NVO : comp_.size();
+	if (fnew.size() > NV) {
+		LOG_ERROR("more values than vertices - Decode::decode_values");
+		return -1;
+	}
+
+	int retVal = 0;
+	for (std::size_t v = 0; v < fnew.size(); ++v) {
+		const int u = ords_.empty() ? static_cast<int>(v) : comp_[v];
+		if (static_cast<std::size_t>(u) >= NVO) { retVal = -1; continue; }
+		fold[u] = fnew[v];
+	}
+
+	if (retVal == -1) {
+		LOG_ERROR("vertex out of range - Decode::decode_values");
+	}
+	return retVal;
+}
@@ -2,13 +2,14 @@
 * @file decode.h
 * @brief interface for the Decode class, which decodes orderings in graphs
 * @date 29/11/13
-* @last_update 17/12/24
+* @last_update 17/10/2026
 */
 
 #ifndef __DECODE_ORDERINGS_H__
 #define __DECODE_ORDERINGS_H__
 
 #include "utils/logger.h"
+#include "bitscan/bitscan.h"
 #include <vector>
 #include <algorithm>
 
@@ -19,78 +20,83 @@ namespace bitgraph {
 	namespace _impl {
 
 		class Decode {
-		private:
-			/*
-			* @brief functor which unwinds composite orderings for a given vertex
-			*/
-			struct DecodeVertex {
-				DecodeVertex(const std::vector<vint>& ords) :
-					ords_(ords)
-				{
-				}
-
-				int operator() (int v) const {
-					for (auto it = ords_.rbegin(); it != ords_.rend(); ++it) {
-						try {
-							v = (*it).at(v);								//will throw exception	
-						}
-						catch (const std::out_of_range& oor) {
-							LOGG_ERROR("Out of Range error: ", oor.what());
-							LOGG_ERROR("DecodeVertex: operator() - vertex : ", v);
-							LOGG_ERROR("exiting...");
-							std::exit(-1);
-						}
-					}
-					return v;
-				}
-
-				/////////////////////////////////////		
-				const std::vector<vint>& ords_;
-			};
-
 		public:
 			///////////////////////////////////////////////
 			static void reverse_in_place(vint& o);						//changes [index]-->[value] in place
 			static vint reverse(const vint& o);							//changes [index]-->[value] 
 			////////////////////////////////////////////////
 
-			void clear() { ords_.clear(); }
-			void add_ordering(const vint& o) { ords_.emplace_back(o); }
+			void clear() { ords_.clear(); comp_.clear(); }
+
+			/*
+			* @brief adds the ordering @o in format [new]->[old] (a reduction if smaller than the previous
+			*		 ordering), and composes it with the previous ones in a single array - O(|o|)
+			* @details: entries of @o out of range of the previous ordering are decoded to EMPTY_ELEM
+			* @details: last_update 17/10/2026
+			*/
+			void add_ordering(const vint& o);
+
 			bool is_empty() const noexcept { return ords_.empty(); }
 			const vint& first_ordering() const noexcept {
 				static const vint empty; 
 				return ords_.empty()? empty : ords_.front();
 			}
+			const std::vector<vint>& orderings() const noexcept { return ords_; }
+
+			/*
+			* @brief composition of all the orderings in format [new]->[original] (empty if there are no orderings)
+			*/
+			const vint& composed_ordering() const noexcept { return comp_; }
 
 			/*
 			* @brief decodes a single vertex for the given orderings
+			* @returns decoded vertex, EMPTY_ELEM if @v is out of range
 			* @date 16/6/17
-			* @last_update 17/12/2024
+			* @last_update 17/10/2026
 			*/
 			int decode(int v) const;
 
 			/*
 			* @brief decodes of a list of vertices @list for the given orderings
 			* @param list list of vertices
-			* @returns decoded list of vertices - empty if @list is empty
-			* @details: created 4/10/17, last_update 31/08/2025			 
+			* @returns decoded list of vertices - empty if @list is empty (vertices out of range are EMPTY_ELEM)
+			* @details: created 4/10/17, last_update 17/10/2026
 			*/
 			vint decode(const vint& list) const;
 
 			/*
 			* @brief modifies the list of vertices @list in place, decoding them for the given orderings
 			* @param list list of vertices
-			* @returns -1 if list is empty, 0 otherwise
-			* @details: created 4/10/17, last_update 31/08/2025
+			* @returns -1 if list is empty or a vertex is out of range, 0 otherwise
+			* @details: created 4/10/17, last_update 17/10/2026
 			*/
 			int decode_in_place(vint& list) const;
 
+			/*
+			* @brief decodes the set of vertices @bbn into @bbo (previous contents are cleared). The capacity
+			*		 of @bbo must hold the vertices of the original graph
+			* @returns -1 if a vertex is out of range (it is not decoded), 0 otherwise
+			* @details: created 17/10/2026
+			*/
+			int decode(const BitSet& bbn, BitSet& bbo) const;
+			int decode(const BitSetSp& bbn, BitSetSp& bbo) const;
+
+			/*
+			* @brief decodes a function on the vertices (e.g. a coloring) - fold[decode(v)] = fnew[v].
+			*		 Entries of @fold for vertices not in the image of the orderings are not modified
+			* @param fold function on the vertices of the original graph (its size is the number of vertices)
+			* @returns -1 if a vertex is out of range (it is not decoded), 0 otherwise
+			* @details: created 17/10/2026
+			*/
+			int decode_values(const vint& fnew, vint& fold) const;
 
 			//int decode_list(const vint& l, vint& res) const;
 
 			//////////////////////
 			// data members
+		private:
 			std::vector<vint> ords_;					//composition of orderings in [new]--[old] format
+			vint comp_;									//composed orderings in [new]--[original] format
 		};
 
 	}//end of namespace _impl
@@ -0,0 +1,581 @@
+/**
+* @file graph_components.h
+* @brief header for class GraphComponents, connected components of simple undirected graphs (dense or sparse),
+*		 and a driver which solves each component as an independent (compact) graph
+* @details: components are found by a bitset BFS in dense graphs - each level takes the frontier rows masked by
+*			the set of unreached vertices, block by block - and by a union-find with path compression over the
+*			edges in sparse graphs. The union-find is lock-free (roots are linked by CAS, the larger root under
+*			the smaller one) so the edges are processed in parallel, by tiles of vertices.
+* @details: components are labelled by non-increasing size (ties by smallest vertex). The vertices of each
+*			component are stored consecutively, in increasing order, so that a component is extracted as a
+*			compact graph where labels keep the original order - the mapping [new]->[old] is the vertex list.
+* @details: for_each_component() extracts and processes the components in parallel, largest first (a task
+*			per component taken from an atomic cursor, so the largest components start first and the many
+*			small ones fill the gaps). Drivers for clique heuristics, k-core and coloring recombine the partial
+*			results with the mappings.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __GRAPH_COMPONENTS_H__
+#define __GRAPH_COMPONENTS_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/kcore_parallel.h"
+#include "graph/algorithms/coloring/col_func.h"
+#include "graph/algorithms/clique/clq_heur.h"
+#include "bitscan/bitscan.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <numeric>
+#include <algorithm>
+#include <type_traits>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////
+		//
+		// GraphComponents class
+		//
+		// Connected components and independent per-component solving
+		//
+		////////////////////
+
+		template<class Graph_t>
+		class GraphComponents {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<bitgraph::Ugraph<BBScanSp>, Graph_t>::value, "GraphComponents<Graph_t> requires Ugraph<BBScan> or Ugraph<BBScanSp>");
+
+		public:
+			using type = GraphComponents<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+			using is_dense = std::is_same<basic_type, BBScan>;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum { ROW_TILE = 64 };											//vertices per task of a thread
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @param nThreads: number of threads (hardware threads if <= 0)
+			*/
+			explicit GraphComponents(Graph_t& g, int nThreads = 0) :
+				g_(g), NV_(g.number_of_vertices()), nThreads_(nThreads)
+			{}
+
+			//copy and move semantics disallowed
+			GraphComponents(const GraphComponents&) = delete;
+			GraphComponents& operator =			(const GraphComponents&) = delete;
+			GraphComponents(GraphComponents&&) = delete;
+			GraphComponents& operator =			(GraphComponents&&) = delete;
+
+			~GraphComponents() = default;
+
+			/////////////////////////////
+			// public interface
+
+			/*
+			* @brief Computes the connected components of the graph
+			* @returns number of components
+			*/
+			int find_components();
+
+			/*
+			* @brief Builds component @c as a compact graph @gc, with the vertices of @c relabelled
+			*		 0..size(c) - 1 in increasing order (vertices(c) is the mapping [new]->[old])
+			* @returns size of the component, -1 if error
+			*/
+			int extract(int c, Graph_t& gc) const;
+
+			/*
+			* @brief Calls @f(c, gc, n2o) for every component @c with at least @minSize vertices, in parallel
+			*		 and largest first. @gc is the compact graph of the component (owned by the calling thread)
+			*		 and @n2o the mapping [new]->[old]
+			* @returns number of components processed, -1 if error
+			*/
+			template<class Func>
+			int for_each_component(Func f, int minSize = 1);
+
+			/////////////////////////////
+			// drivers - per-component work recombined in the original graph
+
+			/*
+			* @brief Largest clique found by CliqueHeurParallel in the components (one thread per component).
+			*		 Components not larger than the incumbent are skipped
+			* @param clq: output clique (original labels, sorted)
+			* @returns size of the clique, -1 if error
+			*/
+			int clique_heur(vint& clq);
+
+			/*
+			* @brief Coreness of all vertices, by a k-core decomposition of each component
+			* @param core: output coreness (original labels)
+			* @returns maximum core number, -1 if error
+			*/
+			int coreness(vint& core);
+
+			/*
+			* @brief DSATUR coloring of each component - components share the same colors
+			* @param col: output coloring (original labels)
+			* @returns number of colors, -1 if error
+			*/
+			int coloring(vint& col);
+
+			/////////////////////////////
+			// getters (after find_components())
+
+			int number_of_components()						const { return static_cast<int>(size_.size()); }
+
+			/*
+			* @brief component of each vertex - 0 is the largest
+			*/
+			const vint& labels()							const { return label_; }
+			int component_of(int v)							const { return label_[v]; }
+
+			/*
+			* @brief component sizes, in non-increasing order
+			*/
+			const vint& sizes()								const { return size_; }
+			int size(int c)									const { return size_[c]; }
+
+			/*
+			* @brief vertices of component @c in increasing order, the mapping [new]->[old] of its compact graph
+			*/
+			vint vertices(int c)							const;
+
+			/*
+			* @brief vertices of component @c as a bitset of the type of the graph rows
+			*/
+			_bbt component(int c)							const;
+
+			//size statistics
+			int largest_size()								const { return size_.empty() ? 0 : size_.front(); }
+			int smallest_size()								const { return size_.empty() ? 0 : size_.back(); }
+			double mean_size()								const { return size_.empty() ? 0.0 : static_cast<double>(NV_) / size_.size(); }
+			int number_of_singletons()						const;
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief root label of every vertex (the smallest vertex of its component)
+			*/
+			void find_roots(vint& root, std::true_type /* dense */);
+			void find_roots(vint& root, std::false_type /* sparse */);
+
+			/*
+			* @brief union-find (lock-free) - root of @v with path halving, and union of the sets of @u and @v
+			*/
+			static int find(std::vector<std::atomic<int>>& parent, int v);
+			static void unite(std::vector<std::atomic<int>>& parent, int u, int v);
+
+			/*
+			* @brief labels components by size from the roots, and computes vertex lists and local labels
+			*/
+			void relabel(const vint& root);
+
+			void build(int c, Graph_t& gc, std::true_type /* dense */) const;
+			void build(int c, Graph_t& gc, std::false_type /* sparse */) const;
+
+			////////////////
+			// data members
+
+			Graph_t& g_;
+			const int NV_;
+			int nThreads_;
+
+			vint label_;													//component of each vertex
+			vint size_;														//component sizes (non-increasing)
+			vint start_;													//vertices of c are ver_[start_[c], start_[c + 1])
+			vint ver_;														//vertices grouped by component
+			vint local_;													//label of each vertex in its component
+		};
+
+	}//end namespace _impl
+
+	using _impl::GraphComponents;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	inline
+		int GraphComponents<Graph_t>::number_of_singletons() const
+	{
+		//sizes are non-increasing - singletons are last
+		auto it = std::lower_bound(size_.begin(), size_.end(), 1, std::greater<int>());
+		return static_cast<int>(size_.end() - it);
+	}
+
+	template<class Graph_t>
+	inline
+		vint GraphComponents<Graph_t>::vertices(int c) const
+	{
+		return vint(ver_.begin() + start_[c], ver_.begin() + start_[c + 1]);
+	}
+
+	template<class Graph_t>
+	inline
+		typename GraphComponents<Graph_t>::_bbt GraphComponents<Graph_t>::component(int c) const
+	{
+		_bbt bb(NV_);
+		for (auto i = start_[c]; i < start_[c + 1]; ++i) {
+			bb.set_bit(ver_[i]);
+		}
+		return bb;
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphComponents<Graph_t>::find_components()
+	{
+		vint root;
+		find_roots(root, is_dense());
+		relabel(root);
+		return number_of_components();
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphComponents<Graph_t>::find_roots(vint& root, std::true_type)
+	{
+		root.assign(NV_, EMPTY_ELEM);
+
+		BBScan open(NV_);												//vertices not yet reached
+		open.set_bit(0, NV_ - 1);
+		const int nBB = open.number_of_blocks();
+
+		vint frontier, next;
+		for (auto s = open.lsb(); s != EMPTY_ELEM; s = open.lsb()) {
+
+			//BFS from s - the rows of each level are masked by the unreached vertices
+			open.erase_bit(s);
+			root[s] = s;
+			frontier.assign(1, s);
+			while (!frontier.empty()) {
+				next.clear();
+				for (auto u : frontier) {
+					const auto& row = g_.neighbors(u);
+					for (auto i = 0; i < nBB; ++i) {
+						BITBOARD bb = row.block(i) & open.block(i);
+						if (bb == 0) { continue; }
+						open.block(i) &= ~bb;
+						while (bb) {
+							const int v = WMUL(i) + bblock::lsb64_intrinsic(bb);
+							root[v] = s;
+							next.push_back(v);
+							bb &= bb - 1;
+						}
+					}
+				}
+				frontier.swap(next);
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphComponents<Graph_t>::find_roots(vint& root, std::false_type)
+	{
+		std::vector<std::atomic<int>> parent(NV_);
+		for (auto v = 0; v < NV_; ++v) {
+			parent[v].store(v, std::memory_order_relaxed);
+		}
+
+		//every edge {u, v} is taken once, from its smaller endpoint
+		const int nThreads = com::thread_count(nThreads_, NV_ / ROW_TILE);
+		std::atomic<int> next(0);
+		com::run_parallel(nThreads, [&](int) {
+			int first;
+			while ((first = next.fetch_add(ROW_TILE)) < NV_) {
+				const int last = std::min(first + static_cast<int>(ROW_TILE), NV_);
+				for (auto u = first; u < last; ++u) {
+					const auto& row = g_.neighbors(u);
+					for (auto it = row.cbegin(); it != row.cend(); ++it) {
+						if (it->idx_ < WDIV(u)) { continue; }
+						BITBOARD bb = it->bb_;
+						if (it->idx_ == WDIV(u)) { bb &= ~bblock::MASK_1(0, WMOD(u)); }
+						while (bb) {
+							unite(parent, u, WMUL(it->idx_) + bblock::lsb64_intrinsic(bb));
+							bb &= bb - 1;
+						}
+					}
+				}
+			}
+		});
+
+		root.resize(NV_);
+		for (auto v = 0; v < NV_; ++v) {
+			root[v] = find(parent, v);
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphComponents<Graph_t>::find(std::vector<std::atomic<int>>& parent, int v)
+	{
+		int p = parent[v].load(std::memory_order_relaxed);
+		while (p != v) {
+
+			//path halving - v skips its parent (parents only decrease, so a failed CAS is harmless)
+			const int gp = parent[p].load(std::memory_order_relaxed);
+			if (gp != p) {
+				parent[v].compare_exchange_weak(p, gp, std::memory_order_relaxed);
+			}
+			v = gp;
+			p = parent[v].load(std::memory_order_relaxed);
+		}
+		return v;
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphComponents<Graph_t>::unite(std::vector<std::atomic<int>>& parent, int u, int v)
+	{
+		while (true) {
+			u = find(parent, u);
+			v = find(parent, v);
+			if (u == v) { return; }
+
+			//the larger root is linked under the smaller one, if it is still a root
+			if (u < v) { std::swap(u, v); }
+			int expected = u;
+			if (parent[u].compare_exchange_strong(expected, v, std::memory_order_relaxed)) { return; }
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphComponents<Graph_t>::relabel(const vint& root)
+	{
+		//size of each root
+		vint cnt(NV_, 0);
+		for (auto v = 0; v < NV_; ++v) { ++cnt[root[v]]; }
+
+		//roots by non-increasing size - roots are the smallest vertex of their component
+		vint roots;
+		for (auto v = 0; v < NV_; ++v) {
+			if (root[v] == v) { roots.push_back(v); }
+		}
+		std::stable_sort(roots.begin(), roots.end(), [&](int a, int b) { return cnt[a] > cnt[b]; });
+
+		const int nC = static_cast<int>(roots.size());
+		vint r2c(NV_, EMPTY_ELEM);
+		size_.resize(nC);
+		start_.assign(nC + 1, 0);
+		for (auto c = 0; c < nC; ++c) {
+			r2c[roots[c]] = c;
+			size_[c] = cnt[roots[c]];
+			start_[c + 1] = start_[c] + size_[c];
+		}
+
+		//vertices grouped by component, in increasing order
+		label_.resize(NV_);
+		local_.resize(NV_);
+		ver_.resize(NV_);
+		vint pos(start_.begin(), start_.end() - 1);
+		for (auto v = 0; v < NV_; ++v) {
+			const int c = r2c[root[v]];
+			label_[v] = c;
+			local_[v] = pos[c] - start_[c];
+			ver_[pos[c]++] = v;
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphComponents<Graph_t>::extract(int c, Graph_t& gc) const
+	{
+		if (c < 0 || c >= number_of_components()) {
+			LOG_ERROR("component out of range - GraphComponents<Graph_t>::extract");
+			return -1;
+		}
+
+		if (gc.reset(size_[c], g_.name()) == -1) {
+			LOG_ERROR("error during allocation - GraphComponents<Graph_t>::extract");
+			return -1;
+		}
+		build(c, gc, is_dense());
+		return size_[c];
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphComponents<Graph_t>::build(int c, Graph_t& gc, std::true_type) const
+	{
+		for (auto i = start_[c]; i < start_[c + 1]; ++i) {
+			const int v = ver_[i];
+			const auto& row = g_.neighbors(v);
+			auto& rowc = gc.neighbors(local_[v]);
+			const int nBB = row.number_of_blocks();
+			for (auto b = 0; b < nBB; ++b) {
+				BITBOARD bb = row.block(b);
+				while (bb) {
+					const int j = local_[WMUL(b) + bblock::lsb64_intrinsic(bb)];
+					rowc.block(WDIV(j)) |= bblock::MASK_BIT(WMOD(j));
+					bb &= bb - 1;
+				}
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphComponents<Graph_t>::build(int c, Graph_t& gc, std::false_type) const
+	{
+		//local labels keep the original order - rows are written in order
+		for (auto i = start_[c]; i < start_[c + 1]; ++i) {
+			const int v = ver_[i];
+			const auto& row = g_.neighbors(v);
+			auto& vBB = gc.neighbors(local_[v]).bitset();
+			vBB.clear();
+			for (auto it = row.cbegin(); it != row.cend(); ++it) {
+				BITBOARD bb = it->bb_;
+				while (bb) {
+					const int j = local_[WMUL(it->idx_) + bblock::lsb64_intrinsic(bb)];
+					const int idx = WDIV(j);
+					if (vBB.empty() || vBB.back().idx_ != idx) { vBB.emplace_back(idx, 0); }
+					vBB.back().bb_ |= bblock::MASK_BIT(WMOD(j));
+					bb &= bb - 1;
+				}
+			}
+		}
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		int GraphComponents<Graph_t>::for_each_component(Func f, int minSize)
+	{
+		//components are sorted by size - the first nC have at least minSize vertices
+		auto it = std::upper_bound(size_.begin(), size_.end(), std::max(minSize, 1), std::greater<int>());
+		const int nC = static_cast<int>(it - size_.begin());
+		if (nC == 0) { return 0; }
+
+		const int nThreads = com::thread_count(nThreads_, nC);
+		std::atomic<int> next(0);
+		std::atomic<bool> error(false);
+		com::run_parallel(nThreads, [&](int) {
+			Graph_t gc;
+			int c;
+			while (!error.load(std::memory_order_relaxed) && (c = next.fetch_add(1)) < nC) {
+				if (extract(c, gc) == -1) {
+					error.store(true);
+					return;
+				}
+				const vint n2o(ver_.begin() + start_[c], ver_.begin() + start_[c + 1]);
+				f(c, gc, n2o);
+			}
+		});
+
+		return error.load() ? -1 : nC;
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphComponents<Graph_t>::clique_heur(vint& clq)
+	{
+		clq.clear();
+		if (size_.empty()) { return 0; }
+
+		//any vertex is a clique
+		clq.push_back(ver_.front());
+		std::atomic<int> best(1);
+		std::mutex mtx;
+
+		//singletons are not processed - the incumbent is already a vertex
+		const int nC = for_each_component([&](int, Graph_t& gc, const vint& n2o) {
+
+			//a component is a bound for its cliques - the rest are not larger
+			if (static_cast<int>(gc.number_of_vertices()) <= best.load()) { return; }
+			if (gc.number_of_edges() == 0) { return; }
+
+			CliqueHeurParallel<Graph_t> heur(gc);
+			heur.number_of_threads(1);
+			const int lb = heur.run();
+
+			std::lock_guard<std::mutex> lck(mtx);
+			if (lb > best.load()) {
+				clq.clear();
+				for (auto v : heur.clique()) { clq.push_back(n2o[v]); }
+				std::sort(clq.begin(), clq.end());
+				best.store(lb);
+			}
+		}, 2);
+
+		return (nC == -1) ? -1 : best.load();
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphComponents<Graph_t>::coreness(vint& core)
+	{
+		core.assign(NV_, 0);
+		std::atomic<int> maxCore(0);
+		std::atomic<bool> error(false);
+
+		//singletons have coreness 0
+		const int nC = for_each_component([&](int, Graph_t& gc, const vint& n2o) {
+			KCoreParallel kc(gc, 1);
+			if (kc.find_kcore(1) == -1) {
+				error.store(true);
+				return;
+			}
+			const int nR = gc.number_of_vertices();
+			for (auto v = 0; v < nR; ++v) {
+				core[n2o[v]] = kc.coreness(v);
+			}
+			int k = maxCore.load();
+			const int kc_max = kc.max_core_number();
+			while (kc_max > k && !maxCore.compare_exchange_weak(k, kc_max)) {}
+		}, 2);
+
+		if (nC == -1 || error.load()) {
+			LOG_ERROR("error during the k-core decomposition of a component - GraphComponents<Graph_t>::coreness");
+			return -1;
+		}
+		return maxCore.load();
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphComponents<Graph_t>::coloring(vint& col)
+	{
+		col.assign(NV_, 0);
+		if (size_.empty()) { return 0; }
+		std::atomic<int> nCol(1);
+
+		//singletons take color 0
+		const int nC = for_each_component([&](int, Graph_t& gc, const vint& n2o) {
+			vint colc;
+			const int k = gfunc::col::dsatur(gc, colc);
+			const int nR = gc.number_of_vertices();
+			for (auto v = 0; v < nR; ++v) {
+				col[n2o[v]] = colc[v];
+			}
+			int kmax = nCol.load();
+			while (k > kmax && !nCol.compare_exchange_weak(kmax, k)) {}
+		}, 2);
+
+		return (nC == -1) ? -1 : nCol.load();
+	}
+
+}//end namespace bitgraph
+
+#endif
@@ -2,7 +2,10 @@
 * @file graph_fast_sort.h
 * @brief header for GraphFastRootSort class which sorts graphs by different criteria
 * @details: changed nodes_ stack to vector (18/03/19)
-* @details: created 12/03/15,  last_update 27/01/25
+* @details: degenerate orderings with bucket queues, triangle orderings (17/10/26)
+* @details: the triangle key is computed by the caller (e.g. TriangleCount in triangles.h) and passed
+*			with set_triangles - the sorter does not depend on the parallel engines
+* @details: created 12/03/15,  last_update 17/10/26
 * @author pss
 * 
 * @TODO add further primitives for composite orderings in subgraphs (29/12/24)
@@ -23,6 +26,8 @@
 #include <algorithm>
 #include <iostream>
 #include <vector>
+#include <queue>
+#include <functional>
 
 
 //alias
@@ -53,7 +58,7 @@ namespace bitgraph {
 			using bb_type = typename Graph_t::_bbt;								//bitset type
 
 			enum { PRINT_DEGREE = 0, PRINT_SUPPORT, PRINT_NODES };
-			enum { MIN_DEGEN = 0, MAX_DEGEN, MIN_DEGEN_COMPO, MAX_DEGEN_COMPO, MAX, MIN, MAX_WITH_SUPPORT, MIN_WITH_SUPPORT, NONE };
+			enum { MIN_DEGEN = 0, MAX_DEGEN, MIN_DEGEN_COMPO, MAX_DEGEN_COMPO, MAX, MIN, MAX_WITH_SUPPORT, MIN_WITH_SUPPORT, NONE, MAX_TRIANGLES, MIN_TRIANGLES };
 
 			////////////////////////
 			//static methods 
@@ -74,7 +79,7 @@ namespace bitgraph {
 				* @param alg sorting algorithm
 				* @param ltf last to first ordering if TRUE
 				* @param o2n old to new ordering	if TRUE
-				* @return new ordering in [OLD]->[NEW] format
+				* @return new ordering in [OLD]->[NEW] format, empty if error
 				*/
 			virtual vint new_order(int alg, bool ltf = true, bool o2n = true);
 
@@ -84,7 +89,7 @@ namespace bitgraph {
 			* @param new_order given ordering in [OLD]->[NEW] format
 			* @param d ptr to decode object to store the ordering
 			* @comments only for simple undirected graphs with no weights
-			* @return 0 if successful
+			* @return 0 if successful, -1 if error
 			*/
 			int reorder(const vint& new_order, Graph_t& gn, Decode* d = nullptr);
 
@@ -114,6 +119,7 @@ namespace bitgraph {
 
 			const vint& degree() const { return nb_neigh_; }
 			const vint& support() const { return deg_neigh_; }
+			const std::vector<uint64_t>& triangles() const { return nb_tri_; }
 			const Graph_t& graph() const { return g_; }
 			std::size_t number_of_vertices() const { return NV_; }
 
@@ -154,6 +160,14 @@ namespace bitgraph {
 			**/
 			const vint& compute_support_root();
 
+			/**
+			* @brief Sets the number of triangles of each vertex, the key of the triangle orderings
+			*		 (MAX_TRIANGLES, MIN_TRIANGLES), e.g. TriangleCount<Graph_t>::triangles() after count_per_vertex()
+			* @param tri number of triangles of each vertex (size |V|)
+			* @returns 0 if OK, -1 if the size of @tri is not |V|
+			**/
+			int set_triangles(std::vector<uint64_t> tri);
+
 
 			/**
 			* @brief Computes a non_increasing_degree (non-degenerate) ordering
@@ -188,15 +202,25 @@ namespace bitgraph {
 			const vint& sort_non_decreasing_deg_with_support_tb(bool rev);
 
 			/**
-			* @brief Degenerate non-decreasing degree ordering
+			* @brief Computes a non-increasing (non-decreasing) number of triangles ordering (non-degenerate)
+			*		 with tiebreak by degree
+			* @param rev reverse ordering if TRUE
+			* @important requires prior computation of deg and triangles set (set_triangles)
+			* @return output ordering in [OLD]->[NEW] format
+			**/
+			const vint& sort_non_increasing_tri(bool rev);
+			const vint& sort_non_decreasing_tri(bool rev);
+
+			/**
+			* @brief Degenerate non-decreasing (non-increasing) degree ordering - ties by minimum index
 			* @comments deg info is not restored after the call
+			* @comments bucket queue, O((|V| + |E|) log |V|) - see sort_degen_bucket
 			* @return output ordering in [OLD]->[NEW] format
-			* TODO - optimize
 			**/
 			const vint& sort_degen_non_decreasing_deg(bool rev);
 			const vint& sort_degen_non_increasing_deg(bool rev);
 
-			//Expermimental alternative implementation - CHECK efficiency
+			//Alternative implementation, same ordering as sort_degen_non_decreasing_deg
 			//Does not required cached degree info of vertices in @nb_neigh_
 			const vint& sort_degen_non_decreasing_deg_B(bool rev);
 
@@ -264,6 +288,21 @@ namespace bitgraph {
 		// I/O
 			ostream& print(int type, ostream& o, bool eofl = true) const;
 
+		protected:
+			/**
+			* @brief Degenerate ordering core: repeatedly picks the remaining vertex with minimum
+			*		 (maximum if @min_first is FALSE) degree, ties by minimum rank in @ord, and
+			*		 decrements the degree of its remaining neighbors
+			* @param deg degree of each vertex (updated)
+			* @param ord tiebreak ordering - ord[r] is the vertex with rank r
+			* @param min_first non-decreasing degree ordering if TRUE, non-increasing otherwise
+			* @comments output ordering in @nodes_
+			* @comments bucket queue with one min-heap of ranks per degree, so ties are broken exactly as
+			*			in a linear scan of @ord. Stale entries are discarded lazily, every vertex enters
+			*			each bucket at most once - O((|V| + |E|) log |V|) instead of O(|V|^2)
+			**/
+			void sort_degen_bucket(vint& deg, const vint& ord, bool min_first);
+
 
 
 
@@ -276,7 +315,8 @@ namespace bitgraph {
 
 			vint nb_neigh_;											//stores the degree of the vertices		
 			vint deg_neigh_;										//stores the support of the vertices (degree of neighbors)
-			bb_type node_active_state_;								//bitset for active vertices: 1bit-active, 0bit-passive. Used in degenerate orderings	
+			std::vector<uint64_t> nb_tri_;							//stores the number of triangles of the vertices
+			bb_type node_active_state_;								//bitset for active vertices: 1bit-active, 0bit-passive	
 			vint nodes_;											//stores the ordering
 
 		};//end of GraphFastRootSort class
@@ -351,10 +391,19 @@ namespace bitgraph {
 			compute_support_root();
 			sort_non_decreasing_deg_with_support_tb(ltf);
 			break;
+		case MAX_TRIANGLES:
+		case MIN_TRIANGLES:
+			if (nb_tri_.size() != NV_) {
+				LOGG_ERROR("triangles not set (see set_triangles) - GraphFastRootSort<Graph_t>::new_order");
+				return vint();
+			}
+			compute_deg_root();
+			if (alg == MAX_TRIANGLES) { sort_non_increasing_tri(ltf); }
+			else { sort_non_decreasing_tri(ltf); }
+			break;
 		default:
 			LOGG_ERROR("unknown sorting algorithm : ", alg, "- GraphFastRootSort<Graph_t>::new_order");
-			LOG_ERROR("exiting...");
-			exit(-1);
+			return vint();
 		}
 
 		//conversion [NEW] to [OLD] if required
@@ -364,52 +413,76 @@ namespace bitgraph {
 
 	template<class Graph_t>
 	inline
-		const vint& GraphFastRootSort<Graph_t>::sort_degen_non_decreasing_deg(bool rev) {
+		void GraphFastRootSort<Graph_t>::sort_degen_bucket(vint& deg, const vint& ord, bool min_first)
+	{
+		using heap_t = std::priority_queue<int, vint, std::greater<int>>;
 
-		//initialization
-		node_active_state_.set_bit(0, NV_ - 1);					//all vertices active, pending to be ordered
 		nodes_.clear();
 		nodes_.reserve(NV_);
+		if (NV_ == 0) { return; }
+
+		//rank of each vertex in @ord (tiebreak)
+		vint rank(NV_);
+		int max_deg = 0;
+		for (auto r = 0u; r < NV_; r++) {
+			rank[ord[r]] = r;
+			max_deg = std::max(max_deg, deg[ord[r]]);
+		}
+
+		//bucket[d]: ranks of vertices which had degree d (min-heap, stale entries are discarded lazily)
+		//ranks are pushed in increasing order, so the initial heaps are built in linear time
+		std::vector<heap_t> bucket(max_deg + 1);
+		for (auto r = 0u; r < NV_; r++) {
+			bucket[deg[ord[r]]].push(r);
+		}
 
-		int max_deg = NV_;
-		int v = BBObject::noBit;
-		do {
-			max_deg = NV_;
+		std::vector<char> active(NV_, 1);
+		int cur = (min_first) ? 0 : max_deg;
+		for (auto n = 0u; n < NV_; n++) {
 
-			//selects an active vertex with minimum degree
-			for (auto j = 0u; j < NV_; j++) {
-				if (node_active_state_.is_bit(j) && nb_neigh_[j] < max_deg) {
-					max_deg = nb_neigh_[j];
-					v = (int)j;
+			//selects the active vertex with minimum (maximum) degree and lowest rank
+			int v = BBObject::noBit;
+			do {
+				heap_t& b = bucket[cur];
+				while (!b.empty()) {
+					int u = ord[b.top()];
+					b.pop();
+					if (active[u] && deg[u] == cur) { v = u; break; }
 				}
-			}
+				if (v == BBObject::noBit) { (min_first) ? ++cur : --cur; }
+			} while (v == BBObject::noBit);
 
 			//////////////////////////////////
 			nodes_.emplace_back(v);
-			if (nodes_.size() == NV_) { break; }			//exit condition
-
-			node_active_state_.erase_bit(v);
-			///////////////////////////////////
+			active[v] = 0;
+			//////////////////////////////////
 
-			//update degree info of the remaining active vertices
+			//updates degree info of the remaining active vertices
 			bb_type& bbn = g_.neighbors(v);
-
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
+			if (!bbn.is_empty() && bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
 				int w = BBObject::noBit;
 				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
+					if (active[w]) {
+						bucket[--deg[w]].push(rank[w]);
 					}
 				}
 			}
 
-		} while (true);
+			//active degrees are at least cur - 1 after removing v
+			if (min_first && cur > 0) { --cur; }
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		const vint& GraphFastRootSort<Graph_t>::sort_degen_non_decreasing_deg(bool rev) {
 
+		set_ordering();
+		sort_degen_bucket(nb_neigh_, vint(nodes_), true);
 
 		if (rev) {
 			std::reverse(nodes_.begin(), nodes_.end());
 		}
-
 		return nodes_;
 	}
 
@@ -417,42 +490,8 @@ namespace bitgraph {
 	inline
 		const vint& GraphFastRootSort<Graph_t>::sort_degen_non_increasing_deg(bool rev) {
 
-		//initialization
-		node_active_state_.set_bit(0, NV_ - 1);										//all vertices active, pending to be ordered
-		nodes_.clear();
-		nodes_.reserve(NV_);
-
-		//main loop
-		int max_deg = 0, v = BBObject::noBit;
-		do {
-			//finds vertex with maximum degree
-			max_deg = -1;
-			for (auto j = 0u; j < NV_; j++) {
-				if (node_active_state_.is_bit(j) && nb_neigh_[j] > max_deg) {
-					max_deg = nb_neigh_[j];
-					v = j;
-				}
-			}
-
-			//////////////////////////////////
-			nodes_.emplace_back(v);
-			if (nodes_.size() == NV_) { break; }			//exit condition
-
-			node_active_state_.erase_bit(v);
-			//////////////////////////////////
-
-			//updates neighborhood info in remaining vertices
-			bb_type& bbn = g_.neighbors(v);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
-					}
-				}
-			}
-
-		} while (true);
+		set_ordering();
+		sort_degen_bucket(nb_neigh_, vint(nodes_), false);
 
 		if (rev) {
 			std::reverse(nodes_.begin(), nodes_.end());
@@ -463,44 +502,18 @@ namespace bitgraph {
 	template<class Graph_t>
 	inline const vint& GraphFastRootSort<Graph_t>::sort_degen_non_decreasing_deg_B(bool rev)
 	{
+		//degrees are computed locally - @nb_neigh_ is not used
+		vint deg(NV_);
+		for (auto v = 0u; v < NV_; v++) {
+			deg[v] = g_.degree(v);
+		}
 
-		int min_deg = NV_, deg = 0;
-		node_active_state_.set_bit(0, NV_ - 1);					//all active, pending to be ordered
-		nodes_.clear();
-
-		//main loop
-		do {
-
-			min_deg = NV_;
-			int w = BBObject::noBit;
-			int v = BBObject::noBit;
-
-			//selects an active vertex with minimum degree
-			if (node_active_state_.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				LOG_ERROR("init scan failed -  GraphFastRootSort<Graph_t>::sort_degen_non_decreasing_deg_B");
-				LOG_ERROR("exting");
-				std::exit(-1);
-			}
-
-			while ((w = node_active_state_.next_bit()) != BBObject::noBit) {
-				deg = g_.degree(w, node_active_state_);
-				if (min_deg > deg) {											// >= is possible
-					min_deg = deg;
-					v = w;
-				}
-			}
-
-			//////////////////////////////////
-			node_active_state_.erase_bit(v);
-			nodes_.emplace_back(v);
-			//////////////////////////////////
-
-		} while (nodes_.size() < NV_);
+		set_ordering();
+		sort_degen_bucket(deg, vint(nodes_), true);
 
 		if (rev) {
 			std::reverse(nodes_.begin(), nodes_.end());
 		}
-
 		return nodes_;
 	}
 
@@ -508,38 +521,9 @@ namespace bitgraph {
 	inline
 		const vint& GraphFastRootSort<Graph_t>::sort_degen_composite_non_decreasing_deg(bool rev)
 	{
-		node_active_state_.set_bit(0, NV_ - 1);			//all active, pending to be ordered
-		int min_deg = NV_, v = EMPTY_ELEM;
+		//TB according to the given ordering in nodes_ori
 		vint nodes_ori = nodes_;
-		nodes_.clear();
-
-		for (auto i = 0u; i < NV_; i++) {
-
-			//finds vertex with minimum degree with TB according to the given ordering in nodes_ori 
-			min_deg = NV_;
-			for (auto j = 0u; j < NV_; j++) {
-				int u = nodes_ori[j];
-				if (node_active_state_.is_bit(u) && nb_neigh_[u] < min_deg) {
-					min_deg = nb_neigh_[u];
-					v = u;
-				}
-			}
-
-			//updates context
-			nodes_.emplace_back(v);
-			node_active_state_.erase_bit(v);
-
-			//updates neighborhood info in remaining vertices
-			bb_type& bbn = g_.neighbors(v);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
-					}
-				}
-			}
-		}
+		sort_degen_bucket(nb_neigh_, nodes_ori, true);
 
 		if (rev) {
 			std::reverse(nodes_.begin(), nodes_.end());
@@ -551,37 +535,9 @@ namespace bitgraph {
 	inline
 		const vint& GraphFastRootSort<Graph_t>::sort_degen_composite_non_increasing_deg(bool rev)
 	{
-		node_active_state_.set_bit(0, NV_ - 1);											//all active, pending to be ordered
-		int max_deg = 0, v = EMPTY_ELEM;
+		//TB according to the given ordering in nodes_ori
 		vint nodes_ori = nodes_;
-		nodes_.clear();
-
-		for (auto i = 0u; i < NV_; i++) {
-			//finds vertex with maximum degree
-			max_deg = -1;
-			for (auto j = 0u; j < NV_; j++) {
-				int u = nodes_ori[j];
-				if (node_active_state_.is_bit(u) && nb_neigh_[u] > max_deg) {
-					max_deg = nb_neigh_[u];
-					v = u;
-				}
-			}
-
-			//updates context
-			nodes_.emplace_back(v);
-			node_active_state_.erase_bit(v);
-
-			//updates neighborhood info in remaining vertices
-			bb_type& bbn = g_.neighbors(v);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
-				int w = BBObject::noBit;
-				while ((w = bbn.next_bit()) != BBObject::noBit) {
-					if (node_active_state_.is_bit(w)) {
-						nb_neigh_[w]--;
-					}
-				}
-			}
-		}
+		sort_degen_bucket(nb_neigh_, nodes_ori, false);
 
 		if (rev) {
 			std::reverse(nodes_.begin(), nodes_.end());
@@ -757,6 +713,51 @@ namespace bitgraph {
 		return nodes_;
 	}
 
+	template<class Graph_t>
+	inline
+		const vint& GraphFastRootSort<Graph_t>::sort_non_increasing_tri(bool rev) {
+		set_ordering();
+		const auto& tri = nb_tri_;
+		const auto& deg = nb_neigh_;
+		std::stable_sort(nodes_.begin(), nodes_.end(), [&tri, &deg](int a, int b) {
+			return (tri[a] != tri[b]) ? tri[a] > tri[b] : deg[a] > deg[b];
+		});
+
+		if (rev) {
+			std::reverse(nodes_.begin(), nodes_.end());
+		}
+		return nodes_;
+	}
+
+	template<class Graph_t>
+	inline
+		const vint& GraphFastRootSort<Graph_t>::sort_non_decreasing_tri(bool rev) {
+		set_ordering();
+		const auto& tri = nb_tri_;
+		const auto& deg = nb_neigh_;
+		std::stable_sort(nodes_.begin(), nodes_.end(), [&tri, &deg](int a, int b) {
+			return (tri[a] != tri[b]) ? tri[a] < tri[b] : deg[a] < deg[b];
+		});
+
+		if (rev) {
+			std::reverse(nodes_.begin(), nodes_.end());
+		}
+		return nodes_;
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphFastRootSort<Graph_t>::set_triangles(std::vector<uint64_t> tri) {
+
+		if (tri.size() != NV_) {
+			LOGG_ERROR("wrong size of triangle key: ", tri.size(), " - GraphFastRootSort<Graph_t>::set_triangles");
+			return -1;
+		}
+		nb_tri_ = std::move(tri);
+
+		return 0;
+	}
+
 	template<class Graph_t>
 	inline
 		const vint& GraphFastRootSort<Graph_t>::compute_deg_root() {
@@ -775,7 +776,7 @@ namespace bitgraph {
 		for (auto elem = 0u; elem < NV_; ++elem) {
 			deg_neigh_[elem] = 0;
 			bb_type& bbn = g_.neighbors(elem);
-			if (bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
+			if (!bbn.is_empty() && bbn.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
 				int w = BBObject::noBit;
 				while ((w = bbn.next_bit()) != EMPTY_ELEM) {
 					deg_neigh_[elem] += nb_neigh_[w];
@@ -805,8 +806,7 @@ namespace bitgraph {
 			break;
 		default:
 			LOG_ERROR("unknown print type- GraphFastRootSort<Graph_t>::print()");
-			LOG_ERROR("exiting...");
-			exit(-1);
+			return o;
 		}
 
 		if (eofl) { o << endl; }
@@ -833,6 +833,8 @@ namespace bitgraph {
 		deg_neigh_.clear();
 		deg_neigh_.resize(NV_);
 
+		nb_tri_.clear();
+
 		node_active_state_.set_bit(0, NV_ - 1);		//all active, pending to be ordered
 		return 0;
 	}
@@ -842,12 +844,16 @@ namespace bitgraph {
 		int GraphFastRootSort<Graph_t>::reorder(const vint& new_order, Graph_t& gn, Decode* d)
 	{
 		std::size_t NV = g_.number_of_vertices();
+		if (new_order.size() != NV) {
+			LOGG_ERROR("wrong size of ordering: ", new_order.size(), " - GraphFastRootSort<Graph_t>::reorder");
+			return -1;
+		}
 		gn.reset(NV);
 		gn.name(g_.name());
 		gn.path(g_.path());
 
 		///generate isomorphism (only for undirected graphs) 
-		for (auto i = 0u; i < NV - 1; i++) {
+		for (auto i = 0u; i + 1 < NV; i++) {
 			for (auto j = i + 1; j < NV; j++) {
 				if (g_.is_edge(i, j)) {									//in O(log) for sparse graphs, should be specialized for that case
 					//////////////////////////////////////////////
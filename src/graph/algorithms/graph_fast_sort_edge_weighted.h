@@ -99,6 +99,8 @@ namespace bitgraph {
 		case _mypt::MIN:
 		case _mypt::MAX_WITH_SUPPORT:
 		case _mypt::MIN_WITH_SUPPORT:
+		case _mypt::MAX_TRIANGLES:
+		case _mypt::MIN_TRIANGLES:
 
 			order = _mypt::new_order(alg, ltf, o2n);
 			break;
@@ -138,7 +140,7 @@ namespace bitgraph {
 		if (d != NULL) {
 			vint aux(new_order);
 			Decode::reverse_in_place(aux);								//maps [NEW] to [OLD]		
-			d->insert_ordering(aux);
+			d->add_ordering(aux);
 		}
 
 		/////////////////////
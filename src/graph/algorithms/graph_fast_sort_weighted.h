@@ -125,6 +125,8 @@ namespace bitgraph {
 		case ptype::MIN:
 		case ptype::MAX_WITH_SUPPORT:
 		case ptype::MIN_WITH_SUPPORT:
+		case ptype::MAX_TRIANGLES:
+		case ptype::MIN_TRIANGLES:
 
 			ptype::new_order(alg, ltf, o2n);				//sorts the graph according to non-weighted criteria
 			break;
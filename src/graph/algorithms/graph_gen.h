@@ -1,8 +1,9 @@
 /**
 * @file graph_gen.h
 * @brief header for Erdos-Renyi sparse and non sparse bitstring unidrected graph generation 
+*		 and structured random graph models (R-MAT, Barabasi-Albert, geometric, planted clique / partition)
 * @author pss
-* @details: created?, last_update 07/03/25
+* @details: created?, last_update 17/10/26
 * 
 * TODO - simplify class architecture for graph generation (07/03/25)
 **/
@@ -12,9 +13,14 @@
 
 #include <iostream>
 #include <sstream>
-#include <random>								
+#include <random>
+#include <atomic>
+#include <memory>
+#include <limits>
+#include <cmath>
 
 #include "utils/common.h"
+#include "utils/task.h"
 #include "graph/simple_ugraph.h"
 #include "graph/simple_graph_w.h"					// must be after simple_ugraph include
 #include "graph/simple_graph_ew.h"					// must be after simple_ugraph include
@@ -46,6 +52,17 @@ namespace bitgraph {
 		//////////////////
 
 		struct random_attr_t {
+
+			//graph models of the benchmark - the density p of the sweep is mapped to the parameters of each model
+			enum model_t {
+				UNIFORM = 0,				//G(n, p)
+				RMAT,						//p * n(n - 1)/2 R-MAT edge samples, (a, b, c) = (0.57, 0.19, 0.19)
+				BARABASI_ALBERT,			//max(1, p(n - 1)/2) edges per new vertex
+				GEOMETRIC,					//unit square, radius sqrt(p / PI)
+				PLANTED_CLIQUE,				//G(n, p) and a clique of size k
+				PLANTED_PARTITION			//k blocks, p inside the blocks and pOut between blocks
+			};
+
 			friend std::ostream& operator << (std::ostream& o, const random_attr_t& r) {
 				o << "[" << r.nLB << " " << r.nUB << " "
 					<< r.pLB << " " << r.pUB << " " << r.nRep << " "
@@ -74,6 +91,11 @@ namespace bitgraph {
 			std::size_t  nRep;					//number of repetitions
 			std::size_t  incN;					//increment of vertices
 			double incP;						//increment of densities
+
+			model_t model = UNIFORM;			//graph model
+			std::size_t k = 0;					//size of the planted clique (PLANTED_CLIQUE), number of blocks (PLANTED_PARTITION)
+			double pOut = 0.0;					//probability of edges between blocks (PLANTED_PARTITION)
+			uint64_t seed = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED;		//seed of the first repetition (not UNIFORM)
 		};
 	}//end of namespace _impl
 
@@ -116,6 +138,9 @@ namespace bitgraph {
 			*
 			*			II. names  r<n_<p>.txt
 			*
+			*			III. other graph models (rd.model) for undirected graphs, see GraphModelGen
+			*				 (repetition k has seed rd.seed + k, file names <model prefix><n>_<p>_<k>.txt)
+			*
 			* @param path input directory where the files are created
 			* @param rd input data to generate the benchmark
 			*
@@ -132,6 +157,13 @@ namespace bitgraph {
 			* @details: TODO - Unit test (14/04/2025)
 			**/
 			static int create_isomorphism(Graph_t& g_iso, Graph_t& g);
+
+		private:
+			using is_simple_ugraph = std::integral_constant<bool, std::is_same<Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<Ugraph<BBScanSp>, Graph_t>::value>;
+
+			static int create_model_graph(Graph_t& g, std::size_t n, double p, const random_attr_t& rd, uint64_t seed, std::true_type);
+			static int create_model_graph(Graph_t& g, std::size_t n, double p, const random_attr_t& rd, uint64_t seed, std::false_type);
 		};
 	}//end of namespace _impl	
 
@@ -197,6 +229,234 @@ namespace bitgraph {
 
 
 
+namespace bitgraph {
+	namespace _impl {
+		/////////////////
+		//
+		// class ParallelRandomGen
+		// (multi-threaded uniform random (n, p) undirected graphs in O(n + m))
+		//
+		// Edges (i, j), j > i, of each row are sampled with geometric skips [Batagelj and Brandes 2005]
+		// (non-edges for dense graphs with p > 0.5). Rows are grouped in blocks of 64 with an independent
+		// random stream each (Xoshiro256(seed, block)), so the graph only depends on (n, p, seed) and not
+		// on the number of threads. Threads take contiguous ranges of rows with a similar number of
+		// pairs, and write the rows directly:
+		//	- dense graphs: upper rows in place, lower rows by 64x64 bit tile transposition
+		//	- sparse graphs: sorted neighbor lists packed as bitblocks
+		//
+		//////////////////
+
+		template<class Graph_t>
+		class ParallelRandomGen {
+
+			static_assert(std::is_same<Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<Ugraph<BBScanSp>, Graph_t>::value, "ParallelRandomGen<Graph_t> requires Ugraph<BBScan> or Ugraph<BBScanSp>");
+
+		public:
+			template<class G> friend class GraphModelGen;
+
+			using is_dense = std::is_same<typename Graph_t::_bbt, BBScan>;
+			enum { ROW_BLOCK = 64 };											//rows per random stream
+
+			/*
+			* @brief generates uniform simple random graph (n, p), name r<n>_<p>.txt
+			* @param g output graph
+			* @param n number of vertices
+			* @param p probability of edge creation
+			* @param seed seed of the random streams
+			* @param nThreads number of threads (hardware threads if <= 0)
+			* @returns 0 if OK, -1 if ERROR
+			*/
+			static int create_graph(Graph_t& g, std::size_t n, double p,
+				uint64_t seed = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED, int nThreads = 0);
+
+			/*
+			* @brief in-place transposition of a 64x64 bit matrix (bit c of a[r] is entry (r, c))
+			*/
+			static void transpose64(BITBOARD a[64]);
+
+		private:
+
+			/*
+			* @brief calls @f(t, first, last) for @nThreads consecutive ranges of row blocks with a
+			*		 similar number of pairs (i, j), j > i (the calling thread takes the first range)
+			*/
+			template<class Func>
+			static void parallel_rows(std::size_t n, int nThreads, Func f);
+
+			/*
+			* @brief calls @f(t, first, last) for @nThreads consecutive ranges of [0, @nItems) with a similar
+			*		 cost, where @cost(b) is the cost of items [0, b) (the calling thread takes the first range)
+			*/
+			template<class Cost, class Func>
+			static void parallel_ranges(std::size_t nItems, int nThreads, Cost cost, Func f);
+
+			/*
+			* @brief calls @f(j) for every sampled j in (i, n) (geometric skips of parameter p)
+			* @param logq: log(1 - p)
+			*/
+			template<class Func>
+			static void sample_row(_rand::Xoshiro256& rng, std::size_t i, std::size_t n, double logq, Func f);
+
+			static void generate(Graph_t& g, std::size_t n, double p, uint64_t seed, int nThreads, std::true_type /* dense */);
+			static void generate(Graph_t& g, std::size_t n, double p, uint64_t seed, int nThreads, std::false_type /* sparse */);
+		};
+	}//end of namespace _impl
+
+	using _impl::ParallelRandomGen;		//alias for ParallelRandomGen<Graph_t>
+}//end of namespace bitgraph
+
+namespace bitgraph {
+	namespace _impl {
+		/////////////////
+		//
+		// class GraphModelGen
+		// (multi-threaded structured random undirected graphs for benchmarking)
+		//
+		//	- R-MAT [Chakrabarti et al. 2004]
+		//	- Barabasi-Albert preferential attachment, as the edge list copy model of [Batagelj and Brandes 2005]
+		//	  with hashed random choices so that edges are independent [Sanders and Schulz 2016]
+		//	- random geometric graphs in the unit square (grid bucketing)
+		//	- planted clique and planted partition instances
+		//
+		// As in ParallelRandomGen, random choices are taken from streams indexed by the unit of work (edge,
+		// vertex or row block), so the graph only depends on the parameters and the seed, not on the
+		// number of threads. Edges generated in arbitrary order are bucketed by the owner thread of
+		// each endpoint, which then writes its rows (bit blocks for dense graphs, sorted lists for sparse
+		// graphs). Self-loops and repeated edges are dropped.
+		//
+		//////////////////
+
+		template<class Graph_t>
+		class GraphModelGen {
+
+			static_assert(std::is_same<Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<Ugraph<BBScanSp>, Graph_t>::value, "GraphModelGen<Graph_t> requires Ugraph<BBScan> or Ugraph<BBScanSp>");
+
+		public:
+			using is_dense = std::is_same<typename Graph_t::_bbt, BBScan>;
+			using point_t = std::pair<double, double>;
+			enum { EDGE_CHUNK = 1 << 14 };										//edges per unit of work
+
+			/*
+			* @brief R-MAT graph - each of the @m edge samples descends the quadrants of the adjacency
+			*		 matrix with probabilities (a, b, c, 1 - a - b - c) (samples outside [0, n) are dropped)
+			*
+			*		 name rmat<n>_<m>.txt
+			*
+			* @param m number of edge samples (upper bound of the number of edges)
+			* @returns 0 if OK, -1 if ERROR
+			*/
+			static int create_rmat(Graph_t& g, std::size_t n, std::size_t m, double a = 0.57, double b = 0.19, double c = 0.19,
+				uint64_t seed = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED, int nThreads = 0);
+
+			/*
+			* @brief Barabasi-Albert graph - every vertex v > 0 links to @d earlier vertices with
+			*		 probability proportional to their degree (power law degree distribution, exponent 3)
+			*
+			*		 name ba<n>_<d>.txt
+			*
+			* @returns 0 if OK, -1 if ERROR
+			*/
+			static int create_barabasi_albert(Graph_t& g, std::size_t n, std::size_t d,
+				uint64_t seed = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED, int nThreads = 0);
+
+			/*
+			* @brief random geometric graph - points uniform in the unit square, edges between points at
+			*		 (euclidean) distance at most @r. The point of vertex v is geometric_point(seed, v).
+			*
+			*		 name rgg<n>_<r>.txt
+			*
+			* @returns 0 if OK, -1 if ERROR
+			*/
+			static int create_geometric(Graph_t& g, std::size_t n, double r,
+				uint64_t seed = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED, int nThreads = 0);
+
+			/*
+			* @brief G(n, p) with a clique on @k random vertices (the maximum clique w.h.p. when @k
+			*		 is well above 2 log(n) / log(1/p))
+			*
+			*		 name pc<n>_<p>_<k>.txt
+			*
+			* @param clq output planted clique (sorted)
+			* @returns 0 if OK, -1 if ERROR
+			*/
+			static int create_planted_clique(Graph_t& g, std::size_t n, double p, std::size_t k, vint& clq,
+				uint64_t seed = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED, int nThreads = 0);
+
+			/*
+			* @brief planted partition - @nParts blocks of consecutive vertices (sizes differ at most by one),
+			*		 edges with probability @pIn inside blocks and @pOut between blocks (with pIn = 1, the blocks
+			*		 are cliques; with pIn = 0 they are a proper coloring)
+			*
+			*		 name pp<n>_<nParts>_<pIn>_<pOut>.txt
+			*
+			* @returns 0 if OK, -1 if ERROR
+			*/
+			static int create_planted_partition(Graph_t& g, std::size_t n, std::size_t nParts, double pIn, double pOut,
+				uint64_t seed = _rand::RandomUniformGen<>::FIXED_RANDOM_SEED, int nThreads = 0);
+
+			/*
+			* @brief graph of model @rd.model with n vertices and density parameter p (see random_attr_t)
+			* @returns 0 if OK, -1 if ERROR
+			*/
+			static int create_graph(Graph_t& g, std::size_t n, double p, const random_attr_t& rd, uint64_t seed, int nThreads = 0);
+
+			/*
+			* @brief point of vertex @v in the unit square of the geometric graphs with seed @seed
+			*/
+			static point_t geometric_point(uint64_t seed, std::size_t v);
+
+			/*
+			* @brief first block of the planted partition of n vertices in nParts blocks
+			*/
+			static std::size_t block_begin(std::size_t n, std::size_t nParts, std::size_t b) { return (n * b) / nParts; }
+
+		private:
+
+			/*
+			* @brief uniform random double in (0, 1] determined by (seed, i)
+			*/
+			static double hash_uniform(uint64_t seed, uint64_t i);
+
+			/*
+			* @brief sink of the edges of a thread in build_from_edges - bucketed by the owner of each endpoint
+			*		 (self-loops and endpoints out of range are discarded)
+			*/
+			struct edgeEmitter {
+				using edge_t = std::pair<int, int>;
+
+				std::vector<std::vector<edge_t>>& bucket;
+				std::size_t n;
+				std::size_t span;
+
+				void operator()(std::size_t u, std::size_t v) {
+					if (u == v || u >= n || v >= n) { return; }
+					bucket[u / span].emplace_back(static_cast<int>(u), static_cast<int>(v));
+					bucket[v / span].emplace_back(static_cast<int>(v), static_cast<int>(u));
+				}
+			};
+
+			/*
+			* @brief writes the edges {u, v} emitted by @gen(chunk, emit) for chunk in [0, nChunks) into g, reset to n vertices
+			*		 (@gen is callable as gen(std::size_t chunk, edgeEmitter& emit))
+			*/
+			template<class EdgeGen>
+			static void build_from_edges(Graph_t& g, std::size_t n, std::size_t nChunks, int nThreads, EdgeGen gen);
+
+			/*
+			* @brief writes the sorted neighbors [first, last) in row v
+			*/
+			template<class It>
+			static void write_row(Graph_t& g, std::size_t v, It first, It last, std::true_type /* dense */);
+			template<class It>
+			static void write_row(Graph_t& g, std::size_t v, It first, It last, std::false_type /* sparse */);
+		};
+	}//end of namespace _impl
+
+	using _impl::GraphModelGen;		//alias for GraphModelGen<Graph_t>
+}//end of namespace bitgraph
+
 namespace bitgraph {
 	namespace _impl {
 		/////////////////
@@ -323,16 +583,25 @@ namespace bitgraph{
 		std::string mypath(path);
 		_dir::append_slash(mypath);
 
+		//file name prefix of each graph model
+		static const char* prefix[] = { "r", "rmat", "ba", "rgg", "pc", "pp" };
+
 		for (int i = rd.nLB; i <= rd.nUB; i += rd.incN) {
 			for (double j = rd.pLB; j <= rd.pUB; j += rd.incP) {
 				for (int k = 0; k < rd.nRep; k++) {
 
 					//////////////////////////
-					create_graph(g, i, j);
+					if (rd.model == random_attr_t::UNIFORM) {
+						create_graph(g, i, j);
+					}
+					else if (create_model_graph(g, i, j, rd, rd.seed + k, is_simple_ugraph()) == -1) {
+						LOGG_ERROR("error generating graph model ", rd.model, " - RandomGen<Graph_t>::create_graph_benchmark");
+						return -1;
+					}
 					//////////////////////////
 
 					o.str("");
-					o << mypath.c_str() << "r" << i << "_" << j << "_" << k << ".txt";
+					o << mypath.c_str() << prefix[rd.model] << i << "_" << j << "_" << k << ".txt";
 					f.open(o.str().c_str());
 					if (!f) {
 						LOGG_ERROR("error in file name: ", o.str(), "- RandomGen<Graph_t>::create_graph_benchmark");
@@ -346,6 +615,19 @@ namespace bitgraph{
 		return 0;		//OK
 	}
 
+	template<class Graph_t>
+	inline
+		int RandomGen<Graph_t>::create_model_graph(Graph_t& g, std::size_t n, double p, const random_attr_t& rd, uint64_t seed, std::true_type) {
+		return GraphModelGen<Graph_t>::create_graph(g, n, p, rd, seed);
+	}
+
+	template<class Graph_t>
+	inline
+		int RandomGen<Graph_t>::create_model_graph(Graph_t&, std::size_t, double, const random_attr_t&, uint64_t, std::false_type) {
+		LOG_ERROR("graph models are only available for Ugraph<BBScan> and Ugraph<BBScanSp> - RandomGen<Graph_t>::create_model_graph");
+		return -1;
+	}
+
 	template<class Graph_t>
 	inline
 		int RandomGen<Graph_t>::create_isomorphism(Graph_t& g_iso, Graph_t& g_ori)
@@ -442,6 +724,577 @@ namespace bitgraph{
 		return 0;
 	}
 
+	template<class Graph_t>
+	inline
+		int ParallelRandomGen<Graph_t>::create_graph(Graph_t& g, std::size_t n, double p, uint64_t seed, int nThreads) {
+
+		if (n == 0) {
+			LOG_ERROR("bad number of vertices - ParallelRandomGen<Graph_t>::create_graph");
+			return -1;
+		}
+
+		if (g.reset(n) == -1) {
+			LOG_ERROR("error during allocation - ParallelRandomGen<Graph_t>::create_graph");
+			return -1;
+		}
+
+		const std::size_t nBlocks = (n + ROW_BLOCK - 1) / ROW_BLOCK;
+		nThreads = com::thread_count(nThreads, nBlocks);
+
+		//////////////////
+		if (p > 0.0) {
+			generate(g, n, std::min(p, 1.0), seed, nThreads, is_dense());
+		}
+		//////////////////
+
+		//name - r<n>_<p>.txt
+		std::stringstream sstr;
+		sstr << "r" << n << "_" << p << ".txt";
+		g.name(sstr.str());
+
+		return 0;
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void ParallelRandomGen<Graph_t>::parallel_rows(std::size_t n, int nThreads, Func f) {
+
+		//pairs of rows [0, i) are i(2n - i - 1)/2
+		const std::size_t nBlocks = (n + ROW_BLOCK - 1) / ROW_BLOCK;
+		parallel_ranges(nBlocks, nThreads, [n](std::size_t b) {
+			const double i = static_cast<double>(std::min(n, b * ROW_BLOCK));
+			return 0.5 * i * (2.0 * n - i - 1.0);
+		}, f);
+	}
+
+	template<class Graph_t>
+	template<class Cost, class Func>
+	inline
+		void ParallelRandomGen<Graph_t>::parallel_ranges(std::size_t nItems, int nThreads, Cost cost, Func f) {
+
+		const double total = cost(nItems);
+		std::vector<std::size_t> bound(nThreads + 1, nItems);
+		bound[0] = 0;
+		std::size_t b = 0;
+		for (auto t = 1; t < nThreads; ++t) {
+			const double target = total * t / nThreads;
+			while (b < nItems && cost(b) < target) { ++b; }
+			bound[t] = b;
+		}
+
+		com::run_parallel(nThreads, [&f, &bound](int t) { f(t, bound[t], bound[t + 1]); });
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void ParallelRandomGen<Graph_t>::sample_row(_rand::Xoshiro256& rng, std::size_t i, std::size_t n, double logq, Func f) {
+
+		//p = 0
+		if (logq == 0.0) {
+			return;
+		}
+
+		//p = 1
+		if (logq == -std::numeric_limits<double>::infinity()) {
+			for (auto j = i + 1; j < n; ++j) { f(j); }
+			return;
+		}
+
+		double j = static_cast<double>(i);
+		while (true) {
+			j += 1.0 + std::floor(std::log(rng.uniform_pos()) / logq);
+			if (j >= static_cast<double>(n)) { break; }
+			f(static_cast<std::size_t>(j));
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void ParallelRandomGen<Graph_t>::transpose64(BITBOARD a[64]) {
+
+		//recursive block swaps [Warren, Hacker's Delight 7-3]
+		BITBOARD m = 0x00000000FFFFFFFFULL;
+		for (int j = 32; j != 0; j >>= 1, m ^= (m << j)) {
+			for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+				BITBOARD t = ((a[k] >> j) ^ a[k | j]) & m;
+				a[k] ^= (t << j);
+				a[k | j] ^= t;
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void ParallelRandomGen<Graph_t>::generate(Graph_t& g, std::size_t n, double p, uint64_t seed, int nThreads, std::true_type) {
+
+		//dense graphs with p > 0.5 - sample non-edges
+		const bool complement = (p > 0.5);
+		const double logq = complement ? std::log(p) : std::log1p(-p);
+
+		//I. upper rows
+		parallel_rows(n, nThreads, [&](int, std::size_t first, std::size_t last) {
+			for (auto blk = first; blk < last; ++blk) {
+				_rand::Xoshiro256 rng(seed, blk);
+				const std::size_t iEnd = std::min(n, (blk + 1) * ROW_BLOCK);
+				for (auto i = blk * ROW_BLOCK; i < iEnd; ++i) {
+					auto& row = g.neighbors(i);
+					if (complement && i + 1 < n) {
+						row.set_bit(static_cast<int>(i + 1), static_cast<int>(n - 1));
+						sample_row(rng, i, n, logq, [&row](std::size_t j) {
+							row.block(WDIV(j)) &= ~bblock::MASK_BIT(WMOD(j));
+						});
+					}
+					else if (!complement) {
+						sample_row(rng, i, n, logq, [&row](std::size_t j) {
+							row.block(WDIV(j)) |= bblock::MASK_BIT(WMOD(j));
+						});
+					}
+				}
+			}
+		});
+
+		//II. lower rows - tile (J, I), I <= J, is the transpose of tile (I, J)
+		//	  (J + 1 tiles in column J - tiles of columns [0, J) are J(J + 1)/2)
+		const std::size_t nWords = (n + 63) / 64;
+		parallel_ranges(nWords, nThreads, [](std::size_t J) { return 0.5 * J * (J + 1.0); },
+			[&](int, std::size_t first, std::size_t last) {
+				BITBOARD tile[64];
+				for (auto J = first; J < last; ++J) {
+					for (std::size_t I = 0; I <= J; ++I) {
+						for (auto r = 0; r < 64; ++r) {
+							const std::size_t i = I * 64 + r;
+							tile[r] = (i < n) ? g.neighbors(i).block(static_cast<int>(J)) : 0;
+						}
+						transpose64(tile);
+						for (auto r = 0; r < 64; ++r) {
+							const std::size_t j = J * 64 + r;
+							if (j < n) { g.neighbors(j).block(static_cast<int>(I)) |= tile[r]; }
+						}
+					}
+				}
+			});
+
+	}
+
+	template<class Graph_t>
+	inline
+		void ParallelRandomGen<Graph_t>::generate(Graph_t& g, std::size_t n, double p, uint64_t seed, int nThreads, std::false_type) {
+
+		const double logq = std::log1p(-p);
+
+		//I. upper neighbor lists of each thread (rows in increasing order)
+		std::vector<vint> up(nThreads);
+		std::vector<std::vector<std::size_t>> upStart(nThreads);
+		std::vector<std::size_t> firstRow(nThreads + 1, n);
+		std::unique_ptr<std::atomic<int>[]> deg(new std::atomic<int>[n]);
+		for (std::size_t v = 0; v < n; ++v) { deg[v].store(0, std::memory_order_relaxed); }
+
+		parallel_rows(n, nThreads, [&](int t, std::size_t first, std::size_t last) {
+			const std::size_t iBeg = std::min(n, first * ROW_BLOCK);
+			const std::size_t iEnd = std::min(n, last * ROW_BLOCK);
+			firstRow[t] = iBeg;
+			upStart[t].reserve(iEnd - iBeg + 1);
+			for (auto blk = first; blk < last; ++blk) {
+				_rand::Xoshiro256 rng(seed, blk);
+				const std::size_t bEnd = std::min(n, (blk + 1) * ROW_BLOCK);
+				for (auto i = blk * ROW_BLOCK; i < bEnd; ++i) {
+					upStart[t].push_back(up[t].size());
+					sample_row(rng, i, n, logq, [&](std::size_t j) {
+						up[t].push_back(static_cast<int>(j));
+						deg[j].fetch_add(1, std::memory_order_relaxed);
+					});
+				}
+			}
+			upStart[t].push_back(up[t].size());
+		});
+
+		//II. lower neighbor lists - scatter with atomic cursors
+		std::vector<std::size_t> lowStart(n + 1, 0);
+		for (std::size_t v = 0; v < n; ++v) {
+			lowStart[v + 1] = lowStart[v] + deg[v].load(std::memory_order_relaxed);
+			deg[v].store(0, std::memory_order_relaxed);
+		}
+		vint low(lowStart[n]);
+
+		parallel_rows(n, nThreads, [&](int t, std::size_t, std::size_t) {
+			const std::size_t nRows = upStart[t].size() - 1;
+			for (std::size_t k = 0; k < nRows; ++k) {
+				const int i = static_cast<int>(firstRow[t] + k);
+				for (auto e = upStart[t][k]; e < upStart[t][k + 1]; ++e) {
+					const int j = up[t][e];
+					low[lowStart[j] + deg[j].fetch_add(1, std::memory_order_relaxed)] = i;
+				}
+			}
+		});
+
+		//III. rows - sorted lower neighbors, then upper neighbors, packed in bitblocks
+		parallel_rows(n, nThreads, [&](int t, std::size_t, std::size_t) {
+			const std::size_t nRows = upStart[t].size() - 1;
+			for (std::size_t k = 0; k < nRows; ++k) {
+				const std::size_t i = firstRow[t] + k;
+				std::sort(low.begin() + lowStart[i], low.begin() + lowStart[i + 1]);
+
+				auto& vBB = g.neighbors(i).bitset();
+				auto add = [&vBB](int j) {
+					const int idx = WDIV(j);
+					if (vBB.empty() || vBB.back().idx_ != idx) { vBB.emplace_back(idx, 0); }
+					vBB.back().bb_ |= bblock::MASK_BIT(WMOD(j));
+				};
+				for (auto e = lowStart[i]; e < lowStart[i + 1]; ++e) { add(low[e]); }
+				for (auto e = upStart[t][k]; e < upStart[t][k + 1]; ++e) { add(up[t][e]); }
+			}
+		});
+
+	}
+
+	template<class Graph_t>
+	inline
+		double GraphModelGen<Graph_t>::hash_uniform(uint64_t seed, uint64_t i) {
+		uint64_t x = seed ^ (i * 0xD1B54A32D192ED03ULL);
+		return ((_rand::Xoshiro256::splitmix64(x) >> 11) + 1) * (1.0 / 9007199254740992.0);
+	}
+
+	template<class Graph_t>
+	template<class It>
+	inline
+		void GraphModelGen<Graph_t>::write_row(Graph_t& g, std::size_t v, It first, It last, std::true_type) {
+		auto& row = g.neighbors(v);
+		for (; first != last; ++first) {
+			row.block(WDIV(*first)) |= bblock::MASK_BIT(WMOD(*first));
+		}
+	}
+
+	template<class Graph_t>
+	template<class It>
+	inline
+		void GraphModelGen<Graph_t>::write_row(Graph_t& g, std::size_t v, It first, It last, std::false_type) {
+		auto& vBB = g.neighbors(v).bitset();
+		vBB.clear();
+		for (; first != last; ++first) {
+			const int idx = WDIV(*first);
+			if (vBB.empty() || vBB.back().idx_ != idx) { vBB.emplace_back(idx, 0); }
+			vBB.back().bb_ |= bblock::MASK_BIT(WMOD(*first));
+		}
+	}
+
+	template<class Graph_t>
+	template<class EdgeGen>
+	inline
+		void GraphModelGen<Graph_t>::build_from_edges(Graph_t& g, std::size_t n, std::size_t nChunks, int nThreads, EdgeGen gen) {
+
+		//vertices [t * span, (t + 1) * span) are written by thread t
+		const std::size_t span = (n + nThreads - 1) / nThreads;
+		using edge_t = typename edgeEmitter::edge_t;
+		std::vector<std::vector<std::vector<edge_t>>> bucket(nThreads, std::vector<std::vector<edge_t>>(nThreads));
+
+		//I. edges of each chunk, bucketed by the owner of each endpoint
+		std::atomic<std::size_t> cursor(0);
+		com::run_parallel(nThreads, [&](int t) {
+			edgeEmitter emit{ bucket[t], n, span };
+			std::size_t c;
+			while ((c = cursor.fetch_add(1, std::memory_order_relaxed)) < nChunks) {
+				gen(c, emit);
+			}
+		});
+
+		//II. rows of each owner
+		com::run_parallel(nThreads, [&](int t) {
+			std::vector<edge_t> edges;
+			std::size_t nEdges = 0;
+			for (auto s = 0; s < nThreads; ++s) { nEdges += bucket[s][t].size(); }
+			edges.reserve(nEdges);
+			for (auto s = 0; s < nThreads; ++s) {
+				edges.insert(edges.end(), bucket[s][t].begin(), bucket[s][t].end());
+				std::vector<edge_t>().swap(bucket[s][t]);
+			}
+			std::sort(edges.begin(), edges.end());
+			edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+			vint nb;
+			for (std::size_t e = 0; e < edges.size(); ) {
+				const int v = edges[e].first;
+				nb.clear();
+				for (; e < edges.size() && edges[e].first == v; ++e) { nb.push_back(edges[e].second); }
+				write_row(g, v, nb.begin(), nb.end(), is_dense());
+			}
+		});
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphModelGen<Graph_t>::create_rmat(Graph_t& g, std::size_t n, std::size_t m, double a, double b, double c, uint64_t seed, int nThreads) {
+
+		if (n == 0 || a < 0 || b < 0 || c < 0 || a + b + c > 1.0) {
+			LOG_ERROR("bad parameters - GraphModelGen<Graph_t>::create_rmat");
+			return -1;
+		}
+		if (g.reset(n) == -1) {
+			LOG_ERROR("error during allocation - GraphModelGen<Graph_t>::create_rmat");
+			return -1;
+		}
+
+		int scale = 0;
+		while ((std::size_t(1) << scale) < n) { ++scale; }
+		const double ab = a + b, abc = a + b + c;
+
+		const std::size_t nChunks = (m + EDGE_CHUNK - 1) / EDGE_CHUNK;
+		nThreads = com::thread_count(nThreads, nChunks);
+
+		//////////////////
+		build_from_edges(g, n, nChunks, nThreads, [&](std::size_t chunk, edgeEmitter& emit) {
+			_rand::Xoshiro256 rng(seed, chunk);
+			const std::size_t eEnd = std::min(m, (chunk + 1) * EDGE_CHUNK);
+			for (auto e = chunk * EDGE_CHUNK; e < eEnd; ++e) {
+				std::size_t u = 0, v = 0;
+				for (auto bit = std::size_t(1) << scale; bit >>= 1; ) {
+					const double r = rng.uniform_pos();
+					if (r > abc) { u |= bit; v |= bit; }
+					else if (r > ab) { u |= bit; }
+					else if (r > a) { v |= bit; }
+				}
+				emit(u, v);
+			}
+		});
+		//////////////////
+
+		std::stringstream sstr;
+		sstr << "rmat" << n << "_" << m << ".txt";
+		g.name(sstr.str());
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphModelGen<Graph_t>::create_barabasi_albert(Graph_t& g, std::size_t n, std::size_t d, uint64_t seed, int nThreads) {
+
+		if (n == 0 || d == 0) {
+			LOG_ERROR("bad parameters - GraphModelGen<Graph_t>::create_barabasi_albert");
+			return -1;
+		}
+		if (g.reset(n) == -1) {
+			LOG_ERROR("error during allocation - GraphModelGen<Graph_t>::create_barabasi_albert");
+			return -1;
+		}
+
+		//edge e = v * d + s of vertex v has endpoints at positions 2e (v) and 2e + 1, which copies the
+		//endpoint at a uniform position in [0, 2e) - resolved backwards, since every choice is a hash of e
+		auto target = [seed](std::size_t e) -> std::size_t {
+			std::size_t pos = 2 * e + 1;
+			while (pos & 0x1) {
+				const std::size_t e2 = pos / 2;
+				if (e2 == 0) { return 0; }
+				pos = std::min(2 * e2 - 1, static_cast<std::size_t>(hash_uniform(seed, e2) * (2 * e2)));
+			}
+			return pos / 2;					//edge of the source endpoint
+		};
+
+		const std::size_t m = n * d;
+		const std::size_t nChunks = (m + EDGE_CHUNK - 1) / EDGE_CHUNK;
+		nThreads = com::thread_count(nThreads, nChunks);
+
+		//////////////////
+		build_from_edges(g, n, nChunks, nThreads, [&](std::size_t chunk, edgeEmitter& emit) {
+			const std::size_t eEnd = std::min(m, (chunk + 1) * EDGE_CHUNK);
+			for (auto e = chunk * EDGE_CHUNK; e < eEnd; ++e) {
+				emit(e / d, target(e) / d);
+			}
+		});
+		//////////////////
+
+		std::stringstream sstr;
+		sstr << "ba" << n << "_" << d << ".txt";
+		g.name(sstr.str());
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		typename GraphModelGen<Graph_t>::point_t GraphModelGen<Graph_t>::geometric_point(uint64_t seed, std::size_t v) {
+		return point_t(1.0 - hash_uniform(seed, 2 * v), 1.0 - hash_uniform(seed, 2 * v + 1));
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphModelGen<Graph_t>::create_geometric(Graph_t& g, std::size_t n, double r, uint64_t seed, int nThreads) {
+
+		if (n == 0 || r < 0) {
+			LOG_ERROR("bad parameters - GraphModelGen<Graph_t>::create_geometric");
+			return -1;
+		}
+		if (g.reset(n) == -1) {
+			LOG_ERROR("error during allocation - GraphModelGen<Graph_t>::create_geometric");
+			return -1;
+		}
+
+		//grid of G x G cells of side at least r (and at most n cells)
+		std::size_t G = (r > 0) ? static_cast<std::size_t>(std::min(1.0 / r, std::sqrt(static_cast<double>(n)))) : 1;
+		G = std::max<std::size_t>(G, 1);
+		auto cell = [G](double x) { return std::min(G - 1, static_cast<std::size_t>(x * G)); };
+
+		//points bucketed by cell (counting sort)
+		std::vector<point_t> pt(n);
+		vint cellOf(n);
+		std::vector<std::size_t> start(G * G + 1, 0);
+		for (std::size_t v = 0; v < n; ++v) {
+			pt[v] = geometric_point(seed, v);
+			cellOf[v] = static_cast<int>(cell(pt[v].first) * G + cell(pt[v].second));
+			++start[cellOf[v] + 1];
+		}
+		for (std::size_t c = 0; c < G * G; ++c) { start[c + 1] += start[c]; }
+		vint member(n);
+		{
+			std::vector<std::size_t> pos(start.begin(), start.end() - 1);
+			for (std::size_t v = 0; v < n; ++v) { member[pos[cellOf[v]]++] = static_cast<int>(v); }
+		}
+
+		//////////////////
+		//rows - every thread writes its own range of vertices
+		nThreads = com::thread_count(nThreads, n / ParallelRandomGen<Graph_t>::ROW_BLOCK);
+		const std::size_t span = (n + nThreads - 1) / nThreads;
+		const double r2 = r * r;
+		com::run_parallel(nThreads, [&](int t) {
+			vint nb;
+			const std::size_t vEnd = std::min(n, (t + 1) * span);
+			for (auto v = t * span; v < vEnd; ++v) {
+				nb.clear();
+				const long long cx = cellOf[v] / G, cy = cellOf[v] % G;
+				for (long long x = std::max(cx - 1, 0LL); x <= std::min(cx + 1, static_cast<long long>(G) - 1); ++x) {
+					for (long long y = std::max(cy - 1, 0LL); y <= std::min(cy + 1, static_cast<long long>(G) - 1); ++y) {
+						const std::size_t c = x * G + y;
+						for (auto k = start[c]; k < start[c + 1]; ++k) {
+							const int w = member[k];
+							const double dx = pt[v].first - pt[w].first, dy = pt[v].second - pt[w].second;
+							if (w != static_cast<int>(v) && dx * dx + dy * dy <= r2) { nb.push_back(w); }
+						}
+					}
+				}
+				std::sort(nb.begin(), nb.end());
+				write_row(g, v, nb.begin(), nb.end(), is_dense());
+			}
+		});
+		//////////////////
+
+		std::stringstream sstr;
+		sstr << "rgg" << n << "_" << r << ".txt";
+		g.name(sstr.str());
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphModelGen<Graph_t>::create_planted_clique(Graph_t& g, std::size_t n, double p, std::size_t k, vint& clq, uint64_t seed, int nThreads) {
+
+		clq.clear();
+		if (k > n) {
+			LOG_ERROR("planted clique larger than the graph - GraphModelGen<Graph_t>::create_planted_clique");
+			return -1;
+		}
+		if (ParallelRandomGen<Graph_t>::create_graph(g, n, p, seed, nThreads) == -1) {
+			LOG_ERROR("error during generation - GraphModelGen<Graph_t>::create_planted_clique");
+			return -1;
+		}
+
+		//k random vertices (partial Fisher-Yates, stream ~0 is not used by the row blocks)
+		vint perm(n);
+		std::iota(perm.begin(), perm.end(), 0);
+		_rand::Xoshiro256 rng(seed, ~uint64_t(0));
+		for (std::size_t i = 0; i < k; ++i) {
+			const std::size_t j = i + static_cast<std::size_t>((1.0 - rng.uniform_pos()) * (n - i));
+			std::swap(perm[i], perm[std::min(j, n - 1)]);
+		}
+		clq.assign(perm.begin(), perm.begin() + k);
+		std::sort(clq.begin(), clq.end());
+
+		//////////////////
+		nThreads = com::thread_count(nThreads, k);
+		com::run_parallel(nThreads, [&](int t) {
+			for (std::size_t i = t; i < k; i += nThreads) {
+				auto& row = g.neighbors(clq[i]);
+				for (auto w : clq) {
+					if (w != clq[i]) { row.set_bit(w); }
+				}
+			}
+		});
+		//////////////////
+
+		std::stringstream sstr;
+		sstr << "pc" << n << "_" << p << "_" << k << ".txt";
+		g.name(sstr.str());
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphModelGen<Graph_t>::create_planted_partition(Graph_t& g, std::size_t n, std::size_t nParts, double pIn, double pOut, uint64_t seed, int nThreads) {
+
+		if (n == 0 || nParts == 0 || nParts > n) {
+			LOG_ERROR("bad parameters - GraphModelGen<Graph_t>::create_planted_partition");
+			return -1;
+		}
+		if (g.reset(n) == -1) {
+			LOG_ERROR("error during allocation - GraphModelGen<Graph_t>::create_planted_partition");
+			return -1;
+		}
+
+		//log(1 - p), 0 if p <= 0
+		auto logq = [](double p) {
+			return (p >= 1.0) ? -std::numeric_limits<double>::infinity() : std::log1p(-std::max(p, 0.0));
+		};
+		const double logqIn = logq(pIn), logqOut = logq(pOut);
+
+		//upper edges of each row block, as in ParallelRandomGen
+		using prg = ParallelRandomGen<Graph_t>;
+		const std::size_t nBlocks = (n + prg::ROW_BLOCK - 1) / prg::ROW_BLOCK;
+		nThreads = com::thread_count(nThreads, nBlocks);
+
+		//////////////////
+		build_from_edges(g, n, nBlocks, nThreads, [&](std::size_t blk, edgeEmitter& emit) {
+			_rand::Xoshiro256 rng(seed, blk);
+			const std::size_t iEnd = std::min(n, (blk + 1) * prg::ROW_BLOCK);
+			std::size_t b = (blk * prg::ROW_BLOCK * nParts) / n;
+			for (auto i = blk * prg::ROW_BLOCK; i < iEnd; ++i) {
+				while (block_begin(n, nParts, b + 1) <= i) { ++b; }
+				const std::size_t bEnd = block_begin(n, nParts, b + 1);
+				prg::sample_row(rng, i, bEnd, logqIn, [&](std::size_t j) { emit(i, j); });
+				prg::sample_row(rng, bEnd - 1, n, logqOut, [&](std::size_t j) { emit(i, j); });
+			}
+		});
+		//////////////////
+
+		std::stringstream sstr;
+		sstr << "pp" << n << "_" << nParts << "_" << pIn << "_" << pOut << ".txt";
+		g.name(sstr.str());
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphModelGen<Graph_t>::create_graph(Graph_t& g, std::size_t n, double p, const random_attr_t& rd, uint64_t seed, int nThreads) {
+
+		switch (rd.model) {
+		case random_attr_t::UNIFORM:
+			return ParallelRandomGen<Graph_t>::create_graph(g, n, p, seed, nThreads);
+		case random_attr_t::RMAT:
+			return create_rmat(g, n, static_cast<std::size_t>(p * n * (n - 1.0) / 2 + 0.5), 0.57, 0.19, 0.19, seed, nThreads);
+		case random_attr_t::BARABASI_ALBERT:
+			return create_barabasi_albert(g, n, std::max<std::size_t>(1, static_cast<std::size_t>(p * (n - 1.0) / 2 + 0.5)), seed, nThreads);
+		case random_attr_t::GEOMETRIC:
+			return create_geometric(g, n, std::sqrt(p / 3.14159265358979323846), seed, nThreads);
+		case random_attr_t::PLANTED_CLIQUE:
+		{
+			vint clq;
+			return create_planted_clique(g, n, p, rd.k, clq, seed, nThreads);
+		}
+		case random_attr_t::PLANTED_PARTITION:
+			return create_planted_partition(g, n, rd.k, p, rd.pOut, seed, nThreads);
+		default:
+			LOG_ERROR("unknown graph model - GraphModelGen<Graph_t>::create_graph");
+		}
+		return -1;
+	}
+
 	template<class Graph_t>
 	inline
 		int WeightGen<Graph_t>::create_weights(Graph_t& g, type_t type, int wmod, std::string FILE_EXTENSION, std::string FILE_PATH) {
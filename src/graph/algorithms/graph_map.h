@@ -3,7 +3,8 @@
 * @brief header for GraphMap class which manages pairs of vertex orderings
 * @update conversions between two isomporphic graphs encoded by GRAPH (14/8/17)
 * @update extended to inlcude mapping to a single sorting (1/10/17)
-* @last_update 27/01/25
+* @update bulk remapping of bitsets - block scatter and parallel gather with the inverse mapping (17/10/2026)
+* @last_update 17/10/2026
 * @author pss
 **/
 
@@ -11,11 +12,15 @@
 #define	__GRAPH_MAPPINGS_H__
 
 #include "utils/logger.h"
+#include "utils/task.h"
 #include "utils/common.h"
 #include "decode.h"
 #include <iostream>
 #include <vector>
 #include <string>
+#include <atomic>
+#include <algorithm>
+#include <type_traits>
 
 namespace bitgraph {
 	namespace _impl {
@@ -30,6 +35,7 @@ namespace bitgraph {
 
 		public:
 			enum print_t { L2R = 0, R2L, BOTH };		//streaming configuration
+			enum { PAR_TILE = 256 };					//destination bitblocks per task (parallel remapping)
 
 			///////////////////////
 			//setters and getters
@@ -42,9 +48,24 @@ namespace bitgraph {
 			string nameL() { return nameL_; }
 			string nameR() { return nameR_; }
 
-			//sets mapping (no need to build it)
-			void set_l2r(vint& l, std::string name) { l2r_ = l; nameL_ = name; }
-			void set_r2l(vint& r, std::string name) { r2l_ = r; nameR_ = name; }
+			//sets mapping (no need to build it) - the other mapping is its inverse if @inverse is TRUE,
+			//otherwise the inverse is no longer valid (see cache_inverse())
+			void set_l2r(vint& l, std::string name, bool inverse = false) { l2r_ = l; nameL_ = name; if (inverse) { cache_inverse(); } else { inverse_ = false; } }
+			void set_r2l(vint& r, std::string name, bool inverse = false) { r2l_ = r; nameR_ = name; if (inverse) { l2r_ = inverse_of(r2l_); inverse_ = true; } else { inverse_ = false; } }
+
+			/*
+			* @brief caches r2l_ as the inverse of l2r_ (required by the parallel remapping)
+			* @details: partial mappings - vertices mapped to EMPTY_ELEM (negative) have no image, and
+			*			vertices which are not an image are mapped back to EMPTY_ELEM
+			*/
+			void cache_inverse() { r2l_ = inverse_of(l2r_); inverse_ = true; }
+
+			/*
+			* @brief TRUE if l2r_ and r2l_ are known to be inverse of each other (set by build_mapping,
+			*		 cache_inverse or the setters with @inverse TRUE)
+			* @details: mappings modified through the non-const getters must be cached again
+			*/
+			bool has_inverse() const { return inverse_ && r2l_.size() == l2r_.size(); }
 
 			////////////////
 			// mapping getters
@@ -54,21 +75,48 @@ namespace bitgraph {
 
 			/*
 			* @brief maps a (bit) set of vertices (bbl) to a (bit) set of vertices (bbr)
+			*
+			*		 The bits of each block of bbl are mapped in a batch, and then scattered to the blocks of bbr
+			*		 (with prefetch). Sparse bitsets are written block by block in order.
+			*		 Cost O(|bbl|) - see map_l2r_parallel for large and dense sets
+			*
 			* @param bbl: input bitset of vertices in the space of the left ordering
 			* @param bbr: output bitset of vertices in the space of the right ordering
 			* @param overwrite: if TRUE, bbr is erased before mapping
 			*/
 			template<class bitset_t>
-			bitset_t& map_l2r(bitset_t& bbl, bitset_t& bbr, bool overwrite = true)			const;
+			bitset_t& map_l2r(const bitset_t& bbl, bitset_t& bbr, bool overwrite = true)	const {
+				return remap(bbl, bbr, l2r_, overwrite, is_sparse<bitset_t>());
+			}
 
 			/*
 			* @brief maps a (bit) set of vertices (bbr) to a (bit) set of vertices (bbl)
 			* @param bbl: output bitset of vertices in the space of the left ordering
 			* @param bbr: input bitset of vertices in the space of the right ordering
-			* @param overwrite: if TRUE, bbr is erased before mapping
+			* @param overwrite: if TRUE, bbl is erased before mapping
+			*/
+			template<class bitset_t>
+			bitset_t& map_r2l(bitset_t& bbl, const bitset_t& bbr, bool overwrite = true)	const {
+				return remap(bbr, bbl, r2l_, overwrite, is_sparse<bitset_t>());
+			}
+
+			/*
+			* @brief maps the (dense) bitset bbl to bbr (overwritten) in parallel
+			*
+			*		 Each block of bbr is gathered from bbl through the inverse mapping r2l_, so threads
+			*		 write disjoint blocks. Cost O(|V|) independent of |bbl|.
+			*
+			* @param nThreads: number of threads (hardware threads if <= 0), at most one per PAR_TILE blocks
+			* @details: requires the inverse mapping (see cache_inverse()), otherwise map_l2r is called
 			*/
 			template<class bitset_t>
-			bitset_t& map_r2l(bitset_t& bbl, bitset_t& bbr, bool overwrite = true)			const;
+			bitset_t& map_l2r_parallel(const bitset_t& bbl, bitset_t& bbr, int nThreads = 0)		const;
+
+			/*
+			* @brief maps the (dense) bitset bbr to bbl (overwritten) in parallel, gathering through l2r_
+			*/
+			template<class bitset_t>
+			bitset_t& map_r2l_parallel(bitset_t& bbl, const bitset_t& bbr, int nThreads = 0)		const;
 
 			//TODO - extend to other set representations
 
@@ -118,7 +166,31 @@ namespace bitgraph {
 			//private interface
 
 		protected:
-			void clear() { l2r_.clear(); r2l_.clear(); nameL_.clear(); nameR_.clear(); }
+			template<class bitset_t>
+			using is_sparse = std::is_base_of<BitSetSp, bitset_t>;
+
+			/*
+			* @brief bbout = map(bbin) - batch of the bits of one block, then scatter
+			*		 (vertices mapped to EMPTY_ELEM are not set)
+			*/
+			template<class bitset_t>
+			static bitset_t& remap(const bitset_t& bbin, bitset_t& bbout, const vint& map, bool overwrite, std::false_type /* dense */);
+			template<class bitset_t>
+			static bitset_t& remap(const bitset_t& bbin, bitset_t& bbout, const vint& map, bool overwrite, std::true_type /* sparse */);
+
+			/*
+			* @brief bbout = map(bbin) gathering each block of bbout through @inv, the inverse of map
+			*		 (vertices v with inv[v] < 0 are not an image and are not set)
+			*/
+			template<class bitset_t>
+			static bitset_t& gather(const bitset_t& bbin, bitset_t& bbout, const vint& inv, int nThreads);
+
+			/*
+			* @brief inverse of the (possibly partial) mapping @map, EMPTY_ELEM for vertices which are not an image
+			*/
+			static vint inverse_of(const vint& map);
+
+			void clear() { l2r_.clear(); r2l_.clear(); nameL_.clear(); nameR_.clear(); inverse_ = false; }
 			void reset(std::size_t NV) { clear(); 	l2r_.resize(NV); r2l_.resize(NV); }
 
 
@@ -128,6 +200,7 @@ namespace bitgraph {
 			vint l2r_, r2l_;					//mapping between left and right ordering
 			string nameL_;						//fancy name of left ordering
 			string nameR_;						//fancy name of right ordering	
+			bool inverse_ = false;				//TRUE if l2r_ and r2l_ are inverse of each other
 		};
 	}//end of namespace _impl
 
@@ -143,42 +216,138 @@ namespace bitgraph{
 
 	template<class bitset_t>
 	inline
-		bitset_t& GraphMap::map_l2r(bitset_t& bbl, bitset_t& bbr, bool overwrite) const {
+		bitset_t& GraphMap::remap(const bitset_t& bbin, bitset_t& bbout, const vint& map, bool overwrite, std::false_type) {
+
+		//cleans bbout if requested
+		if (overwrite) { bbout.erase_bit(); }
+
+		int buf[WORD_SIZE];
+		const int nBB = bbin.capacity();
+		for (auto i = 0; i < nBB; ++i) {
+			BITBOARD bb = bbin.block(i);
+			if (!bb) { continue; }
+
+			//I. mapped vertices of the block
+			int n = 0;
+			for (; bb; bb &= bb - 1) {
+				const int w = map[WMUL(i) + bblock::lsb64_intrinsic(bb)];
+				if (w >= 0) { buf[n++] = w; }					//EMPTY_ELEM - no image (partial mapping)
+			}
 
-		//cleans bbr if requested
-		if (overwrite) { bbr.erase_bit(); }
+			//II. scatter - destination blocks are prefetched before they are written
+#if defined(__GNUC__) || defined(__clang__)
+			for (auto k = 0; k < n; ++k) {
+				__builtin_prefetch(&bbout.block(WDIV(buf[k])), 1);
+			}
+#endif
+			for (auto k = 0; k < n; ++k) {
+				bbout.block(WDIV(buf[k])) |= bblock::MASK_BIT(WMOD(buf[k]));
+			}
+		}
 
-		//sets bitscanning configuration
-		if (bbl.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
+		return bbout;
+	}
 
-			//bitscans bbl and sets bits in bbr
-			int v = BBObject::noBit;
-			while (v = bbl.next_bit() != BBObject::noBit) {
-				bbr.set_bit(l2r_[v]);
+	template<class bitset_t>
+	inline
+		bitset_t& GraphMap::remap(const bitset_t& bbin, bitset_t& bbout, const vint& map, bool overwrite, std::true_type) {
+
+		//mapped vertices, sorted to write the blocks of bbout in order
+		vint lv;
+		lv.reserve(bbin.size());
+		for (auto it = bbin.cbegin(); it != bbin.cend(); ++it) {
+			for (BITBOARD bb = it->bb_; bb; bb &= bb - 1) {
+				const int w = map[WMUL(it->idx_) + bblock::lsb64_intrinsic(bb)];
+				if (w >= 0) { lv.push_back(w); }
 			}
 		}
+		std::sort(lv.begin(), lv.end());
+
+		//existing blocks are kept - slower path
+		if (!overwrite && !bbout.is_empty()) {
+			for (auto v : lv) { bbout.set_bit(v); }
+			return bbout;
+		}
+
+		auto& vBB = bbout.bitset();
+		vBB.clear();
+		for (auto v : lv) {
+			const int idx = WDIV(v);
+			if (vBB.empty() || vBB.back().idx_ != idx) { vBB.emplace_back(idx, 0); }
+			vBB.back().bb_ |= bblock::MASK_BIT(WMOD(v));
+		}
 
-		return bbr;
+		return bbout;
 	}
 
 	template<class bitset_t>
 	inline
-		bitset_t& GraphMap::map_r2l(bitset_t& bbl, bitset_t& bbr, bool overwrite) const {
+		bitset_t& GraphMap::gather(const bitset_t& bbin, bitset_t& bbout, const vint& inv, int nThreads) {
+
+		const int NV = static_cast<int>(inv.size());
+		const int nBB = std::min(bbout.capacity(), (NV + WORD_SIZE - 1) / WORD_SIZE);
+		nThreads = com::thread_count(nThreads, nBB / PAR_TILE);
+
+		std::atomic<int> next(0);
+		auto worker = [&]() {
+			int first;
+			while ((first = next.fetch_add(PAR_TILE)) < nBB) {
+				const int last = std::min(first + static_cast<int>(PAR_TILE), nBB);
+				for (auto j = first; j < last; ++j) {
+					BITBOARD bb = 0;
+					const int vEnd = std::min(WMUL(j + 1), NV);
+					for (auto v = WMUL(j); v < vEnd; ++v) {
+						const int u = inv[v];
+						if (u < 0) { continue; }					//not an image (partial mapping)
+						bb |= ((bbin.block(WDIV(u)) >> WMOD(u)) & BITBOARD(1)) << WMOD(v);
+					}
+					bbout.block(j) = bb;
+				}
+			}
+		};
+
+		com::run_parallel(nThreads, [&worker](int) { worker(); });
+
+		//blocks beyond the mapping
+		for (auto j = nBB; j < bbout.capacity(); ++j) {
+			bbout.block(j) = 0;
+		}
+
+		return bbout;
+	}
+
+	inline
+		vint GraphMap::inverse_of(const vint& map) {
 
-		//cleans bbr if requested
-		if (overwrite) { bbl.erase_bit(); }
+		vint inv(map.size(), EMPTY_ELEM);
+		for (std::size_t v = 0; v < map.size(); ++v) {
+			if (map[v] >= 0) { inv[map[v]] = static_cast<int>(v); }
+		}
+		return inv;
+	}
 
-		//sets bitscanning configuration
-		if (bbr.init_scan(BBObject::NON_DESTRUCTIVE) != -1) {
+	template<class bitset_t>
+	inline
+		bitset_t& GraphMap::map_l2r_parallel(const bitset_t& bbl, bitset_t& bbr, int nThreads) const {
 
-			//bitscans bbl and sets bits in bbr
-			int v = BBObject::noBit;
-			while (v = bbr.next_bit() != BBObject::noBit) {
-				bbl.set_bit(r2l_[v]);
-			}
+		static_assert(!is_sparse<bitset_t>::value, "GraphMap::map_l2r_parallel requires dense bitsets");
+		if (!has_inverse()) {
+			LOG_WARNING("inverse mapping not cached, mapping sequentially - GraphMap::map_l2r_parallel");
+			return map_l2r(bbl, bbr);
 		}
+		return gather(bbl, bbr, r2l_, nThreads);
+	}
 
-		return bbl;
+	template<class bitset_t>
+	inline
+		bitset_t& GraphMap::map_r2l_parallel(bitset_t& bbl, const bitset_t& bbr, int nThreads) const {
+
+		static_assert(!is_sparse<bitset_t>::value, "GraphMap::map_r2l_parallel requires dense bitsets");
+		if (!has_inverse()) {
+			LOG_WARNING("inverse mapping not cached, mapping sequentially - GraphMap::map_r2l_parallel");
+			return map_r2l(bbl, bbr);
+		}
+		return gather(bbr, bbl, l2r_, nThreads);
 	}
 
 	inline
@@ -229,6 +398,7 @@ namespace bitgraph{
 			LOG_ERROR("bad ordering - GraphMap::build_mapping");
 			return -1;
 		}
+		inverse_ = true;
 
 		//I/O
 		//cout<<"N2O_D"; com::stl::print_collection(n2o_d); cout<<endl;
@@ -258,6 +428,7 @@ namespace bitgraph{
 			LOG_ERROR("bad ordering - GraphMap::build_mapping");
 			return -1;
 		}
+		inverse_ = true;
 
 		return 0;
 	}
@@ -294,6 +465,7 @@ namespace bitgraph{
 			LOG_ERROR("bad ordering - GraphMap::build_mapping");
 			return -1;
 		}
+		inverse_ = true;
 
 		//I/O
 		//cout<<"N2O_D"; com::stl::print_collection(n2o_d); cout<<endl;
@@ -309,6 +481,7 @@ namespace bitgraph{
 
 		l2r_ = lhs_o2n;
 		r2l_ = Decode::reverse(l2r_);
+		inverse_ = true;
 
 		nameL_ = std::move(lhs_name);
 		nameR_ = "NOT USED - SINGLE MAPPING";
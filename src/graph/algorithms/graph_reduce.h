@@ -0,0 +1,556 @@
+/**
+* @file graph_reduce.h
+* @brief header for class GraphReduction, a reduction (kernelization) pipeline for the maximum clique problem
+*		 in simple undirected graphs (dense or sparse)
+* @details: given the size lb of a known clique, the rules remove vertices which do not belong to any clique
+*			larger than lb (or which can be replaced by another vertex in such a clique):
+*			- CORE: vertices with core number below lb (a clique with lb + 1 vertices is in the lb-core)
+*			- DOMINATION: v is dominated by a non-adjacent vertex u if N(v) is a subset of N(u) - any clique with v
+*			  is still a clique with u in place of v (one of each group of vertices with the same neighborhood is kept)
+*			- COMPONENTS: connected components with at most lb vertices
+*			CORE and DOMINATION are applied until fixpoint: every dominated vertex removed lowers the degree of
+*			its neighbors, which may fall below lb. The reduced graph is relabelled with the vertices of each
+*			component in consecutive labels, and the mapping [new]->[old] is added to a Decode object.
+* @details: if the graph has a clique larger than lb, the reduced graph has a clique of the same size
+*			(only one maximum clique is preserved by DOMINATION).
+* @details: the dominated vertices of a round are found in parallel over the current (alive) subgraph held in
+*			a bitset, and removed together at the end of the round. The reduced graph is also built in parallel.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __GRAPH_REDUCE_H__
+#define __GRAPH_REDUCE_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/kcore_parallel.h"
+#include "graph/algorithms/decode.h"
+#include "bitscan/bitscan.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <type_traits>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////
+		//
+		// GraphReduction class
+		//
+		// Reduction rules for the maximum clique problem, applied until fixpoint
+		//
+		////////////////////
+
+		template<class Graph_t>
+		class GraphReduction {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<bitgraph::Ugraph<BBScanSp>, Graph_t>::value, "GraphReduction<Graph_t> requires Ugraph<BBScan> or Ugraph<BBScanSp>");
+
+		public:
+			using type = GraphReduction<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+			using is_dense = std::is_same<basic_type, BBScan>;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum rule_t { CORE = 0x01, DOMINATION = 0x02, COMPONENTS = 0x04, ALL_RULES = 0x07 };
+			enum { ROW_TILE = 64 };											//vertices per task of a thread
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @param nThreads: number of threads (hardware threads if <= 0)
+			*/
+			explicit GraphReduction(Graph_t& g, int nThreads = 0) :
+				g_(g), NV_(g.number_of_vertices()), nThreads_(nThreads)
+			{}
+
+			//copy and move semantics disallowed
+			GraphReduction(const GraphReduction&) = delete;
+			GraphReduction& operator =			(const GraphReduction&) = delete;
+			GraphReduction(GraphReduction&&) = delete;
+			GraphReduction& operator =			(GraphReduction&&) = delete;
+
+			~GraphReduction() = default;
+
+			/////////////////////////////
+			// public interface
+
+			/*
+			* @brief Applies the reduction @rules to the graph, given the size @lb of a known clique, and builds
+			*		 the reduced graph @gr. The mapping [new]->[old] of its vertices is added to @d.
+			*
+			*		 If no vertex is left (no clique larger than lb exists) @gr and @d are not modified
+			*
+			* @param rules: OR-ed rule_t values
+			* @returns number of vertices of the reduced graph, -1 if error
+			*/
+			int reduce(Graph_t& gr, Decode& d, int lb, int rules = ALL_RULES);
+
+			/*
+			* @brief Applies the reduction @rules, but does not build the reduced graph
+			* @returns number of vertices left, -1 if error
+			*/
+			int reduce(int lb, int rules = ALL_RULES);
+
+			/////////////////////////////
+			// getters (after reduce())
+
+			/*
+			* @brief vertices of the original graph which are left
+			*/
+			const BBScan& kernel()							const { return alive_; }
+
+			/*
+			* @brief mapping [new]->[old] of the reduced graph (the ordering added to the Decode object)
+			*/
+			const vint& mapping()							const { return n2o_; }
+
+			/*
+			* @brief components of the reduced graph - component c has vertices [comp[c], comp[c + 1])
+			*/
+			const vint& components()						const { return comp_; }
+			int number_of_components()						const { return comp_.empty() ? 0 : static_cast<int>(comp_.size()) - 1; }
+
+			/*
+			* @brief number of vertices removed by @r (CORE, DOMINATION or COMPONENTS)
+			*/
+			int number_of_removed(rule_t r)					const;
+			int number_of_rounds()							const { return nRounds_; }
+
+			//////////////
+			// private interface
+		private:
+
+			/*
+			* @brief calls @f(w) for every neighbor w of v
+			*/
+			template<class Func>
+			void for_each_neighbor(int v, Func f, std::true_type /* dense */) const;
+			template<class Func>
+			void for_each_neighbor(int v, Func f, std::false_type /* sparse */) const;
+			template<class Func>
+			void for_each_neighbor(int v, Func f) const { for_each_neighbor(v, f, is_dense()); }
+
+			/*
+			* @brief removes the vertices with core number below @lb and computes the degrees in the kernel
+			*/
+			void core_prune(int lb, bool isCore);
+
+			/*
+			* @brief removes @v from the kernel - neighbors with degree below @lb are also removed (cascade)
+			*		 if @isCore
+			*/
+			void remove(int v, int lb, bool isCore);
+
+			/*
+			* @brief flags the dominated vertices of the kernel (parallel, the kernel is not modified)
+			* @returns number of dominated vertices
+			*/
+			int find_dominated(std::vector<char>& dom);
+
+			/*
+			* @brief true if v is dominated by a vertex of the kernel
+			*/
+			bool is_dominated(int v, int first, bool isolatedOnly) const;
+
+			/*
+			* @brief N(v) and kernel is a subset of N(u)
+			*/
+			bool is_subset(int v, int u, std::true_type /* dense */) const;
+			bool is_subset(int v, int u, std::false_type /* sparse */) const;
+
+			/*
+			* @brief connected components of the kernel, those with at most @lb vertices are removed if @isComp.
+			*		 Computes the relabelling (n2o_) and the components (comp_)
+			*/
+			void split(int lb, bool isComp);
+
+			/*
+			* @brief induced subgraph of the kernel, relabelled by n2o_
+			*/
+			void build(Graph_t& gr, std::true_type /* dense */);
+			void build(Graph_t& gr, std::false_type /* sparse */);
+
+			///////////
+			// data members
+		private:
+
+			Graph_t& g_;
+			const int NV_;
+			int nThreads_;
+
+			BBScan alive_;													//kernel
+			vint deg_;														//degree in the kernel
+			vint n2o_;														//[new]->[old]
+			vint o2n_;														//[old]->[new] (EMPTY_ELEM if removed)
+			vint comp_;														//component offsets (new labels)
+
+			int nCore_ = 0;
+			int nDom_ = 0;
+			int nComp_ = 0;
+			int nRounds_ = 0;
+		};
+
+	}//end namespace _impl
+
+	using _impl::GraphReduction;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void GraphReduction<Graph_t>::for_each_neighbor(int v, Func f, std::true_type) const
+	{
+		const auto& row = g_.neighbors(v);
+		const int nBB = row.number_of_blocks();
+		for (auto i = 0; i < nBB; ++i) {
+			BITBOARD bb = row.block(i) & alive_.block(i);
+			while (bb) {
+				f(WMUL(i) + bblock::lsb64_intrinsic(bb));
+				bb &= bb - 1;
+			}
+		}
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void GraphReduction<Graph_t>::for_each_neighbor(int v, Func f, std::false_type) const
+	{
+		const auto& row = g_.neighbors(v);
+		for (auto it = row.cbegin(); it != row.cend(); ++it) {
+			BITBOARD bb = it->bb_ & alive_.block(it->idx_);
+			while (bb) {
+				f(WMUL(it->idx_) + bblock::lsb64_intrinsic(bb));
+				bb &= bb - 1;
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphReduction<Graph_t>::number_of_removed(rule_t r) const
+	{
+		switch (r) {
+		case CORE:
+			return nCore_;
+		case DOMINATION:
+			return nDom_;
+		case COMPONENTS:
+			return nComp_;
+		default:
+			LOG_ERROR("unknown rule - GraphReduction<Graph_t>::number_of_removed");
+			return -1;
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphReduction<Graph_t>::reduce(int lb, int rules)
+	{
+		if ((rules & ~ALL_RULES) != 0) {
+			LOG_ERROR("unknown reduction rule - GraphReduction<Graph_t>::reduce");
+			return -1;
+		}
+
+		nCore_ = nDom_ = nComp_ = nRounds_ = 0;
+		n2o_.clear();
+		comp_.clear();
+		alive_.reset(NV_);
+		alive_.set_bit(0, NV_ - 1);
+
+		const bool isCore = (rules & CORE) && lb > 0;
+
+		//I. core numbers
+		core_prune(lb, isCore);
+
+		//II. domination (and core cascades) until fixpoint
+		if (rules & DOMINATION) {
+			std::vector<char> dom(NV_, 0);
+			while (find_dominated(dom) > 0) {
+				++nRounds_;
+				for (auto v = 0; v < NV_; ++v) {
+					if (!dom[v]) { continue; }
+					dom[v] = 0;
+					if (!alive_.is_bit(v)) { continue; }				//removed in a cascade
+					++nDom_;
+					remove(v, lb, isCore);
+				}
+			}
+		}
+
+		//III. components and relabelling
+		split(lb, (rules & COMPONENTS) != 0);
+
+		return static_cast<int>(n2o_.size());
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphReduction<Graph_t>::reduce(Graph_t& gr, Decode& d, int lb, int rules)
+	{
+		if (reduce(lb, rules) == -1) { return -1; }
+
+		const int nR = static_cast<int>(n2o_.size());
+		if (nR == 0) { return 0; }
+
+		if (gr.reset(nR, g_.name()) == -1) {
+			LOG_ERROR("error during allocation - GraphReduction<Graph_t>::reduce");
+			return -1;
+		}
+		build(gr, is_dense());
+		d.add_ordering(n2o_);
+
+		return nR;
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphReduction<Graph_t>::core_prune(int lb, bool isCore)
+	{
+		if (isCore) {
+			KCoreParallel kc(g_, nThreads_);
+			kc.find_kcore();
+			for (auto v = 0; v < NV_; ++v) {
+				if (kc.coreness(v) < lb) {
+					alive_.erase_bit(v);
+					++nCore_;
+				}
+			}
+		}
+
+		//degrees in the kernel
+		deg_.assign(NV_, 0);
+		const int nThreads = com::thread_count(nThreads_, NV_ / ROW_TILE);
+		std::atomic<int> next(0);
+		com::run_parallel(nThreads, [&](int) {
+			int first;
+			while ((first = next.fetch_add(ROW_TILE)) < NV_) {
+				const int last = std::min(first + static_cast<int>(ROW_TILE), NV_);
+				for (auto v = first; v < last; ++v) {
+					if (!alive_.is_bit(v)) { continue; }
+					int d = 0;
+					for_each_neighbor(v, [&d](int) { ++d; });
+					deg_[v] = d;
+				}
+			}
+		});
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphReduction<Graph_t>::remove(int v, int lb, bool isCore)
+	{
+		vint stack(1, v);
+		alive_.erase_bit(v);
+		while (!stack.empty()) {
+			const int u = stack.back();
+			stack.pop_back();
+			for_each_neighbor(u, [&](int w) {
+				if (--deg_[w] < lb && isCore) {
+					alive_.erase_bit(w);
+					stack.push_back(w);
+					++nCore_;
+				}
+			});
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int GraphReduction<Graph_t>::find_dominated(std::vector<char>& dom)
+	{
+		//first vertex of the kernel and whether all the kernel is isolated vertices
+		int first = EMPTY_ELEM;
+		bool isolatedOnly = true;
+		for (auto v = 0; v < NV_; ++v) {
+			if (!alive_.is_bit(v)) { continue; }
+			if (first == EMPTY_ELEM) { first = v; }
+			if (deg_[v] > 0) { isolatedOnly = false; break; }
+		}
+		if (first == EMPTY_ELEM) { return 0; }
+
+		const int nThreads = com::thread_count(nThreads_, NV_ / ROW_TILE);
+		std::vector<int> nDom(nThreads, 0);
+		std::atomic<int> next(0);
+		com::run_parallel(nThreads, [&](int t) {
+			int firstV;
+			while ((firstV = next.fetch_add(ROW_TILE)) < NV_) {
+				const int last = std::min(firstV + static_cast<int>(ROW_TILE), NV_);
+				for (auto v = firstV; v < last; ++v) {
+					if (alive_.is_bit(v) && is_dominated(v, first, isolatedOnly)) {
+						dom[v] = 1;
+						++nDom[t];
+					}
+				}
+			}
+		});
+
+		int nTot = 0;
+		for (auto n : nDom) { nTot += n; }
+		return nTot;
+	}
+
+	template<class Graph_t>
+	inline
+		bool GraphReduction<Graph_t>::is_dominated(int v, int first, bool isolatedOnly) const
+	{
+		//isolated vertex - dominated by any other vertex, the first one is kept if all are isolated
+		if (deg_[v] == 0) {
+			return !isolatedOnly || v != first;
+		}
+
+		//dominators are neighbors of the neighbor w of v with smallest degree
+		int w = EMPTY_ELEM;
+		for_each_neighbor(v, [&](int x) {
+			if (w == EMPTY_ELEM || deg_[x] < deg_[w]) { w = x; }
+		});
+
+		const auto& rowV = g_.neighbors(v);
+		bool found = false;
+		for_each_neighbor(w, [&](int u) {
+			if (found || u == v || rowV.is_bit(u)) { return; }
+			if (deg_[u] < deg_[v] || (deg_[u] == deg_[v] && u > v)) { return; }	//same neighborhood: the lowest label is kept
+			found = is_subset(v, u, is_dense());
+		});
+		return found;
+	}
+
+	template<class Graph_t>
+	inline
+		bool GraphReduction<Graph_t>::is_subset(int v, int u, std::true_type) const
+	{
+		const auto& rowV = g_.neighbors(v);
+		const auto& rowU = g_.neighbors(u);
+		const int nBB = rowV.number_of_blocks();
+		for (auto i = 0; i < nBB; ++i) {
+			if (rowV.block(i) & alive_.block(i) & ~rowU.block(i)) { return false; }
+		}
+		return true;
+	}
+
+	template<class Graph_t>
+	inline
+		bool GraphReduction<Graph_t>::is_subset(int v, int u, std::false_type) const
+	{
+		const auto& rowU = g_.neighbors(u);
+		const auto& rowV = g_.neighbors(v);
+		for (auto it = rowV.cbegin(); it != rowV.cend(); ++it) {
+			BITBOARD bb = it->bb_ & alive_.block(it->idx_);
+			if (bb && (bb & ~rowU.find_block(it->idx_))) { return false; }
+		}
+		return true;
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphReduction<Graph_t>::split(int lb, bool isComp)
+	{
+		o2n_.assign(NV_, EMPTY_ELEM);
+		comp_.assign(1, 0);
+
+		BBScan open(alive_);											//kernel vertices not yet reached
+		vint cc, stack;
+		for (auto s = 0; s < NV_; ++s) {
+			if (!open.is_bit(s)) { continue; }
+
+			//BFS from s - neighbors still open are taken by blocks
+			cc.assign(1, s);
+			stack.assign(1, s);
+			open.erase_bit(s);
+			while (!stack.empty()) {
+				const int u = stack.back();
+				stack.pop_back();
+				for_each_neighbor(u, [&](int x) {
+					if (open.is_bit(x)) {
+						open.erase_bit(x);
+						cc.push_back(x);
+						stack.push_back(x);
+					}
+				});
+			}
+
+			//small component
+			if (isComp && static_cast<int>(cc.size()) <= lb) {
+				for (auto v : cc) { alive_.erase_bit(v); }
+				nComp_ += static_cast<int>(cc.size());
+				continue;
+			}
+
+			//consecutive labels, in the original order
+			std::sort(cc.begin(), cc.end());
+			for (auto v : cc) {
+				o2n_[v] = static_cast<int>(n2o_.size());
+				n2o_.push_back(v);
+			}
+			comp_.push_back(static_cast<int>(n2o_.size()));
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphReduction<Graph_t>::build(Graph_t& gr, std::true_type)
+	{
+		const int nR = static_cast<int>(n2o_.size());
+		const int nThreads = com::thread_count(nThreads_, nR / ROW_TILE);
+		std::atomic<int> next(0);
+		com::run_parallel(nThreads, [&](int) {
+			int first;
+			while ((first = next.fetch_add(ROW_TILE)) < nR) {
+				const int last = std::min(first + static_cast<int>(ROW_TILE), nR);
+				for (auto i = first; i < last; ++i) {
+					auto& row = gr.neighbors(i);
+					for_each_neighbor(n2o_[i], [&](int x) {
+						const int j = o2n_[x];
+						row.block(WDIV(j)) |= bblock::MASK_BIT(WMOD(j));
+					});
+				}
+			}
+		});
+	}
+
+	template<class Graph_t>
+	inline
+		void GraphReduction<Graph_t>::build(Graph_t& gr, std::false_type)
+	{
+		//neighbors are in the same component, where labels keep the original order - rows are written in order
+		const int nR = static_cast<int>(n2o_.size());
+		const int nThreads = com::thread_count(nThreads_, nR / ROW_TILE);
+		std::atomic<int> next(0);
+		com::run_parallel(nThreads, [&](int) {
+			int first;
+			while ((first = next.fetch_add(ROW_TILE)) < nR) {
+				const int last = std::min(first + static_cast<int>(ROW_TILE), nR);
+				for (auto i = first; i < last; ++i) {
+					auto& vBB = gr.neighbors(i).bitset();
+					vBB.clear();
+					for_each_neighbor(n2o_[i], [&](int x) {
+						const int j = o2n_[x];
+						const int idx = WDIV(j);
+						if (vBB.empty() || vBB.back().idx_ != idx) { vBB.emplace_back(idx, 0); }
+						vBB.back().bb_ |= bblock::MASK_BIT(WMOD(j));
+					});
+				}
+			}
+		});
+	}
+
+}//end namespace bitgraph
+
+#endif
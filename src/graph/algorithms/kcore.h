@@ -417,7 +417,7 @@ namespace bitgraph {
 
 				//iterates over N(v)
 				_bbt& neigh = g_.neighbors(v);
-				if (neigh.init_scan(bbo::NON_DESTRUCTIVE) != -1) {			//CHECK MUST BE - for sparse_bitarrays
+				if (!neigh.is_empty() && neigh.init_scan(bbo::NON_DESTRUCTIVE) != -1) {			//CHECK MUST BE - for sparse_bitarrays
 
 					while ((u = neigh.next_bit()) != BBObject::noBit) {
 
@@ -444,7 +444,7 @@ namespace bitgraph {
 				AND(g_.neighbors(v), subg_, neigh);
 
 				//iterates over the neighbors of v in the subgraph
-				if (neigh.init_scan(bbo::NON_DESTRUCTIVE) != -1) {			//CHECK MUST BE - for sparse_bitarrays
+				if (!neigh.is_empty() && neigh.init_scan(bbo::NON_DESTRUCTIVE) != -1) {			//CHECK MUST BE - for sparse_bitarrays
 
 					while ((u = neigh.next_bit()) != BBObject::noBit) {
 
@@ -976,7 +976,7 @@ namespace bitgraph {
 		vint neighbors;
 
 		//main loop
-		for (auto i = ver_.size() - 1; i >= 0; --i) {
+		for (int i = static_cast<int>(ver_.size()) - 1; i >= 0; --i) {
 
 			//CUT at root level
 			int v = ver_[i];
@@ -1277,4 +1277,4 @@ namespace bitgraph {
 }//end namespace bitgraph
 
 
-#endif
\ No newline at end of file
+#endif
\ No newline at end of file
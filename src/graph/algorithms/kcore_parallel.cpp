@@ -0,0 +1,206 @@
+/**
+* @file kcore_parallel.cpp
+* @brief implementation of the KCoreParallel class (multi-threaded k-core decomposition)
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#include "graph/algorithms/kcore_parallel.h"
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <memory>
+#include <limits>
+
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief reusable barrier for a fixed number of threads
+	*/
+	class Barrier {
+	public:
+		explicit Barrier(int n) : n_(n) {}
+
+		void wait() {
+			std::unique_lock<std::mutex> lck(mtx_);
+			auto gen = gen_;
+			if (++count_ == n_) {
+				count_ = 0;
+				++gen_;
+				cv_.notify_all();
+			}
+			else {
+				cv_.wait(lck, [this, gen] { return gen != gen_; });
+			}
+		}
+
+	private:
+		std::mutex mtx_;
+		std::condition_variable cv_;
+		const int n_;
+		int count_ = 0;
+		uint64_t gen_ = 0;
+	};
+
+}
+
+KCoreParallel::KCoreParallel(std::vector<offset_t> offsets, vint adj) :
+	NV_(offsets.empty() ? 0 : static_cast<int>(offsets.size()) - 1),
+	off_(std::move(offsets)), adj_(std::move(adj))
+{
+	if (off_.empty()) { off_.push_back(0); }
+}
+
+int KCoreParallel::max_core_number() const
+{
+	if (ver_.empty()) { return 0; }
+	return core_[ver_.back()];
+}
+
+void KCoreParallel::peel_sequential(std::size_t head, int k, std::atomic<int>* deg)
+{
+	while (head < ver_.size()) {
+		int v = ver_[head++];
+		for (auto i = off_[v]; i < off_[v + 1]; ++i) {
+			int u = adj_[i];
+			int du = deg[u].load(std::memory_order_relaxed);
+			if (du > k) {
+				deg[u].store(--du, std::memory_order_relaxed);
+				if (du == k) {
+					core_[u] = k;
+					ver_.push_back(u);
+				}
+			}
+		}
+	}
+	++nRounds_;
+}
+
+int KCoreParallel::find_kcore(int nThreads)
+{
+	if (static_cast<int>(off_.size()) != NV_ + 1 || off_[NV_] != adj_.size()) {
+		LOG_ERROR("bad CSR graph - KCoreParallel::find_kcore");
+		return -1;
+	}
+	for (auto u : adj_) {
+		if (u < 0 || u >= NV_) {
+			LOGG_ERROR("bad vertex in CSR graph: ", u, " - KCoreParallel::find_kcore");
+			return -1;
+		}
+	}
+
+	core_.assign(NV_, EMPTY_ELEM);
+	ver_.clear();
+	ver_.reserve(NV_);
+	nRounds_ = 0;
+	if (NV_ == 0) { return 0; }
+
+	nThreads = com::thread_count(nThreads, NV_);
+
+	std::unique_ptr<std::atomic<int>[]> deg(new std::atomic<int>[NV_]);
+	std::vector<vint> buf(nThreads);							//per-thread frontier buffers
+	vint minDeg(nThreads);										//per-thread minimum degree above the level
+	vint F;														//current frontier (sorted)
+	Barrier bar(nThreads);
+
+	//merges the thread buffers into the frontier (called by thread 0 between barriers)
+	auto merge = [&](int k) {
+		F.clear();
+		for (auto& b : buf) { F.insert(F.end(), b.begin(), b.end()); }
+		std::sort(F.begin(), F.end());
+		for (auto v : F) {
+			core_[v] = k;
+			ver_.push_back(v);
+		}
+		++nRounds_;
+	};
+
+	auto worker = [&](int tid) {
+		const int first = static_cast<int>(static_cast<long long>(NV_) * tid / nThreads);
+		const int last = static_cast<int>(static_cast<long long>(NV_) * (tid + 1) / nThreads);
+		vint& b = buf[tid];
+
+		for (auto v = first; v < last; ++v) {
+			deg[v].store(static_cast<int>(off_[v + 1] - off_[v]), std::memory_order_relaxed);
+		}
+		bar.wait();
+
+		int k = 0;
+		while (true) {
+
+			//scan - vertices of the k-shell left and next level
+			b.clear();
+			int mn = std::numeric_limits<int>::max();
+			for (auto v = first; v < last; ++v) {
+				if (core_[v] != EMPTY_ELEM) { continue; }
+				int dv = deg[v].load(std::memory_order_relaxed);
+				if (dv == k) { b.push_back(v); }
+				else { mn = std::min(mn, dv); }
+			}
+			minDeg[tid] = mn;
+			bar.wait();
+
+			std::size_t total = 0;
+			for (auto& bt : buf) { total += bt.size(); }
+			if (total == 0) {
+
+				//jump to the next non-empty level (all threads take the same decision)
+				k = *std::min_element(minDeg.begin(), minDeg.end());
+				if (k == std::numeric_limits<int>::max()) { break; }
+				bar.wait();
+				continue;
+			}
+
+			if (tid == 0) { merge(k); }
+			bar.wait();
+
+			//rounds of level k
+			while (!F.empty()) {
+
+				if (F.size() < SEQ_FRONTIER) {
+					if (tid == 0) { peel_sequential(ver_.size() - F.size(), k, deg.get()); }
+					bar.wait();
+					break;
+				}
+
+				//parallel round - threads decrement the neighbors of their slice of F
+				b.clear();
+				const std::size_t fFirst = F.size() * tid / nThreads;
+				const std::size_t fLast = F.size() * (tid + 1) / nThreads;
+				for (auto i = fFirst; i < fLast; ++i) {
+					int v = F[i];
+					for (auto j = off_[v]; j < off_[v + 1]; ++j) {
+						int u = adj_[j];
+						if (deg[u].load(std::memory_order_relaxed) <= k) { continue; }
+
+						/////////////////////////////////////////////
+						int du = deg[u].fetch_sub(1, std::memory_order_relaxed);
+						/////////////////////////////////////////////
+
+						if (du == k + 1) { b.push_back(u); }								//u reaches level k - only one thread sees it
+						else if (du <= k) { deg[u].fetch_add(1, std::memory_order_relaxed); }	//lost race - undo
+					}
+				}
+				bar.wait();
+
+				if (tid == 0) { merge(k); }
+				bar.wait();
+			}
+
+			++k;
+		}
+	};
+
+	//workers meet at barriers - dedicated threads, since pool tasks are not guaranteed to run concurrently
+	std::vector<std::thread> pool;
+	pool.reserve(nThreads - 1);
+	for (auto t = 1; t < nThreads; ++t) {
+		pool.emplace_back(worker, t);
+	}
+	worker(0);
+	for (auto& th : pool) { th.join(); }
+
+	return 0;
+}
@@ -0,0 +1,200 @@
+/**
+* @file kcore_parallel.h
+* @brief header for class KCoreParallel, a multi-threaded k-core decomposition for large sparse graphs
+* @details: level-synchronous peeling with atomic degree decrements [Dasari et al. 2014 (ParK),
+*			Kabir and Madduri 2017 (PKC)]. For each level k, the vertices of degree k are found by a parallel
+*			scan and then peeled in rounds: the frontier is split among threads, neighbors are decremented
+*			atomically and those whose degree drops to k form the next frontier. Small frontiers are peeled
+*			sequentially (remaining cascade of the level), so long chains do not pay one barrier per vertex.
+* @details: the graph is held in CSR form (built from any Ugraph, typically sparse_ugraph, or given directly).
+* @details: coreness is the same as KCore::coreness_numbers(). kcore_ordering() is a degeneracy ordering
+*			(non-decreasing coreness, every vertex has at most coreness(v) neighbors after it) - frontiers
+*			are sorted, so the ordering does not depend on the number of threads, but it may differ from the
+*			bin-sort order of KCore.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __KCORE_PARALLEL_H__
+#define __KCORE_PARALLEL_H__
+
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include "bitscan/bitscan.h"
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////
+		//
+		// KCoreParallel class
+		//
+		// Multi-threaded coreness of vertices in a (CSR) graph
+		//
+		////////////////////
+
+		class KCoreParallel {
+		public:
+
+			using offset_t = std::size_t;								//CSR offsets (2|E| may exceed 32 bits)
+			using type = KCoreParallel;
+
+			enum { SEQ_FRONTIER = 1024 };								//frontiers below this size are peeled sequentially
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @brief builds the CSR form of the undirected graph @g (any Ugraph type, typically sparse_ugraph)
+			* @param nThreads: number of threads for the construction (hardware threads if <= 0)
+			*/
+			template<class Graph_t>
+			explicit KCoreParallel(Graph_t& g, int nThreads = 0);
+
+			/*
+			* @brief CSR graph - neighbors of v are adj[offsets[v]..offsets[v + 1]), every edge in both directions
+			*/
+			KCoreParallel(std::vector<offset_t> offsets, vint adj);
+
+			//copy and move semantics disallowed
+			KCoreParallel(const KCoreParallel&) = delete;
+			KCoreParallel& operator =			(const KCoreParallel&) = delete;
+			KCoreParallel(KCoreParallel&&) = delete;
+			KCoreParallel& operator =			(KCoreParallel&&) = delete;
+
+			~KCoreParallel() = default;
+
+			////////////////
+			//setters and getters
+
+			int number_of_vertices()						const { return NV_; }
+			uint64_t number_of_edges()						const { return adj_.size() / 2; }
+
+			/*
+			* @brief Maximum core number of the graph (must be called after find_kcore())
+			*/
+			int max_core_number()							const;
+
+			/*
+			* @brief Core number of vertex @v (must be called after find_kcore())
+			*/
+			int coreness(std::size_t v)						const { return core_[v]; }
+
+			/*
+			* @brief Coreness of all vertices (must be called after find_kcore())
+			*/
+			const vint& coreness_numbers()					const { return core_; }
+
+			/*
+			* @brief Vertices in peeling order - a degeneracy ordering (must be called after find_kcore())
+			*/
+			const vint& kcore_ordering()					const { return ver_; }
+
+			/*
+			* @brief Number of peeling rounds of the last decomposition (parallel frontiers + sequential cascades)
+			*/
+			uint64_t number_of_rounds()						const { return nRounds_; }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief Computes coreness and the peeling ordering
+			* @param nThreads: number of threads (hardware threads if <= 0)
+			* @returns 0 if success, -1 if the CSR graph is not valid
+			*/
+			int find_kcore(int nThreads = 0);
+
+			//////////////
+			// private interface
+		private:
+
+			/*
+			* @brief calls @f(first, last) for a partition of [0, @n) in @nThreads consecutive ranges,
+			*		 one per task of the global thread pool (the calling thread takes the first range)
+			*/
+			template<class Func>
+			static void parallel_range(int nThreads, int n, Func f);
+
+			/*
+			* @brief sequential cascade of level @k from position @head of ver_ (BZ-like queue)
+			*/
+			void peel_sequential(std::size_t head, int k, std::atomic<int>* deg);
+
+			///////////
+			// data members
+		private:
+
+			int NV_;
+			std::vector<offset_t> off_;									//CSR offsets (size NV_ + 1)
+			vint adj_;													//CSR adjacency
+
+			vint core_;													//coreness of vertices
+			vint ver_;													//vertices in peeling order
+			uint64_t nRounds_ = 0;
+		};
+
+	}//end namespace _impl
+
+	using _impl::KCoreParallel;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	inline
+		KCoreParallel::KCoreParallel(Graph_t& g, int nThreads) :
+		NV_(g.number_of_vertices()), off_(NV_ + 1, 0)
+	{
+		nThreads = com::thread_count(nThreads, NV_);
+
+		//degrees
+		parallel_range(nThreads, NV_, [&](int first, int last) {
+			for (auto v = first; v < last; ++v) {
+				off_[v + 1] = g.degree(v);
+			}
+		});
+		for (auto v = 0; v < NV_; ++v) {
+			off_[v + 1] += off_[v];
+		}
+
+		//adjacency - each bitset has its own scan state, so vertices can be scanned concurrently
+		adj_.resize(off_[NV_]);
+		parallel_range(nThreads, NV_, [&](int first, int last) {
+			for (auto v = first; v < last; ++v) {
+				auto& nv = g.neighbors(v);
+				if (nv.is_empty() || nv.init_scan(bbo::NON_DESTRUCTIVE) == -1) { continue; }
+
+				offset_t k = off_[v];
+				int u = BBObject::noBit;
+				while ((u = nv.next_bit()) != BBObject::noBit) {
+					adj_[k++] = u;
+				}
+			}
+		});
+	}
+
+	template<class Func>
+	inline
+		void KCoreParallel::parallel_range(int nThreads, int n, Func f)
+	{
+		auto bound = [nThreads, n](int t) {
+			return static_cast<int>(static_cast<long long>(n) * t / nThreads);
+		};
+
+		com::run_parallel(nThreads, [&f, &bound](int t) { f(bound(t), bound(t + 1)); });
+	}
+
+}//end namespace bitgraph
+
+#endif
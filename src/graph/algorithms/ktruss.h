@@ -0,0 +1,529 @@
+/**
+* @file ktruss.h
+* @brief header for class KTruss, the truss decomposition of a simple undirected graph
+* @details: the support of an edge (u, w) is the number of triangles which contain it, |N(u) & N(w)|,
+*			computed by a fused AND-popcount of the two neighborhood rows (in parallel by rows).
+* @details: the trussness of an edge is the largest k such that the edge belongs to the k-truss, the
+*			maximal subgraph where every edge has support at least k - 2 [Cohen 2008]. Edges are peeled
+*			in non-decreasing support with a bucket queue over edges [Wang and Cheng 2012] - the remaining
+*			triangles of a peeled edge (u, w) are the common neighbors in the rows of the remaining graph,
+*			found by bitset intersection.
+* @details: edge ids are compact - edge (u, w), u < w, has id off[u] + rank of w among the neighbors of u
+*			greater than u (per-row offset index). The rank is found by binary search in sparse graphs and
+*			in O(1) in dense graphs, from per-block prefix counts of the rows and a popcount.
+* @details: valid for dense (Ugraph<BBScan>) and sparse (Ugraph<BBScanSp>) graphs
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __KTRUSS_H__
+#define __KTRUSS_H__
+
+#include "graph/simple_ugraph.h"
+#include "bitscan/bitscan.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <utility>
+#include <limits>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////
+		//
+		// KTruss class
+		//
+		// Trussness of the edges of a graph
+		//
+		////////////////////
+
+		template<class Graph_t>
+		class KTruss {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<bitgraph::Ugraph<BBScanSp>, Graph_t>::value, "KTruss<Graph_t> requires Ugraph<BBScan> or Ugraph<BBScanSp>");
+
+		public:
+			using type = KTruss<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+			using edge_t = std::size_t;												//edge id (|E| may exceed 32 bits)
+			using vedge = std::vector<std::pair<int, int>>;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			static const edge_t NO_EDGE = std::numeric_limits<edge_t>::max();
+			enum { CHUNK_ROWS = 64 };												//rows taken by a thread at a time (support)
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @brief builds the edge index of @g
+			*/
+			explicit KTruss(Graph_t& g);
+
+			//copy and move semantics disallowed
+			KTruss(const KTruss&) = delete;
+			KTruss& operator =			(const KTruss&) = delete;
+			KTruss(KTruss&&) = delete;
+			KTruss& operator =			(KTruss&&) = delete;
+
+			~KTruss() = default;
+
+			////////////////
+			//setters and getters
+
+			int number_of_vertices()						const { return NV_; }
+			edge_t number_of_edges()						const { return adj_.size(); }
+
+			/*
+			* @brief id of edge (@u, @w), NO_EDGE if it is not an edge
+			*/
+			edge_t edge_id(int u, int w)					const;
+
+			/*
+			* @brief endpoints (u, w), u < w, of the edge with id @e
+			*/
+			std::pair<int, int> edge(edge_t e)				const;
+
+			/*
+			* @brief number of triangles of each edge, indexed by edge id (must be called after compute_support())
+			*/
+			const vint& support()							const { return sup_; }
+
+			/*
+			* @brief trussness of each edge, indexed by edge id (must be called after find_truss())
+			*/
+			const vint& trussness()							const { return truss_; }
+
+			/*
+			* @brief trussness of edge (@u, @w), EMPTY_ELEM if it is not an edge (must be called after find_truss())
+			*/
+			int trussness(int u, int w)						const;
+
+			/*
+			* @brief largest k with a non-empty k-truss, 0 if the graph has no edges (must be called after find_truss())
+			*/
+			int max_truss()									const { return maxTruss_; }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief Computes the support of every edge (AND-popcount of the endpoint rows)
+			* @param nThreads: number of threads (hardware threads if <= 0)
+			* @returns 0 if success
+			*/
+			int compute_support(int nThreads = 1);
+
+			/*
+			* @brief Truss decomposition - computes the support and peels the edges
+			* @param nThreads: number of threads for the support computation (hardware threads if <= 0)
+			* @returns the maximum trussness
+			*/
+			int find_truss(int nThreads = 1);
+
+			/*
+			* @brief edges of the k-truss (u < w), @k = max_truss() by default (must be called after find_truss())
+			*/
+			vedge truss_edges(int k = 0)					const;
+
+			/*
+			* @brief k-truss subgraph - same vertex set as the graph, only the edges of the k-truss
+			* @param gt: output graph
+			* @param k: truss level, max_truss() by default
+			* @returns number of edges of @gt, -1 if error
+			*/
+			int truss_subgraph(Graph_t& gt, int k = 0)		const;
+
+			//////////////
+			// private interface
+		private:
+
+			/*
+			* @brief |@a & @b| (fused AND-popcount)
+			*/
+			static int and_popc(const BBScan& a, const BBScan& b);
+			static int and_popc(const BBScanSp& a, const BBScanSp& b);
+
+			/*
+			* @brief calls @f(x) for every element x of @a & @b
+			*/
+			template<class Func>
+			static void for_each_and(const BBScan& a, const BBScan& b, Func f);
+			template<class Func>
+			static void for_each_and(const BBScanSp& a, const BBScanSp& b, Func f);
+
+			/*
+			* @brief id of edge (@u, @w), @u < @w, given the row @nu = N(@u) - NO_EDGE if it is not an edge
+			*/
+			edge_t edge_rank(const BBScan& nu, int u, int w)	const;
+			edge_t edge_rank(const BBScanSp& nu, int u, int w)	const;
+
+			/*
+			* @brief per-block prefix counts of the rows (dense graphs)
+			*/
+			void build_prefix(const BBScan&);
+			void build_prefix(const BBScanSp&) {}
+
+			/*
+			* @brief edge peeling with a bucket queue over edges (requires the supports)
+			*/
+			void peel();
+
+			/*
+			* @brief decrements the support of edge @f and moves it to the previous bucket
+			*/
+			void decrement(edge_t f);
+
+			///////////
+			// data members
+		private:
+
+			Graph_t& g_;
+			int NV_;
+			std::vector<edge_t> off_;										//off_[u]: id of the first edge (u, w), w > u (size NV_ + 1)
+			vint adj_;														//adj_[e]: endpoint w > u of edge e, increasing in each row
+			vint src_;														//src_[e]: endpoint u < w of edge e
+			vint pre_;														//pre_[u * NBB + b]: neighbors w of u, u < w < 64b (dense graphs)
+
+			vint sup_;														//support of each edge
+			vint truss_;													//trussness of each edge
+			int maxTruss_ = 0;
+
+			//bucket queue (peeling)
+			vint cur_;														//current support of each edge
+			std::vector<edge_t> bin_;										//bin_[s]: first position in edg_ of edges with support s
+			std::vector<edge_t> pos_;										//pos_[e]: position of edge e in edg_
+			std::vector<edge_t> edg_;										//edges sorted by current support
+		};
+
+	}//end namespace _impl
+
+	using _impl::KTruss;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	const typename KTruss<Graph_t>::edge_t KTruss<Graph_t>::NO_EDGE;
+
+	template<class Graph_t>
+	inline
+		KTruss<Graph_t>::KTruss(Graph_t& g) :
+		g_(g), NV_(g.number_of_vertices()), off_(NV_ + 1, 0)
+	{
+		//per-row offsets of the edges (u, w), w > u
+		for (auto u = 0; u < NV_; ++u) {
+			off_[u + 1] = off_[u];
+			auto& nu = g_.neighbors(u);
+			if (nu.is_empty() || nu.init_scan(bbo::NON_DESTRUCTIVE) == -1) { continue; }
+
+			int w = BBObject::noBit;
+			while ((w = nu.next_bit()) != BBObject::noBit) {
+				if (w > u) {
+					adj_.emplace_back(w);
+					src_.emplace_back(u);
+					++off_[u + 1];
+				}
+			}
+		}
+
+		if (NV_ > 0) { build_prefix(g_.neighbors(0)); }
+	}
+
+	template<class Graph_t>
+	inline
+		void KTruss<Graph_t>::build_prefix(const BBScan&)
+	{
+		const int NBB = g_.number_of_blocks();
+		pre_.assign(static_cast<std::size_t>(NV_) * NBB, 0);
+		for (auto u = 0; u < NV_; ++u) {
+			const _bbt& nu = g_.neighbors(u);
+			int* pu = &pre_[static_cast<std::size_t>(u) * NBB];
+			int cnt = 0;
+			for (auto nBB = WDIV(u); nBB < NBB; ++nBB) {
+				pu[nBB] = cnt;
+				BITBOARD bb = nu.block(nBB);
+				if (nBB == WDIV(u)) { bb &= ~((bblock::MASK_BIT(WMOD(u)) << 1) - 1); }		//w > u
+				cnt += bblock::popc64(bb);
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		typename KTruss<Graph_t>::edge_t KTruss<Graph_t>::edge_rank(const BBScan& nu, int u, int w) const
+	{
+		const int nBB = WDIV(w);
+		BITBOARD bb = nu.block(nBB);
+		if (!(bb & bblock::MASK_BIT(WMOD(w)))) { return NO_EDGE; }
+
+		bb &= bblock::MASK_BIT(WMOD(w)) - 1;											//below w
+		if (nBB == WDIV(u)) { bb &= ~((bblock::MASK_BIT(WMOD(u)) << 1) - 1); }			//above u
+		return off_[u] + pre_[static_cast<std::size_t>(u) * g_.number_of_blocks() + nBB] + bblock::popc64(bb);
+	}
+
+	template<class Graph_t>
+	inline
+		typename KTruss<Graph_t>::edge_t KTruss<Graph_t>::edge_rank(const BBScanSp&, int u, int w) const
+	{
+		auto first = adj_.begin() + off_[u];
+		auto last = adj_.begin() + off_[u + 1];
+		auto it = std::lower_bound(first, last, w);
+		if (it == last || *it != w) { return NO_EDGE; }
+		return static_cast<edge_t>(it - adj_.begin());
+	}
+
+	template<class Graph_t>
+	inline
+		typename KTruss<Graph_t>::edge_t KTruss<Graph_t>::edge_id(int u, int w) const
+	{
+		if (u > w) { std::swap(u, w); }
+		if (u < 0 || w >= NV_ || u == w) { return NO_EDGE; }
+		return edge_rank(g_.neighbors(u), u, w);
+	}
+
+	template<class Graph_t>
+	inline
+		std::pair<int, int> KTruss<Graph_t>::edge(edge_t e) const
+	{
+		return std::make_pair(src_[e], adj_[e]);
+	}
+
+	template<class Graph_t>
+	inline
+		int KTruss<Graph_t>::trussness(int u, int w) const
+	{
+		edge_t e = edge_id(u, w);
+		return (e == NO_EDGE) ? EMPTY_ELEM : truss_[e];
+	}
+
+	template<class Graph_t>
+	inline
+		int KTruss<Graph_t>::and_popc(const BBScan& a, const BBScan& b)
+	{
+		int pc = 0;
+		for (auto nBB = 0; nBB < a.number_of_blocks(); ++nBB) {
+			pc += bblock::popc64(a.block(nBB) & b.block(nBB));
+		}
+		return pc;
+	}
+
+	template<class Graph_t>
+	inline
+		int KTruss<Graph_t>::and_popc(const BBScanSp& a, const BBScanSp& b)
+	{
+		int pc = 0;
+		auto itA = a.cbegin(), itB = b.cbegin();
+		while (itA != a.cend() && itB != b.cend()) {
+			if (itA->idx_ < itB->idx_) { ++itA; }
+			else if (itA->idx_ > itB->idx_) { ++itB; }
+			else {
+				pc += bblock::popc64(itA->bb_ & itB->bb_);
+				++itA; ++itB;
+			}
+		}
+		return pc;
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void KTruss<Graph_t>::for_each_and(const BBScan& a, const BBScan& b, Func f)
+	{
+		for (auto nBB = 0; nBB < a.number_of_blocks(); ++nBB) {
+			BITBOARD bb = a.block(nBB) & b.block(nBB);
+			while (bb) {
+				f(WMUL(nBB) + bblock::lsb64_intrinsic(bb));
+				bb &= bb - 1;
+			}
+		}
+	}
+
+	template<class Graph_t>
+	template<class Func>
+	inline
+		void KTruss<Graph_t>::for_each_and(const BBScanSp& a, const BBScanSp& b, Func f)
+	{
+		auto itA = a.cbegin(), itB = b.cbegin();
+		while (itA != a.cend() && itB != b.cend()) {
+			if (itA->idx_ < itB->idx_) { ++itA; }
+			else if (itA->idx_ > itB->idx_) { ++itB; }
+			else {
+				BITBOARD bb = itA->bb_ & itB->bb_;
+				while (bb) {
+					f(WMUL(itA->idx_) + bblock::lsb64_intrinsic(bb));
+					bb &= bb - 1;
+				}
+				++itA; ++itB;
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		int KTruss<Graph_t>::compute_support(int nThreads)
+	{
+		sup_.assign(adj_.size(), 0);
+		nThreads = com::thread_count(nThreads, NV_ / CHUNK_ROWS);
+
+		//rows are taken in chunks from an atomic cursor - row costs are very uneven
+		//(only block reads, so the bitsets are shared safely among threads)
+		std::atomic<int> next(0);
+		auto worker = [&]() {
+			int first;
+			while ((first = next.fetch_add(CHUNK_ROWS)) < NV_) {
+				int last = std::min(first + static_cast<int>(CHUNK_ROWS), NV_);
+				for (auto u = first; u < last; ++u) {
+					const _bbt& nu = g_.neighbors(u);
+					for (auto e = off_[u]; e < off_[u + 1]; ++e) {
+						sup_[e] = and_popc(nu, g_.neighbors(adj_[e]));
+					}
+				}
+			}
+		};
+
+		com::run_parallel(nThreads, [&worker](int) { worker(); });
+
+		return 0;
+	}
+
+	template<class Graph_t>
+	inline
+		int KTruss<Graph_t>::find_truss(int nThreads)
+	{
+		compute_support(nThreads);
+		peel();
+		return maxTruss_;
+	}
+
+	template<class Graph_t>
+	inline
+		void KTruss<Graph_t>::decrement(edge_t f)
+	{
+		//swaps f with the first edge of its bucket, which then starts one position later
+		int s = cur_[f];
+		edge_t pf = pos_[f];
+		edge_t pg = bin_[s];
+		edge_t g = edg_[pg];
+		if (g != f) {
+			pos_[f] = pg; pos_[g] = pf;
+			edg_[pf] = g; edg_[pg] = f;
+		}
+		++bin_[s];
+		--cur_[f];
+	}
+
+	template<class Graph_t>
+	inline
+		void KTruss<Graph_t>::peel()
+	{
+		const edge_t NE = adj_.size();
+		truss_.assign(NE, 0);
+		maxTruss_ = 0;
+		if (NE == 0) { return; }
+
+		//bucket sort of the edges by support
+		cur_ = sup_;
+		int maxSup = *std::max_element(cur_.begin(), cur_.end());
+		bin_.assign(maxSup + 1, 0);
+		for (auto s : cur_) { ++bin_[s]; }
+		edge_t start = 0;
+		for (auto s = 0; s <= maxSup; ++s) {
+			edge_t num = bin_[s];
+			bin_[s] = start;
+			start += num;
+		}
+		pos_.resize(NE);
+		edg_.resize(NE);
+		for (edge_t e = 0; e < NE; ++e) {
+			pos_[e] = bin_[cur_[e]]++;
+			edg_[pos_[e]] = e;
+		}
+		for (auto s = maxSup; s > 0; --s) {
+			bin_[s] = bin_[s - 1];
+		}
+		bin_[0] = 0;
+
+		//remaining graph
+		std::vector<_bbt> rem;
+		rem.reserve(NV_);
+		for (auto v = 0; v < NV_; ++v) {
+			rem.emplace_back(g_.neighbors(v));
+		}
+
+		//peeling in non-decreasing support
+		for (edge_t i = 0; i < NE; ++i) {
+			edge_t e = edg_[i];
+			int k = cur_[e];
+			int u = src_[e], w = adj_[e];
+			truss_[e] = k + 2;
+
+			//remaining triangles (u, w, x) lose edge e
+			for_each_and(rem[u], rem[w], [&](int x) {
+				edge_t fu = edge_id(u, x);
+				edge_t fw = edge_id(w, x);
+				if (cur_[fu] > k) { decrement(fu); }
+				if (cur_[fw] > k) { decrement(fw); }
+			});
+
+			rem[u].erase_bit(w);
+			rem[w].erase_bit(u);
+		}
+
+		maxTruss_ = *std::max_element(truss_.begin(), truss_.end());
+	}
+
+	template<class Graph_t>
+	inline
+		typename KTruss<Graph_t>::vedge KTruss<Graph_t>::truss_edges(int k) const
+	{
+		if (k <= 0) { k = maxTruss_; }
+
+		vedge res;
+		for (edge_t e = 0; e < truss_.size(); ++e) {
+			if (truss_[e] >= k) {
+				res.emplace_back(src_[e], adj_[e]);
+			}
+		}
+		return res;
+	}
+
+	template<class Graph_t>
+	inline
+		int KTruss<Graph_t>::truss_subgraph(Graph_t& gt, int k) const
+	{
+		if (truss_.size() != adj_.size()) {
+			LOG_ERROR("truss decomposition not computed - KTruss<Graph_t>::truss_subgraph");
+			return -1;
+		}
+
+		if (gt.reset(NV_) == -1) {
+			LOGG_ERROR("error when allocating the subgraph - KTruss<Graph_t>::truss_subgraph");
+			return -1;
+		}
+
+		int nE = 0;
+		for (auto& e : truss_edges(k)) {
+			gt.add_edge(e.first, e.second);
+			++nE;
+		}
+		return nE;
+	}
+
+}//end namespace bitgraph
+
+#endif
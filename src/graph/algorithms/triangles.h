@@ -0,0 +1,478 @@
+/**
+* @file triangles.h
+* @brief header for class TriangleCount, triangle counting and clustering coefficients of simple undirected graphs
+* @details: edges are oriented from lower to higher rank, either by (degree, index) or by a degeneracy ordering,
+*			so every triangle {a, b, c} with rank(a) < rank(b) < rank(c) is counted once, as the common
+*			out-neighbor c of the oriented edge a->b: T = sum over oriented edges (u, v) of |N+(u) & N+(v)|
+*			[Chiba and Nishizeki 1985, Schank and Wagner 2005].
+* @details: dense graphs (Ugraph<BBScan>) - N+ rows form an upper triangular bit matrix in rank space, and
+*			the popcounts are cache-blocked: a tile of rows is processed column tile by column tile, so the
+*			row segments of a tile are reused from cache by all the out-neighbors of the rows in the tile.
+*			Sparse graphs (Ugraph<BBScanSp>) - N+ lists are sorted CSR arrays and intersections are merges.
+* @details: rows are shared among threads in tiles taken from an atomic cursor, each thread accumulates its
+*			own counters (global and per vertex) which are added at the end.
+* @details: per-vertex counts are also an ordering key in GraphFastRootSort (MAX_TRIANGLES, MIN_TRIANGLES),
+*			passed with GraphFastRootSort::set_triangles(TriangleCount::triangles())
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __TRIANGLES_H__
+#define __TRIANGLES_H__
+
+#include "graph/simple_ugraph.h"
+#include "graph/algorithms/kcore_parallel.h"
+#include "bitscan/bitscan.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "utils/task.h"
+#include <vector>
+#include <atomic>
+#include <algorithm>
+#include <type_traits>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		///////////////////
+		//
+		// TriangleCount class
+		//
+		// Triangles of a graph - global and per vertex, clustering coefficients
+		//
+		////////////////////
+
+		template<class Graph_t>
+		class TriangleCount {
+
+			static_assert(std::is_same<bitgraph::Ugraph<BBScan>, Graph_t>::value ||
+				std::is_same<bitgraph::Ugraph<BBScanSp>, Graph_t>::value, "TriangleCount<Graph_t> requires Ugraph<BBScan> or Ugraph<BBScanSp>");
+
+		public:
+			using type = TriangleCount<Graph_t>;
+			using graph_type = Graph_t;
+			using basic_type = typename Graph_t::_bbt;
+			using is_dense = std::is_same<basic_type, BBScan>;
+
+			//alias types for backward compatibility
+			using _gt = graph_type;
+			using _bbt = basic_type;
+
+			enum orient_t { DEGREE = 0, DEGENERACY };
+			enum { ROW_TILE = 64 };											//rows per tile (unit of work of a thread)
+			enum { COL_TILE = 32 };											//bitblocks per column tile (dense graphs)
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @brief orients the edges of @g
+			* @param o: orientation - by non-decreasing (degree, index) or by a degeneracy ordering
+			* @param nThreads: number of threads for the degeneracy ordering (hardware threads if <= 0)
+			*/
+			explicit TriangleCount(Graph_t& g, orient_t o = DEGREE, int nThreads = 1);
+
+			//copy and move semantics disallowed
+			TriangleCount(const TriangleCount&) = delete;
+			TriangleCount& operator =			(const TriangleCount&) = delete;
+			TriangleCount(TriangleCount&&) = delete;
+			TriangleCount& operator =			(TriangleCount&&) = delete;
+
+			~TriangleCount() = default;
+
+			////////////////
+			//setters and getters
+
+			int number_of_vertices()						const { return NV_; }
+
+			/*
+			* @brief maximum out-degree of the orientation
+			*/
+			int max_out_degree()							const;
+
+			/*
+			* @brief vertices in rank order (the orientation)
+			*/
+			const vint& ordering()							const { return ord_; }
+
+			/*
+			* @brief number of triangles (must be called after count() or count_per_vertex())
+			*/
+			uint64_t number_of_triangles()					const { return nTri_; }
+
+			/*
+			* @brief triangles of each vertex (must be called after count_per_vertex())
+			*/
+			const std::vector<uint64_t>& triangles()		const { return tri_; }
+			uint64_t triangles(int v)						const { return tri_[v]; }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief Counts the triangles of the graph (popcounts only)
+			* @param nThreads: number of threads (hardware threads if <= 0)
+			* @returns number of triangles
+			*/
+			uint64_t count(int nThreads = 1);
+
+			/*
+			* @brief Counts the triangles of the graph and of every vertex
+			* @param nThreads: number of threads (hardware threads if <= 0)
+			* @returns number of triangles
+			*/
+			uint64_t count_per_vertex(int nThreads = 1);
+
+			/*
+			* @brief local clustering coefficient of @v, 2t(v) / (d(v)(d(v) - 1)), 0 if d(v) < 2
+			*		 (must be called after count_per_vertex())
+			*/
+			double clustering(int v)						const;
+
+			/*
+			* @brief local clustering coefficients of all vertices (must be called after count_per_vertex())
+			*/
+			std::vector<double> clustering()				const;
+
+			/*
+			* @brief average local clustering coefficient (must be called after count_per_vertex())
+			*/
+			double average_clustering()						const;
+
+			/*
+			* @brief global clustering coefficient, 3T / number of paths of length 2 (wedges)
+			*		 (must be called after count() or count_per_vertex())
+			*/
+			double transitivity()							const;
+
+			//////////////
+			// private interface
+		private:
+
+			/*
+			* @brief oriented CSR lists (increasing rank) and, for dense graphs, the N+ bit matrix
+			*/
+			void orient(orient_t o, int nThreads);
+
+			/*
+			* @brief parallel driver - tiles of rows from an atomic cursor
+			*/
+			template<bool PerVertex>
+			uint64_t run(int nThreads);
+
+			/*
+			* @brief triangles with lowest rank vertex in [@first, @last)
+			* @param tv: per-rank counters (only if PerVertex)
+			* @returns number of triangles
+			*/
+			template<bool PerVertex>
+			uint64_t count_rows(int first, int last, uint64_t* tv, std::true_type /* dense */);
+			template<bool PerVertex>
+			uint64_t count_rows(int first, int last, uint64_t* tv, std::false_type /* sparse */);
+
+			///////////
+			// data members
+		private:
+
+			Graph_t& g_;
+			const int NV_;
+			vint ord_;														//ord_[r]: vertex of rank r
+			vint deg_;														//degree of each vertex
+			std::vector<std::size_t> outStart_;								//N+(r) = outAdj_[outStart_[r]..outStart_[r + 1]) (ranks)
+			vint outAdj_;
+
+			//dense graphs
+			int NBB_ = 0;													//bitblocks per row of the matrix
+			std::vector<BITBOARD> mat_;										//N+ rows in rank space, row r at r * NBB_
+			vint hi_;														//last non-empty block of each row, -1 if empty
+
+			uint64_t nTri_ = 0;
+			std::vector<uint64_t> tri_;										//triangles of each vertex
+		};
+
+	}//end namespace _impl
+
+	using _impl::TriangleCount;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	template<class Graph_t>
+	inline
+		TriangleCount<Graph_t>::TriangleCount(Graph_t& g, orient_t o, int nThreads) :
+		g_(g), NV_(g.number_of_vertices())
+	{
+		orient(o, nThreads);
+	}
+
+	template<class Graph_t>
+	inline
+		int TriangleCount<Graph_t>::max_out_degree() const
+	{
+		int maxOut = 0;
+		for (auto r = 0; r < NV_; ++r) {
+			maxOut = std::max(maxOut, static_cast<int>(outStart_[r + 1] - outStart_[r]));
+		}
+		return maxOut;
+	}
+
+	template<class Graph_t>
+	inline
+		void TriangleCount<Graph_t>::orient(orient_t o, int nThreads)
+	{
+		deg_.assign(NV_, 0);
+		for (auto v = 0; v < NV_; ++v) {
+			deg_[v] = g_.degree(v);
+		}
+
+		//ranks
+		if (o == DEGENERACY && NV_ > 0) {
+			KCoreParallel kc(g_, nThreads);
+			kc.find_kcore(nThreads);
+			ord_ = kc.kcore_ordering();
+		}
+		else {
+
+			//counting sort by degree, stable by index
+			int maxDeg = 0;
+			for (auto d : deg_) { maxDeg = std::max(maxDeg, d); }
+			vint bin(maxDeg + 2, 0);
+			for (auto d : deg_) { ++bin[d + 1]; }
+			for (auto d = 1; d <= maxDeg + 1; ++d) { bin[d] += bin[d - 1]; }
+			ord_.assign(NV_, 0);
+			for (auto v = 0; v < NV_; ++v) {
+				ord_[bin[deg_[v]]++] = v;
+			}
+		}
+
+		vint rank(NV_);
+		for (auto r = 0; r < NV_; ++r) {
+			rank[ord_[r]] = r;
+		}
+
+		//oriented CSR - filled by increasing head rank, so every list is sorted
+		outStart_.assign(NV_ + 1, 0);
+		for (auto v = 0; v < NV_; ++v) {
+			auto& nv = g_.neighbors(v);
+			if (nv.is_empty() || nv.init_scan(bbo::NON_DESTRUCTIVE) == -1) { continue; }
+			int w = BBObject::noBit;
+			while ((w = nv.next_bit()) != BBObject::noBit) {
+				if (rank[w] > rank[v]) { ++outStart_[rank[v] + 1]; }
+			}
+		}
+		for (auto r = 0; r < NV_; ++r) {
+			outStart_[r + 1] += outStart_[r];
+		}
+
+		outAdj_.assign(outStart_[NV_], 0);
+		std::vector<std::size_t> cur(outStart_.begin(), outStart_.end() - 1);
+		for (auto s = 0; s < NV_; ++s) {
+			auto& nv = g_.neighbors(ord_[s]);
+			if (nv.is_empty() || nv.init_scan(bbo::NON_DESTRUCTIVE) == -1) { continue; }
+			int w = BBObject::noBit;
+			while ((w = nv.next_bit()) != BBObject::noBit) {
+				if (rank[w] < s) { outAdj_[cur[rank[w]]++] = s; }
+			}
+		}
+
+		//N+ bit matrix (dense graphs)
+		if (is_dense::value) {
+			NBB_ = INDEX_1TO1(NV_);
+			mat_.assign(static_cast<std::size_t>(NV_) * NBB_, 0);
+			hi_.assign(NV_, -1);
+			for (auto r = 0; r < NV_; ++r) {
+				BITBOARD* row = &mat_[static_cast<std::size_t>(r) * NBB_];
+				for (auto i = outStart_[r]; i < outStart_[r + 1]; ++i) {
+					row[WDIV(outAdj_[i])] |= bblock::MASK_BIT(WMOD(outAdj_[i]));
+				}
+				if (outStart_[r + 1] > outStart_[r]) { hi_[r] = WDIV(outAdj_[outStart_[r + 1] - 1]); }
+			}
+		}
+	}
+
+	template<class Graph_t>
+	inline
+		uint64_t TriangleCount<Graph_t>::count(int nThreads)
+	{
+		nTri_ = run<false>(nThreads);
+		return nTri_;
+	}
+
+	template<class Graph_t>
+	inline
+		uint64_t TriangleCount<Graph_t>::count_per_vertex(int nThreads)
+	{
+		nTri_ = run<true>(nThreads);
+		return nTri_;
+	}
+
+	template<class Graph_t>
+	template<bool PerVertex>
+	inline
+		uint64_t TriangleCount<Graph_t>::run(int nThreads)
+	{
+		nThreads = com::thread_count(nThreads, NV_ / ROW_TILE);
+
+		std::vector<uint64_t> tot(nThreads, 0);
+		std::vector<std::vector<uint64_t>> tv(nThreads);
+		std::atomic<int> next(0);
+
+		auto worker = [&](int t) {
+			if (PerVertex) { tv[t].assign(NV_, 0); }
+			int first;
+			while ((first = next.fetch_add(ROW_TILE)) < NV_) {
+				int last = std::min(first + static_cast<int>(ROW_TILE), NV_);
+				tot[t] += count_rows<PerVertex>(first, last, tv[t].data(), is_dense());
+			}
+		};
+
+		com::run_parallel(nThreads, worker);
+
+		//reduction
+		uint64_t nTri = 0;
+		for (auto t = 0; t < nThreads; ++t) {
+			nTri += tot[t];
+		}
+
+		if (PerVertex) {
+			tri_.assign(NV_, 0);
+			for (auto r = 0; r < NV_; ++r) {
+				uint64_t c = 0;
+				for (auto t = 0; t < nThreads; ++t) { c += tv[t][r]; }
+				tri_[ord_[r]] = c;
+			}
+		}
+
+		return nTri;
+	}
+
+	template<class Graph_t>
+	template<bool PerVertex>
+	inline
+		uint64_t TriangleCount<Graph_t>::count_rows(int first, int last, uint64_t* tv, std::true_type)
+	{
+		uint64_t nTri = 0;
+
+		//column tiles - all bits of rows in [first, last) are beyond WDIV(first)
+		for (auto J0 = WDIV(first); J0 < NBB_; J0 += COL_TILE) {
+			const int J1 = std::min(J0 + static_cast<int>(COL_TILE), NBB_) - 1;
+
+			for (auto r = first; r < last; ++r) {
+				if (hi_[r] < J0) { continue; }
+				const BITBOARD* pr = &mat_[static_cast<std::size_t>(r) * NBB_];
+
+				for (auto i = outStart_[r]; i < outStart_[r + 1]; ++i) {
+					const int s = outAdj_[i];
+					const int lo = std::max(J0, WDIV(s));
+					if (lo > J1) { break; }									//s and beyond - out of the tile
+					const int hi = std::min(J1, std::min(hi_[r], hi_[s]));
+					const BITBOARD* ps = &mat_[static_cast<std::size_t>(s) * NBB_];
+
+					uint64_t c = 0;
+					for (auto b = lo; b <= hi; ++b) {
+						BITBOARD bb = pr[b] & ps[b];
+						c += bblock::popc64(bb);
+						if (PerVertex) {
+							while (bb) {
+								++tv[WMUL(b) + bblock::lsb64_intrinsic(bb)];
+								bb &= bb - 1;
+							}
+						}
+					}
+
+					if (PerVertex) { tv[r] += c; tv[s] += c; }
+					nTri += c;
+				}
+			}
+		}
+
+		return nTri;
+	}
+
+	template<class Graph_t>
+	template<bool PerVertex>
+	inline
+		uint64_t TriangleCount<Graph_t>::count_rows(int first, int last, uint64_t* tv, std::false_type)
+	{
+		uint64_t nTri = 0;
+		const int* adj = outAdj_.data();
+
+		for (auto r = first; r < last; ++r) {
+			const std::size_t endR = outStart_[r + 1];
+
+			for (auto i = outStart_[r]; i < endR; ++i) {
+				const int s = adj[i];
+
+				//N+(r) after s (common out-neighbors have rank > s) merged with N+(s)
+				std::size_t a = i + 1, b = outStart_[s];
+				const std::size_t endS = outStart_[s + 1];
+				uint64_t c = 0;
+				while (a < endR && b < endS) {
+					if (adj[a] < adj[b]) { ++a; }
+					else if (adj[a] > adj[b]) { ++b; }
+					else {
+						if (PerVertex) { ++tv[adj[a]]; }
+						++c; ++a; ++b;
+					}
+				}
+
+				if (PerVertex) { tv[r] += c; tv[s] += c; }
+				nTri += c;
+			}
+		}
+
+		return nTri;
+	}
+
+	template<class Graph_t>
+	inline
+		double TriangleCount<Graph_t>::clustering(int v) const
+	{
+		const double d = deg_[v];
+		return (d < 2) ? 0.0 : 2.0 * tri_[v] / (d * (d - 1));
+	}
+
+	template<class Graph_t>
+	inline
+		std::vector<double> TriangleCount<Graph_t>::clustering() const
+	{
+		std::vector<double> res(NV_);
+		for (auto v = 0; v < NV_; ++v) {
+			res[v] = clustering(v);
+		}
+		return res;
+	}
+
+	template<class Graph_t>
+	inline
+		double TriangleCount<Graph_t>::average_clustering() const
+	{
+		if (NV_ == 0) { return 0.0; }
+
+		double sum = 0.0;
+		for (auto v = 0; v < NV_; ++v) {
+			sum += clustering(v);
+		}
+		return sum / NV_;
+	}
+
+	template<class Graph_t>
+	inline
+		double TriangleCount<Graph_t>::transitivity() const
+	{
+		double nWedges = 0.0;
+		for (auto d : deg_) {
+			nWedges += 0.5 * d * (d - 1.0);
+		}
+		return (nWedges == 0.0) ? 0.0 : 3.0 * nTri_ / nWedges;
+	}
+
+}//end namespace bitgraph
+
+#endif
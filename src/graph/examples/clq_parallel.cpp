@@ -0,0 +1,58 @@
+/**
+* @file clq_parallel.cpp
+* @brief Example of the multi-threaded exact maximum clique algorithm (class CliqueParallel).
+*		 Reports the speedup w.r.t. one thread for 1, 2, 4, ... up to <max threads> threads
+*		 on uniform random graphs generated with RandomGen
+* @details: created 17/10/2026, last_update 17/10/2026
+**/
+
+#include <iostream>
+#include <cstdlib>
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/clique/clq_parallel.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+
+using namespace std;
+using namespace bitgraph;
+
+int main(int argc, char** argv) {
+	if (argc != 4) {
+		LOG_ERROR("Incorrect number of parameters");
+		LOG_ERROR("Required <number of vertices> <density> <max threads>");
+		LOG_ERROR("exiting...");
+		return -1;
+	}
+
+	//read params
+	int NV = atoi(argv[1]);
+	double p = atof(argv[2]);
+	int maxThreads = atoi(argv[3]);
+
+	ugraph ug;
+	if (RandomGen<ugraph>::create_graph(ug, NV, p) == -1) {
+		LOG_ERROR("unable to generate random graph, exiting...");
+		return -1;
+	}
+
+	double tseq = 0.0;
+	for (int nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+
+		CliqueParallel<ugraph> cp(ug);
+		cp.number_of_threads(nThreads);
+
+		///////////////////
+		int omega = cp.run();
+		///////////////////
+
+		double t = cp.info().search_time();
+		if (nThreads == 1) { tseq = t; }
+
+		//I/O
+		LOGG_INFO("[", ug.name(), " threads:", nThreads, " w:", omega, " steps:", cp.info().number_of_steps(),
+					" t(s):", t, " speedup:", (t > 0.0 ? tseq / t : 0.0), "]");
+	}
+
+	return 0;
+}
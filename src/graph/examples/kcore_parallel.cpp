@@ -0,0 +1,79 @@
+/**
+* @file kcore_parallel.cpp
+* @brief Example of the multi-threaded k-core decomposition (class KCoreParallel).
+*		 Compares the decomposition time with the sequential bin-sort KCore and reports the speedup
+*		 w.r.t. one thread for 1, 2, 4, ... up to <max threads> threads on uniform random sparse graphs
+*		 generated with SparseRandomGen
+* @details: created 17/10/2026, last_update 17/10/2026
+**/
+
+#include <iostream>
+#include <cstdlib>
+#include <memory>
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/kcore_parallel.h"
+#include "utils/common.h"
+#include "utils/prec_timer.h"
+#include "utils/logger.h"
+
+using namespace std;
+using namespace bitgraph;
+
+int main(int argc, char** argv) {
+	if (argc != 4) {
+		LOG_ERROR("Incorrect number of parameters");
+		LOG_ERROR("Required <number of vertices> <density> <max threads>");
+		LOG_ERROR("exiting...");
+		return -1;
+	}
+
+	//read params
+	int NV = atoi(argv[1]);
+	double p = atof(argv[2]);
+	int maxThreads = atoi(argv[3]);
+
+	sparse_ugraph sug;
+	std::unique_ptr<SparseRandomGen<sparse_ugraph>> gen(new SparseRandomGen<sparse_ugraph>());
+	if (gen->create_ugraph(sug, NV, p) == -1) {
+		LOG_ERROR("unable to generate random graph, exiting...");
+		return -1;
+	}
+
+	PrecisionTimer pt;
+
+	//sequential KCore
+	KCore<sparse_ugraph> kc(sug);
+	pt.wall_tic();
+	///////////////////
+	kc.find_kcore();
+	///////////////////
+	double tkc = pt.wall_toc();
+
+	LOGG_INFO("[KCore n:", NV, " m:", sug.number_of_edges(), " kmax:", kc.max_core_number(), " t(s):", tkc, "]");
+
+	//CSR build
+	pt.wall_tic();
+	KCoreParallel kcp(sug, maxThreads);
+	double tcsr = pt.wall_toc();
+	LOGG_INFO("[KCoreParallel CSR build threads:", maxThreads, " t(s):", tcsr, "]");
+
+	double tseq = 0.0;
+	for (int nThreads = 1; nThreads <= maxThreads; nThreads *= 2) {
+
+		pt.wall_tic();
+		///////////////////
+		kcp.find_kcore(nThreads);
+		///////////////////
+		double t = pt.wall_toc();
+		if (nThreads == 1) { tseq = t; }
+
+		//I/O
+		LOGG_INFO("[KCoreParallel threads:", nThreads, " kmax:", kcp.max_core_number(), " rounds:", kcp.number_of_rounds(),
+					" t(s):", t, " speedup:", (t > 0.0 ? tseq / t : 0.0), " vs KCore:", (t > 0.0 ? tkc / t : 0.0),
+					(kcp.coreness_numbers() == kc.coreness_numbers() ? "" : " CORENESS MISMATCH"), "]");
+	}
+
+	return 0;
+}
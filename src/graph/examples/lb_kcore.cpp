@@ -37,6 +37,7 @@ int main(int argc, char** argv){
 	vector<int> heurCLQ;
 	PrecisionTimer pt;
 		
+	pt.wall_tic();
 	pt.cpu_tic();
 	if(nIter == EMPTY_ELEM)
 		/////////////////////////////////////////		
@@ -48,10 +49,11 @@ int main(int argc, char** argv){
 		///////////////////////////////////////////////	
 	}
 	double time_sec = pt.wall_toc();
+	double cpu_sec = pt.cpu_toc();
 	///////////////////////////////
 
 	//I/O
-	LOGG_INFO("\n[t:" , time_sec , "," , " Smax:" , heurCLQ.size() , "]\n");
+	LOGG_INFO("\n[t:" , time_sec , "," , " cpu:" , cpu_sec , "," , " Smax:" , heurCLQ.size() , "]\n");
 	_stl::print_collection(heurCLQ);
 }
 
@@ -504,6 +504,9 @@ namespace bitgraph {
 		template class  Graph_W<ugraph, int>;
 		template class  Graph_W<ugraph, double>;
 
+		template class  Base_Graph_W<Ugraph<sparse_bitarray>, int>;
+		template class  Base_Graph_W<Ugraph<sparse_bitarray>, double>;
+
 		//other specializations... (sparse_graph)
 
 	} // namespace _impl
@@ -862,7 +862,7 @@ namespace bitgraph {
 		if (lazy || ptype::NE_ == 0) {
 
 			ptype::NE_ = 0;
-			for (auto i = 0u; i < ptype::NV_ - 1; i++) {
+			for (auto i = 0u; i + 1 < ptype::NV_; i++) {
 
 				//popuation count from i + 1 onwards
 				ptype::NE_ += adj_[i].size(i + 1, -1);
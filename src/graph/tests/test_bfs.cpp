@@ -0,0 +1,186 @@
+/**
+* @file  test_bfs.cpp
+* @brief Unit tests for the direction-optimizing breadth-first search (class BFS)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/bfs.h"
+#include <queue>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief BFS levels by a FIFO queue over the adjacency matrix
+	*/
+	template<class Graph_t>
+	vint queue_levels(Graph_t& g, int src) {
+		const int NV = g.number_of_vertices();
+		vint lev(NV, EMPTY_ELEM);
+		std::queue<int> q;
+		lev[src] = 0;
+		q.push(src);
+		while (!q.empty()) {
+			int u = q.front();
+			q.pop();
+			for (int v = 0; v < NV; ++v) {
+				if (lev[v] == EMPTY_ELEM && g.is_edge(u, v)) {
+					lev[v] = lev[u] + 1;
+					q.push(v);
+				}
+			}
+		}
+		return lev;
+	}
+}
+
+TEST(BFS, path) {
+
+	//path 0-1-...-9 and isolated vertex 10
+	const int NV = 11;
+	ugraph ug(NV);
+	for (int v = 0; v < 9; ++v) { ug.add_edge(v, v + 1); }
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	BFS<ugraph> bfs(ug);
+	BFS<sparse_ugraph> bfss(sug);
+
+	//////////////////////
+	EXPECT_EQ(9, bfs.run(0));
+	//////////////////////
+
+	EXPECT_EQ(9, bfss.run(0));
+	for (int v = 0; v < 10; ++v) {
+		EXPECT_EQ(v, bfs.level(v));
+		EXPECT_EQ(v, bfss.level(v));
+	}
+	EXPECT_EQ(EMPTY_ELEM, bfs.level(10));
+	EXPECT_EQ(10, bfs.number_of_visited());
+	EXPECT_EQ(9, bfs.farthest_vertex());
+	EXPECT_EQ(10, bfs.number_of_steps(BFS<ugraph>::TOP_DOWN) + bfs.number_of_steps(BFS<ugraph>::BOTTOM_UP));		//last step finds no vertices
+
+	//depth limit
+	EXPECT_EQ(3, bfs.run(4, 3));
+	EXPECT_EQ(EMPTY_ELEM, bfs.level(0));
+	EXPECT_EQ(3, bfs.level(1));
+	EXPECT_EQ(3, bfs.level(7));
+	EXPECT_EQ(EMPTY_ELEM, bfs.level(8));
+
+	//isolated vertex and bad source
+	EXPECT_EQ(0, bfs.run(10));
+	EXPECT_EQ(1, bfs.number_of_visited());
+	EXPECT_EQ(-1, bfs.run(NV));
+}
+
+TEST(BFS, k_hop_and_diameter) {
+
+	//cycle of 12 vertices - diameter 6
+	const int NV = 12;
+	ugraph ug(NV);
+	for (int v = 0; v < NV; ++v) { ug.add_edge(v, (v + 1) % NV); }
+
+	BFS<ugraph> bfs(ug);
+	BBScan bbk;
+	EXPECT_EQ(5, bfs.k_hop(0, 2, bbk));
+	vint hop_exp = { 0, 1, 2, 10, 11 };
+	EXPECT_EQ(hop_exp, static_cast<vint>(bbk));
+
+	EXPECT_EQ(6, bfs.eccentricity(3));
+	auto db = bfs.diameter_bounds(0);
+	EXPECT_EQ(6, db.first);
+	EXPECT_LE(6, db.second);
+
+	//path - the sweeps find the diameter
+	ugraph up(NV);
+	for (int v = 0; v < NV - 1; ++v) { up.add_edge(v, v + 1); }
+	BFS<ugraph> bfsp(up);
+	db = bfsp.diameter_bounds(5, 2);
+	EXPECT_EQ(11, db.first);
+	EXPECT_GE(12, db.second);
+
+	//multiple sources
+	BBScan srcs(NV);
+	srcs.set_bit(0); srcs.set_bit(NV - 1);
+	EXPECT_EQ(5, bfsp.run(srcs));
+	EXPECT_EQ(5, bfsp.level(5));
+	EXPECT_EQ(5, bfsp.level(6));
+}
+
+TEST(BFS, directed) {
+
+	//0->1->2->3, 3->0, 4->0
+	graph g(5);
+	g.add_edge(0, 1); g.add_edge(1, 2); g.add_edge(2, 3);
+	g.add_edge(3, 0); g.add_edge(4, 0);
+
+	BFS<graph> bfs(g);
+	EXPECT_EQ(3, bfs.run(0));
+	EXPECT_EQ(EMPTY_ELEM, bfs.level(4));
+	EXPECT_EQ(4, bfs.run(4));
+	EXPECT_EQ(4, bfs.level(3));
+
+	auto db = bfs.diameter_bounds(0);
+	EXPECT_EQ(-1, db.first);
+}
+
+TEST(BFS, random_graphs) {
+
+	for (double p : { 0.005, 0.02, 0.3 }) {
+		ugraph ug;
+		ParallelRandomGen<ugraph>::create_graph(ug, 700, p, 7);
+		sparse_ugraph sug;
+		GraphConversion::ug2sug(ug, sug);
+
+		graph g(700);
+		for (int u = 0; u < 700; ++u) {
+			for (int v = 0; v < 700; ++v) {
+				if (u != v && ug.is_edge(u, v) && (u + v) % 3 != 0) { g.add_edge(u, v); }
+			}
+		}
+
+		for (int nThreads : { 1, 4 }) {
+			BFS<ugraph> bfs(ug, nThreads);
+			BFS<sparse_ugraph> bfss(sug, nThreads);
+			BFS<graph> bfsd(g, nThreads);
+			for (int src : { 0, 333 }) {
+				vint lev = queue_levels(ug, src);
+				bfs.run(src);
+				EXPECT_EQ(lev, bfs.levels());
+				bfss.run(src);
+				EXPECT_EQ(lev, bfss.levels());
+
+				bfsd.run(src);
+				EXPECT_EQ(queue_levels(g, src), bfsd.levels());
+			}
+		}
+	}
+}
+
+TEST(BFS, direction_switch) {
+
+	//low diameter - the large levels are bottom-up
+	sparse_ugraph sug;
+	ParallelRandomGen<sparse_ugraph>::create_graph(sug, 20000, 0.002, 3);
+
+	BFS<sparse_ugraph> bfs(sug, 2);
+	const int ecc = bfs.run(0);
+	EXPECT_LT(0, bfs.number_of_steps(BFS<sparse_ugraph>::TOP_DOWN));
+	EXPECT_LT(0, bfs.number_of_steps(BFS<sparse_ugraph>::BOTTOM_UP));
+	EXPECT_EQ(ecc + 1, bfs.number_of_steps(BFS<sparse_ugraph>::TOP_DOWN) + bfs.number_of_steps(BFS<sparse_ugraph>::BOTTOM_UP));
+
+	//same levels as a top-down only search (the levels of a sparse graph)
+	vint lev = bfs.levels();
+	BFS<sparse_ugraph> bfs1(sug, 1);
+	bfs1.run(0);
+	EXPECT_EQ(lev, bfs1.levels());
+}
@@ -0,0 +1,143 @@
+/**
+* @file  test_clq_edge_weighted.cpp
+* @brief Unit tests for the exact maximum edge-weighted clique algorithm (class CliqueEdgeWeighted)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_edge_weighted.h"
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief maximum edge-weighted clique by exhaustive enumeration (only for small graphs)
+	*/
+	template<class GraphEW_t>
+	typename GraphEW_t::_wt brute_force_mewc(GraphEW_t& gew) {
+		using W = typename GraphEW_t::_wt;
+		const int NV = gew.number_of_vertices();
+		W best = 0;
+		for (uint32_t mask = 1; mask < (1u << NV); ++mask) {
+			vint lv;
+			for (int v = 0; v < NV; ++v) {
+				if (mask & (1u << v)) { lv.push_back(v); }
+			}
+			if (!gfunc::clq::is_clique(gew.graph(), lv)) { continue; }
+			W w = 0;
+			for (auto i = 0; i < (int)lv.size(); ++i) {
+				for (auto j = i + 1; j < (int)lv.size(); ++j) {
+					w += gew.weight(lv[i], lv[j]);
+				}
+			}
+			best = std::max(best, w);
+		}
+		return best;
+	}
+
+	/*
+	* @brief random graph with deterministic pseudo-random edge weights in [1, 20]
+	*/
+	template<class GraphEW_t>
+	void make_random_ew(GraphEW_t& gew, int NV, double p, int seed) {
+		ugraph ug;
+		RandomGen<ugraph>::create_graph(ug, NV, p);
+		gew.reset(NV, GraphEW_t::NO_WEIGHT);
+		for (int i = 0; i < NV - 1; ++i) {
+			for (int j = i + 1; j < NV; ++j) {
+				if (ug.is_edge(i, j)) {
+					gew.add_edge(i, j, 1 + (i * 7 + j * 13 + seed * 31) % 20);
+				}
+			}
+		}
+	}
+}
+
+class CliqueEdgeWeightedTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		gew.reset(NV, ugraph_ewi::NO_WEIGHT);
+		gew.add_edge(0, 1, 1);
+		gew.add_edge(0, 2, 1);
+		gew.add_edge(1, 2, 1);			//triangle {0, 1, 2} - weight 3
+		gew.add_edge(3, 4, 5);			//edge {3, 4} - weight 5
+		gew.add_edge(4, 5, 2);
+	}
+	void TearDown() override {}
+
+	//undirected graph instance with integer edge weights
+	const int NV = 6;
+	ugraph_ewi gew;
+};
+
+TEST_F(CliqueEdgeWeightedTest, toy) {
+
+	for (auto layout : { CliqueEdgeWeighted<ugraph_ewi>::WE_LAYOUT, CliqueEdgeWeighted<ugraph_ewi>::CONTIGUOUS }) {
+		CliqueEdgeWeighted<ugraph_ewi> cew(gew);
+		ASSERT_EQ(0, cew.setup(layout));
+
+		//////////////////////
+		int wmax = cew.run();
+		//////////////////////
+
+		EXPECT_EQ(5, wmax);
+		vint sol_exp = { 3, 4 };
+		EXPECT_EQ(sol_exp, cew.clique());
+		EXPECT_LE(5, cew.info().upper_bound());
+		EXPECT_FALSE(cew.info().is_time_out());
+	}
+}
+
+TEST(CliqueEdgeWeighted, brute_force) {
+
+	const int NV = 14;
+	for (double p : { 0.3, 0.6, 0.9 }) {
+		for (int seed = 0; seed < 5; ++seed) {
+
+			//integer weights
+			ugraph_ewi gewi;
+			make_random_ew(gewi, NV, p, seed);
+			int wexp = brute_force_mewc(gewi);
+
+			for (auto layout : { CliqueEdgeWeighted<ugraph_ewi>::WE_LAYOUT, CliqueEdgeWeighted<ugraph_ewi>::CONTIGUOUS }) {
+				CliqueEdgeWeighted<ugraph_ewi> cew(gewi);
+				cew.setup(layout);
+				EXPECT_EQ(wexp, cew.run());
+				EXPECT_TRUE(gfunc::clq::is_clique(gewi.graph(), cew.clique()));
+			}
+
+			//floating-point weights
+			ugraph_ew gew;
+			make_random_ew(gew, NV, p, seed);
+			gew.transform_weights([](double w) { return w / 4.0; }, ugraph_ew::EDGE);
+
+			CliqueEdgeWeighted<ugraph_ew> cew(gew);
+			EXPECT_DOUBLE_EQ(brute_force_mewc(gew), cew.run());
+		}
+	}
+}
+
+TEST(CliqueEdgeWeighted, time_out) {
+
+	ugraph_ewi gew;
+	make_random_ew(gew, 200, 0.9, 1);
+
+	CliqueEdgeWeighted<ugraph_ewi> cew(gew);
+	cew.time_out(0.0);
+
+	//////////////////////
+	int lb = cew.run();
+	//////////////////////
+
+	EXPECT_TRUE(cew.info().is_time_out());
+	EXPECT_LE(0, lb);
+	EXPECT_TRUE(gfunc::clq::is_clique(gew.graph(), cew.clique()));
+}
@@ -0,0 +1,155 @@
+/**
+* @file  test_clq_enum.cpp
+* @brief Unit tests for the maximal clique enumerator (class CliqueEnum)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_enum.h"
+#include <set>
+#include <mutex>
+#include <atomic>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief all maximal cliques by exhaustive enumeration (only for small graphs)
+	*/
+	std::set<vint> brute_force_maximal(ugraph& ug) {
+		const int NV = ug.number_of_vertices();
+		std::set<vint> res;
+		for (uint32_t mask = 1; mask < (1u << NV); ++mask) {
+			vint lv;
+			for (int v = 0; v < NV; ++v) {
+				if (mask & (1u << v)) { lv.push_back(v); }
+			}
+			if (!gfunc::clq::is_clique(ug, lv)) { continue; }
+
+			//maximality
+			bool maximal = true;
+			for (int v = 0; v < NV && maximal; ++v) {
+				if (!(mask & (1u << v)) && gfunc::clq::is_clique(ug, lv, v)) { maximal = false; }
+			}
+			if (maximal) { res.insert(lv); }
+		}
+		return res;
+	}
+}
+
+class CliqueEnumTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		ug.reset(NV);
+		ug.add_edge(0, 1);
+		ug.add_edge(0, 2);
+		ug.add_edge(1, 2);			//triangle {0, 1, 2}
+		ug.add_edge(2, 3);
+		ug.add_edge(3, 4);
+		ug.add_edge(3, 5);
+		ug.add_edge(4, 5);			//triangle {3, 4, 5}
+	}
+	void TearDown() override {}
+
+	//undirected graph instance - vertex 6 is isolated
+	const int NV = 7;
+	ugraph ug;
+};
+
+TEST_F(CliqueEnumTest, toy) {
+
+	CliqueEnum<ugraph> ce(ug);
+	std::set<vint> res;
+
+	//////////////////////
+	auto n = ce.run([&res](const vint& clq) {
+		vint c(clq);
+		std::sort(c.begin(), c.end());
+		res.insert(c);
+		return true;
+	});
+	//////////////////////
+
+	std::set<vint> res_exp = { {0, 1, 2}, {2, 3}, {3, 4, 5}, {6} };
+	EXPECT_EQ(4, n);
+	EXPECT_EQ(res_exp, res);
+	EXPECT_EQ(3, ce.max_clique_size());
+	EXPECT_FALSE(ce.info().is_time_out());
+}
+
+TEST_F(CliqueEnumTest, early_stop) {
+
+	CliqueEnum<ugraph> ce(ug);
+	int nCalls = 0;
+
+	//////////////////////
+	auto n = ce.run([&nCalls](const vint&) { return ++nCalls < 2; });
+	//////////////////////
+
+	EXPECT_EQ(2, n);
+	EXPECT_EQ(2, nCalls);
+}
+
+TEST(CliqueEnum, brute_force) {
+
+	const int NV = 14;
+	for (double p : { 0.2, 0.5, 0.8 }) {
+		for (int rep = 0; rep < 5; ++rep) {
+			ugraph ug;
+			RandomGen<ugraph>::create_graph(ug, NV, p);
+			auto res_exp = brute_force_maximal(ug);
+
+			//sequential
+			CliqueEnum<ugraph> ce(ug);
+			std::set<vint> res;
+			auto n = ce.run([&res](const vint& clq) {
+				vint c(clq);
+				std::sort(c.begin(), c.end());
+				res.insert(c);
+				return true;
+			});
+
+			EXPECT_EQ(res_exp.size(), n);
+			EXPECT_EQ(res_exp, res);
+
+			//parallel
+			std::mutex mtx;
+			std::set<vint> resp;
+			auto np = ce.run_parallel([&](const vint& clq) {
+				vint c(clq);
+				std::sort(c.begin(), c.end());
+				std::lock_guard<std::mutex> lck(mtx);
+				resp.insert(c);
+				return true;
+			}, 3);
+
+			EXPECT_EQ(res_exp.size(), np);
+			EXPECT_EQ(res_exp, resp);
+		}
+	}
+}
+
+TEST(CliqueEnum, parallel_brock) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_2.clq");
+
+	CliqueEnum<ugraph> ce(ug);
+	uint64_t n = ce.run([](const vint&) { return true; });
+	int omega = ce.max_clique_size();
+
+	std::atomic<uint64_t> count{ 0 };
+	uint64_t np = ce.run_parallel([&count](const vint&) { ++count; return true; }, 4);
+
+	EXPECT_EQ(n, np);
+	EXPECT_EQ(n, count.load());
+	EXPECT_EQ(12, omega);											//maximum clique of brock200_2
+	EXPECT_EQ(omega, ce.max_clique_size());
+}
@@ -0,0 +1,166 @@
+/**
+* @file  test_clq_heur.cpp
+* @brief Unit tests for the multi-start parallel clique heuristic (class CliqueHeurParallel)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_heur.h"
+#include "graph/algorithms/clique/clq_parallel.h"
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(CliqueHeurParallel, toy) {
+
+	//triangles {0, 1, 2} and {3, 4, 5}, K4 {6, 7, 8, 9}
+	ugraph ug(10);
+	ug.add_edge(0, 1); ug.add_edge(0, 2); ug.add_edge(1, 2);
+	ug.add_edge(2, 3);
+	ug.add_edge(3, 4); ug.add_edge(3, 5); ug.add_edge(4, 5);
+	ug.add_edge(6, 7); ug.add_edge(6, 8); ug.add_edge(6, 9);
+	ug.add_edge(7, 8); ug.add_edge(7, 9); ug.add_edge(8, 9);
+
+	CliqueHeurParallel<ugraph> heur(ug);
+
+	//////////////////////
+	EXPECT_EQ(4, heur.run());
+	//////////////////////
+
+	vint clq_exp = { 6, 7, 8, 9 };
+	EXPECT_EQ(clq_exp, heur.clique());
+	EXPECT_EQ(10, heur.info().number_of_steps());
+	EXPECT_FALSE(heur.info().is_time_out());
+	EXPECT_LE(0.0, heur.info().incumbent_time());
+}
+
+TEST(CliqueHeurParallel, brock_deterministic) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+
+	//greedy pass
+	CliqueHeurParallel<ugraph> heur(ug);
+	heur.number_of_threads(1);
+	int lb = heur.run();
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, heur.clique()));
+	EXPECT_EQ(lb, heur.clique().size());
+	EXPECT_LE(17, lb);
+	EXPECT_GE(21, lb);										//omega(brock200_1) = 21
+	vint clq1 = heur.clique();
+
+	//same clique for any number of threads
+	for (int nThreads : { 2, 4 }) {
+		heur.number_of_threads(nThreads);
+		EXPECT_EQ(lb, heur.run());
+		EXPECT_EQ(clq1, heur.clique());
+	}
+
+	//randomized passes improve (or keep) the greedy pass
+	CliqueHeurParallel<ugraph> heurR(ug);
+	heurR.number_of_starts(10 * ug.number_of_vertices());
+	heurR.number_of_threads(1);
+	int lbR = heurR.run();
+	EXPECT_LE(lb, lbR);
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, heurR.clique()));
+	vint clqR = heurR.clique();
+
+	heurR.number_of_threads(3);
+	EXPECT_EQ(lbR, heurR.run());
+	EXPECT_EQ(clqR, heurR.clique());
+}
+
+TEST(CliqueHeurParallel, sparse_vs_dense) {
+
+	ugraph ug;
+	RandomGen<ugraph>::create_graph(ug, 300, .2);
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	CliqueHeurParallel<ugraph> heur(ug);
+	CliqueHeurParallel<sparse_ugraph> heurs(sug);
+	heur.number_of_starts(3 * 300);
+	heurs.number_of_starts(3 * 300);
+	heurs.number_of_threads(2);
+
+	//same ranking, same constructions
+	EXPECT_EQ(heur.run(), heurs.run());
+	EXPECT_EQ(heur.clique(), heurs.clique());
+	EXPECT_TRUE(gfunc::clq::is_clique(sug, heurs.clique()));
+}
+
+TEST(CliqueHeurParallel, target_and_time_out) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+
+	//early exit at the target size
+	CliqueHeurParallel<ugraph> heur(ug);
+	heur.number_of_starts(1000 * ug.number_of_vertices());
+	heur.number_of_threads(2);
+	heur.target(10);
+	EXPECT_LE(10, heur.run());
+	EXPECT_TRUE(heur.is_target_reached());
+	EXPECT_GT(static_cast<uint64_t>(ug.number_of_vertices()), heur.info().number_of_steps());
+	EXPECT_FALSE(heur.info().is_time_out());
+
+	//time budget
+	CliqueHeurParallel<ugraph> heurT(ug);
+	heurT.number_of_starts(1000 * ug.number_of_vertices());
+	heurT.number_of_threads(2);
+	heurT.time_out(0.05);
+	int lb = heurT.run();
+	EXPECT_TRUE(heurT.info().is_time_out());
+	EXPECT_FALSE(heurT.is_target_reached());
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, heurT.clique()));
+	EXPECT_EQ(lb, heurT.clique().size());
+	EXPECT_GT(1000ull * ug.number_of_vertices(), heurT.info().number_of_steps());
+}
+
+TEST(CliqueHeurParallel, initial_incumbent_exact_search) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_4.clq");
+
+	CliqueParallel<ugraph> cp(ug);
+	cp.number_of_threads(1);
+	int omega = cp.run();
+	vint clq = cp.clique();
+
+	//the initial incumbent does not change the solution
+	CliqueParallel<ugraph> cph(ug);
+	cph.number_of_threads(1);										//deterministic number of steps
+	cph.heuristic_starts(2 * ug.number_of_vertices());
+	EXPECT_EQ(omega, cph.run());
+	EXPECT_EQ(clq, cph.clique());
+	EXPECT_GE(cp.info().number_of_steps(), cph.info().number_of_steps());
+}
+
+TEST(CliqueHeurParallel, empty_graph) {
+
+	ugraph ug(5);
+	CliqueHeurParallel<ugraph> heur(ug);
+	EXPECT_EQ(1, heur.run());
+	EXPECT_EQ(1, heur.clique().size());
+
+	sparse_ugraph sug(5);
+	CliqueHeurParallel<sparse_ugraph> heurs(sug);
+	heurs.number_of_threads(3);
+	EXPECT_EQ(1, heurs.run());
+
+	//no vertices
+	ugraph ug0;
+	CliqueHeurParallel<ugraph> heur0(ug0);
+	heur0.number_of_starts(10);
+	EXPECT_EQ(0, heur0.run());
+	EXPECT_TRUE(heur0.clique().empty());
+
+	sparse_ugraph sug0;
+	CliqueHeurParallel<sparse_ugraph> heurs0(sug0);
+	heurs0.number_of_threads(3);
+	EXPECT_EQ(0, heurs0.run());
+}
@@ -0,0 +1,196 @@
+/**
+* @file  test_clq_kclique.cpp
+* @brief Unit tests for the k-clique counting and listing engine (class KClique)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_kclique.h"
+#include <set>
+#include <mutex>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief number of cliques of each size by exhaustive enumeration (only for small graphs)
+	*/
+	vector<uint64_t> brute_force_kcliques(ugraph& ug) {
+		const int NV = ug.number_of_vertices();
+		vector<uint64_t> cnt(NV + 1, 0);
+		for (uint32_t mask = 1; mask < (1u << NV); ++mask) {
+			vint lv;
+			for (int v = 0; v < NV; ++v) {
+				if (mask & (1u << v)) { lv.push_back(v); }
+			}
+			if (gfunc::clq::is_clique(ug, lv)) { ++cnt[lv.size()]; }
+		}
+		return cnt;
+	}
+}
+
+class KCliqueTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		ug.reset(NV);
+		ug.add_edge(0, 1);
+		ug.add_edge(0, 2);
+		ug.add_edge(0, 3);
+		ug.add_edge(1, 2);
+		ug.add_edge(1, 3);
+		ug.add_edge(2, 3);			//K4 {0, 1, 2, 3}
+		ug.add_edge(3, 4);
+		ug.add_edge(4, 5);
+		ug.add_edge(3, 5);			//triangle {3, 4, 5}
+	}
+	void TearDown() override {}
+
+	//undirected graph instance
+	const int NV = 6;
+	ugraph ug;
+};
+
+TEST_F(KCliqueTest, count) {
+
+	KClique<ugraph> kc(ug);
+
+	EXPECT_EQ(6, kc.count(1));
+	EXPECT_EQ(9, kc.count(2));
+	EXPECT_EQ(5, kc.count(3));
+	EXPECT_EQ(1, kc.count(4));
+	EXPECT_EQ(4, kc.info().incumbent());
+	EXPECT_EQ(0, kc.count(5));
+	EXPECT_EQ(0, kc.info().incumbent());
+	EXPECT_FALSE(kc.info().is_time_out());
+
+	vector<uint64_t> cnt_exp = { 0, 6, 9, 5, 1, 0 };
+	EXPECT_EQ(cnt_exp, kc.count_all(5));
+}
+
+TEST_F(KCliqueTest, list) {
+
+	KClique<ugraph> kc(ug);
+	set<vint> res;
+
+	//////////////////////
+	auto n = kc.list(3, [&res](const vint& clq) {
+		vint c(clq);
+		std::sort(c.begin(), c.end());
+		res.insert(c);
+		return true;
+	});
+	//////////////////////
+
+	set<vint> res_exp = { {0, 1, 2}, {0, 1, 3}, {0, 2, 3}, {1, 2, 3}, {3, 4, 5} };
+	EXPECT_EQ(5, n);
+	EXPECT_EQ(res_exp, res);
+
+	//early stop
+	int nCalls = 0;
+	n = kc.list(3, [&nCalls](const vint&) { return ++nCalls < 2; });
+	EXPECT_EQ(2, n);
+	EXPECT_EQ(2, nCalls);
+}
+
+TEST(KClique, brute_force) {
+
+	const int NV = 14;
+	for (double p : { 0.2, 0.5, 0.8 }) {
+		for (int rep = 0; rep < 5; ++rep) {
+			ugraph ug;
+			RandomGen<ugraph>::create_graph(ug, NV, p);
+			auto cnt_exp = brute_force_kcliques(ug);
+
+			KClique<ugraph> kc(ug);
+			for (int k = 1; k <= 6; ++k) {
+				EXPECT_EQ(cnt_exp[k], kc.count(k));
+				EXPECT_EQ(cnt_exp[k], kc.count(k, 3));
+			}
+
+			auto cnt = kc.count_all(NV, 2);
+			EXPECT_EQ(cnt_exp, cnt);
+
+			//listing - distinct cliques
+			std::mutex mtx;
+			set<vint> res;
+			auto n = kc.list(4, [&](const vint& clq) {
+				vint c(clq);
+				std::sort(c.begin(), c.end());
+				std::lock_guard<std::mutex> lck(mtx);
+				res.insert(c);
+				return true;
+			}, 3);
+			EXPECT_EQ(cnt_exp[4], n);
+			EXPECT_EQ(cnt_exp[4], res.size());
+		}
+	}
+}
+
+TEST(KClique, sparse) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_2.clq");
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	KClique<ugraph> kc(ug);
+	KClique<sparse_ugraph> kcs(sug);
+
+	auto cnt = kc.count_all(13);
+	EXPECT_EQ(cnt, kcs.count_all(13, 4));
+	EXPECT_EQ(0, cnt[13]);
+	EXPECT_LT(0, cnt[12]);											//maximum clique of brock200_2
+	EXPECT_EQ(12, kc.info().incumbent());
+	EXPECT_EQ(ug.number_of_edges(), cnt[2]);
+
+	for (int k = 3; k <= 6; ++k) {
+		EXPECT_EQ(cnt[k], kcs.count(k, 4));
+	}
+}
+
+TEST(KClique, sparse_empty_graph) {
+
+	//isolated vertices have empty sparse neighborhoods
+	sparse_ugraph sug(5);
+	sug.add_edge(0, 1);
+	KClique<sparse_ugraph> kcs(sug);
+
+	vector<uint64_t> cnt_exp = { 0, 5, 1, 0 };
+	EXPECT_EQ(cnt_exp, kcs.count_all(3));
+
+	sparse_ugraph sug0;
+	KClique<sparse_ugraph> kcs0(sug0);
+	EXPECT_EQ(0, kcs0.count(1));
+}
+
+#ifdef __SIZEOF_INT128__
+TEST(KClique, counter_128) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_2.clq");
+
+	KClique<ugraph> kc(ug);
+	KClique<ugraph, unsigned __int128> kc128(ug);
+
+	EXPECT_EQ(kc.count(5), static_cast<uint64_t>(kc128.count(5, 2)));
+}
+#endif
+
+TEST(KClique, time_out) {
+
+	ugraph ug;
+	RandomGen<ugraph>::create_graph(ug, 200, 0.9);
+
+	KClique<ugraph> kc(ug);
+	kc.time_out(0.0);
+
+	kc.count(10);
+	EXPECT_TRUE(kc.info().is_time_out());
+}
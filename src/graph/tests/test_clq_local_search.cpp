@@ -0,0 +1,168 @@
+/**
+* @file  test_clq_local_search.cpp
+* @brief Unit tests for the maximum (weight) clique local search (class CliqueLocalSearch)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_weighted.h"
+#include "graph/algorithms/clique/clq_local_search.h"
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(CliqueLocalSearch, toy) {
+
+	//triangles {0, 1, 2} and {3, 4, 5}, K4 {6, 7, 8, 9}
+	ugraph ug(10);
+	ug.add_edge(0, 1); ug.add_edge(0, 2); ug.add_edge(1, 2);
+	ug.add_edge(2, 3);
+	ug.add_edge(3, 4); ug.add_edge(3, 5); ug.add_edge(4, 5);
+	ug.add_edge(6, 7); ug.add_edge(6, 8); ug.add_edge(6, 9);
+	ug.add_edge(7, 8); ug.add_edge(7, 9); ug.add_edge(8, 9);
+
+	CliqueLocalSearch<ugraph> ls(ug);
+	ls.number_of_threads(1);
+
+	//////////////////////
+	EXPECT_EQ(4, ls.run());
+	//////////////////////
+
+	vint clq_exp = { 6, 7, 8, 9 };
+	EXPECT_EQ(clq_exp, ls.clique());
+	EXPECT_EQ(4, ls.upper_bound(6));
+	EXPECT_EQ(3, ls.upper_bound(0));
+
+	//every vertex is pruned by the incumbent
+	EXPECT_TRUE(ls.is_optimal());
+	EXPECT_FALSE(ls.info().is_time_out());
+}
+
+TEST(CliqueLocalSearch, brock) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+
+	CliqueLocalSearch<ugraph> ls(ug);
+	ls.number_of_threads(1);
+	ls.max_moves(200000);
+	int lb = ls.run();
+
+	EXPECT_LE(19, lb);
+	EXPECT_GE(21, lb);										//omega(brock200_1) = 21
+	EXPECT_EQ(lb, ls.clique().size());
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, ls.clique()));
+	EXPECT_FALSE(ls.is_optimal());
+
+	//throughput
+	EXPECT_LE(200000ull, ls.info().number_of_steps());
+	EXPECT_LT(0.0, ls.moves_per_second());
+	EXPECT_LE(0.0, ls.info().incumbent_time());
+}
+
+TEST(CliqueLocalSearch, weighted) {
+
+	for (int rep = 0; rep < 5; ++rep) {
+		ugraph_wi ugw;
+		ParallelRandomGen<ugraph>::create_graph(ugw.graph(), 60, 0.5, rep + 1);
+		ugw.set_weight(1);
+		ugw.set_modulus_weight(20 + rep);
+
+		CliqueWeighted<ugraph_wi> cw(ugw);
+		int wmax = cw.run();
+
+		CliqueLocalSearch<ugraph, int> ls(ugw);
+		ls.number_of_threads(1);
+		ls.max_moves(50000);
+		int w = ls.run();
+
+		EXPECT_EQ(wmax, w);
+		vint sol = ls.clique();
+		EXPECT_EQ(w, gfunc::vertexW::wsum(ugw, sol));
+		EXPECT_TRUE(gfunc::clq::is_clique(ugw.graph(), ls.clique()));
+	}
+}
+
+TEST(CliqueLocalSearch, sparse_planted_clique) {
+
+	//large sparse graph with a hidden clique of 30 vertices
+	sparse_ugraph sug;
+	vint clq;
+	GraphModelGen<sparse_ugraph>::create_planted_clique(sug, 20000, 0.001, 30, clq);
+
+	CliqueLocalSearch<sparse_ugraph> ls(sug);
+	ls.number_of_threads(1);
+	ls.target(30);
+
+	//////////////////////
+	EXPECT_LE(30, ls.run());
+	//////////////////////
+
+	EXPECT_TRUE(gfunc::clq::is_clique(sug, ls.clique()));
+	EXPECT_GT(CliqueLocalSearch<sparse_ugraph>::DEFAULT_MAX_MOVES, ls.info().number_of_steps());
+	EXPECT_FALSE(ls.info().is_time_out());
+}
+
+TEST(CliqueLocalSearch, parallel_walkers) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_4.clq");
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	for (int nThreads : { 1, 3 }) {
+		CliqueLocalSearch<sparse_ugraph> ls(sug);
+		ls.number_of_threads(nThreads);
+		ls.max_moves(50000);
+		int lb = ls.run();
+
+		EXPECT_LE(16, lb);
+		EXPECT_GE(17, lb);									//omega(brock200_4) = 17
+		EXPECT_TRUE(gfunc::clq::is_clique(sug, ls.clique()));
+		EXPECT_LE(nThreads * 50000ull, ls.info().number_of_steps());
+		EXPECT_LT(0.0, ls.moves_per_second());
+	}
+}
+
+TEST(CliqueLocalSearch, sparse_weighted_and_time_out) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	Base_Graph_W<sparse_ugraph, int> sugw(sug);
+	for (int v = 0; v < static_cast<int>(sug.number_of_vertices()); ++v) { sugw.set_weight(v, 1 + v % 5); }
+
+	CliqueLocalSearch<sparse_ugraph, int> ls(sugw);
+	ls.number_of_threads(2);
+	ls.max_moves(std::numeric_limits<uint64_t>::max());
+	ls.time_out(0.2);
+	int w = ls.run();
+
+	EXPECT_TRUE(ls.info().is_time_out());
+	EXPECT_TRUE(gfunc::clq::is_clique(sug, ls.clique()));
+	vint sol = ls.clique();
+	EXPECT_EQ(w, gfunc::vertexW::wsum(sugw, sol));
+	EXPECT_LE(ls.throughput().size(), 1u);					//no whole second elapsed
+}
+
+TEST(CliqueLocalSearch, empty_graph) {
+
+	ugraph ug(5);
+	CliqueLocalSearch<ugraph> ls(ug);
+	ls.number_of_threads(2);
+	EXPECT_EQ(1, ls.run());
+	EXPECT_EQ(1, ls.clique().size());
+	EXPECT_TRUE(ls.is_optimal());
+
+	sparse_ugraph sug(5);
+	CliqueLocalSearch<sparse_ugraph> lss(sug);
+	lss.number_of_threads(3);
+	EXPECT_EQ(1, lss.run());
+	EXPECT_TRUE(lss.is_optimal());
+}
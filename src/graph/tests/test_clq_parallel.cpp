@@ -0,0 +1,126 @@
+/**
+* @file  test_clq_parallel.cpp
+* @brief Unit tests for the multi-threaded exact maximum clique algorithm (class CliqueParallel)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_parallel.h"
+
+using namespace std;
+using namespace bitgraph;
+
+class CliqueParallelTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		ug.reset(NV);
+		ug.add_edge(0, 1);
+		ug.add_edge(0, 2);
+		ug.add_edge(1, 2);			//triangle {0, 1, 2}
+		ug.add_edge(2, 3);
+		ug.add_edge(3, 4);
+		ug.add_edge(3, 5);
+		ug.add_edge(4, 5);			//triangle {3, 4, 5}
+		ug.add_edge(6, 7);
+	}
+	void TearDown() override {}
+
+	//undirected graph instance
+	const int NV = 8;
+	ugraph ug;
+};
+
+TEST_F(CliqueParallelTest, toy) {
+
+	CliqueParallel<ugraph> cp(ug);
+
+	//////////////////////
+	int omega = cp.run();
+	//////////////////////
+
+	EXPECT_EQ(3, omega);
+	EXPECT_EQ(3, cp.clique().size());
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, cp.clique()));
+	EXPECT_FALSE(cp.info().is_time_out());
+}
+
+TEST_F(CliqueParallelTest, empty_graph) {
+
+	ugraph g(5);
+	CliqueParallel<ugraph> cp(g);
+
+	EXPECT_EQ(1, cp.run());
+	EXPECT_EQ(1, cp.clique().size());
+}
+
+TEST(CliqueParallel, brock) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_4.clq");
+
+	paramBase p;
+	p.nThreads = 4;
+	CliqueParallel<ugraph> cp(ug, p);
+
+	//////////////////////
+	int omega = cp.run();
+	//////////////////////
+
+	EXPECT_EQ(17, omega);
+	EXPECT_EQ(17, cp.clique().size());
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, cp.clique()));
+	EXPECT_EQ(17, cp.info().incumbent());
+	EXPECT_LE(17, cp.info().upper_bound());
+}
+
+TEST(CliqueParallel, deterministic) {
+
+	const int NV = 150;
+	ugraph ug;
+	RandomGen<ugraph>::create_graph(ug, NV, 0.6);
+
+	//sequential reference
+	CliqueParallel<ugraph> cp1(ug);
+	cp1.number_of_threads(1);
+	int omega = cp1.run();
+	vint clq = cp1.clique();
+
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, clq));
+	EXPECT_EQ(omega, clq.size());
+
+	//the same clique must be found for any number of threads
+	for (int nThreads : { 2, 3, 8 }) {
+		for (int rep = 0; rep < 3; ++rep) {
+			CliqueParallel<ugraph> cp(ug);
+			cp.number_of_threads(nThreads);
+
+			/////////////////////////
+			EXPECT_EQ(omega, cp.run());
+			EXPECT_EQ(clq, cp.clique());
+			/////////////////////////
+		}
+	}
+}
+
+TEST(CliqueParallel, time_out) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+
+	CliqueParallel<ugraph> cp(ug);
+	cp.number_of_threads(2);
+	cp.time_out(0.0);
+
+	//////////////////////
+	int lb = cp.run();
+	//////////////////////
+
+	EXPECT_TRUE(cp.info().is_time_out());
+	EXPECT_LE(lb, 21);
+	EXPECT_EQ(lb, cp.clique().size());
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, cp.clique()));
+}
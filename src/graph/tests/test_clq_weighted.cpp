@@ -0,0 +1,158 @@
+/**
+* @file  test_clq_weighted.cpp
+* @brief Unit tests for the exact maximum weight clique algorithm (class CliqueWeighted)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_weighted.h"
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief maximum weight clique by exhaustive enumeration (only for small graphs)
+	*/
+	template<class GraphW_t>
+	typename GraphW_t::_wt brute_force_mwc(GraphW_t& gw) {
+		using W = typename GraphW_t::_wt;
+		const int NV = gw.number_of_vertices();
+		W best = 0;
+		for (uint32_t mask = 1; mask < (1u << NV); ++mask) {
+			vint lv;
+			W w = 0;
+			for (int v = 0; v < NV; ++v) {
+				if (mask & (1u << v)) { lv.push_back(v); w += gw.weight(v); }
+			}
+			if (w > best && gfunc::clq::is_clique(gw.graph(), lv)) { best = w; }
+		}
+		return best;
+	}
+}
+
+class CliqueWeightedTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+		ugw.reset(NV);
+		ugw.add_edge(0, 1);
+		ugw.add_edge(0, 2);
+		ugw.add_edge(1, 2);			//triangle {0, 1, 2} - weight 3
+		ugw.add_edge(3, 4);			//edge {3, 4} - weight 10
+		ugw.add_edge(4, 5);
+
+		ugw.set_weight(3, 4);
+		ugw.set_weight(4, 6);
+		ugw.set_weight(5, 3);
+	}
+	void TearDown() override {}
+
+	//undirected graph instance with integer weights (unit weights by default)
+	const int NV = 6;
+	ugraph_wi ugw;
+};
+
+TEST_F(CliqueWeightedTest, toy) {
+
+	CliqueWeighted<ugraph_wi> cw(ugw);
+
+	//////////////////////
+	int wmax = cw.run();
+	//////////////////////
+
+	EXPECT_EQ(10, wmax);
+	vint sol_exp = { 3, 4 };
+	EXPECT_EQ(sol_exp, cw.clique());
+	EXPECT_EQ(10, cw.info().incumbent());
+	EXPECT_LE(10, cw.info().upper_bound());
+	EXPECT_FALSE(cw.info().is_time_out());
+}
+
+TEST_F(CliqueWeightedTest, sorting) {
+
+	CliqueWeighted<ugraph_wi> cw(ugw);
+
+	//unknown sorting algorithm
+	EXPECT_EQ(-1, cw.setup(GraphFastRootSort<ugraph>::MIN_DEGEN));
+
+	for (int alg : { GraphFastRootSort_W<ugraph_wi>::MAX_WEIGHT, GraphFastRootSort_W<ugraph_wi>::MIN_WEIGHT }) {
+		for (bool ltf : { true, false }) {
+			CliqueWeighted<ugraph_wi> cw(ugw);
+			EXPECT_EQ(0, cw.setup(alg, ltf));
+			EXPECT_EQ(10, cw.run());
+		}
+	}
+}
+
+TEST(CliqueWeighted, unit_weights) {
+
+	//unit weights: the maximum weight clique is the maximum clique
+	ugraph_w ugw(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_4.clq");
+	ugw.set_weight(1.0);
+
+	CliqueWeighted<ugraph_w> cw(ugw);
+
+	//////////////////////
+	double wmax = cw.run();
+	//////////////////////
+
+	EXPECT_DOUBLE_EQ(17.0, wmax);
+	EXPECT_EQ(17, cw.clique().size());
+	EXPECT_TRUE(gfunc::clq::is_clique(ugw.graph(), cw.clique()));
+}
+
+TEST(CliqueWeighted, brute_force) {
+
+	const int NV = 14;
+	for (double p : { 0.3, 0.6, 0.9 }) {
+		for (int rep = 0; rep < 5; ++rep) {
+
+			//integer weights
+			ugraph_wi ugwi;
+			RandomGen<ugraph>::create_graph(ugwi.graph(), NV, p);
+			ugwi.set_weight(1);
+			ugwi.set_modulus_weight(7 + rep);
+
+			CliqueWeighted<ugraph_wi> cwi(ugwi);
+			int wi = cwi.run();
+			vint sol = cwi.clique();
+			EXPECT_EQ(brute_force_mwc(ugwi), wi);
+			EXPECT_EQ(wi, gfunc::vertexW::wsum(ugwi, sol));
+			EXPECT_TRUE(gfunc::clq::is_clique(ugwi.graph(), cwi.clique()));
+
+			//floating-point weights
+			ugraph_w ugw(NV);
+			ugw.graph() = ugwi.graph();
+			for (int v = 0; v < NV; ++v) { ugw.set_weight(v, 0.5 + v * 0.37); }
+
+			CliqueWeighted<ugraph_w> cw(ugw);
+			double w = cw.run();
+			EXPECT_DOUBLE_EQ(brute_force_mwc(ugw), w);
+			EXPECT_TRUE(gfunc::clq::is_clique(ugw.graph(), cw.clique()));
+		}
+	}
+}
+
+TEST(CliqueWeighted, time_out) {
+
+	ugraph_wi ugw(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+
+	CliqueWeighted<ugraph_wi> cw(ugw);
+	cw.time_out(0.0);
+
+	//////////////////////
+	int lb = cw.run();
+	//////////////////////
+
+	vint sol = cw.clique();
+	EXPECT_TRUE(cw.info().is_time_out());
+	EXPECT_EQ(lb, gfunc::vertexW::wsum(ugw, sol));
+	EXPECT_TRUE(gfunc::clq::is_clique(ugw.graph(), cw.clique()));
+}
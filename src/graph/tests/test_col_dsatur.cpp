@@ -0,0 +1,187 @@
+/**
+* @file  test_col_dsatur.cpp
+* @brief Unit tests for the exact vertex coloring algorithm (class ColorDSATUR) and the
+*		 coloring heuristics in col_func.h
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/coloring/col_func.h"
+#include "graph/algorithms/coloring/col_dsatur.h"
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief TRUE if @g can be colored with @k colors (exhaustive backtracking - only for small graphs)
+	*/
+	bool is_k_colorable(ugraph& g, int k, vint& col, int v = 0) {
+		const int NV = g.number_of_vertices();
+		if (v == NV) { return true; }
+		for (int c = 0; c < k; ++c) {
+			bool ok = true;
+			for (int u = 0; u < v && ok; ++u) {
+				if (col[u] == c && g.is_edge(u, v)) { ok = false; }
+			}
+			if (!ok) { continue; }
+			col[v] = c;
+			if (is_k_colorable(g, k, col, v + 1)) { return true; }
+		}
+		return false;
+	}
+
+	int brute_force_chromatic(ugraph& g) {
+		vint col(g.number_of_vertices(), EMPTY_ELEM);
+		int k = 0;
+		while (!is_k_colorable(g, k, col)) { ++k; }
+		return k;
+	}
+}
+
+class ColorDSATURTest : public ::testing::Test {
+protected:
+	void SetUp() override {
+
+		//odd cycle C5 plus a pendant vertex - chromatic number 3, clique number 2
+		ug.reset(NV);
+		ug.add_edge(0, 1);
+		ug.add_edge(1, 2);
+		ug.add_edge(2, 3);
+		ug.add_edge(3, 4);
+		ug.add_edge(4, 0);
+		ug.add_edge(4, 5);
+	}
+	void TearDown() override {}
+
+	//undirected graph instance
+	const int NV = 6;
+	ugraph ug;
+};
+
+TEST_F(ColorDSATURTest, heuristics) {
+
+	vint col;
+	int k = gfunc::col::dsatur(ug, col);
+	EXPECT_EQ(3, k);
+	EXPECT_TRUE(gfunc::col::is_coloring(ug, col));
+
+	k = gfunc::col::rlf(ug, col);
+	EXPECT_EQ(3, k);
+	EXPECT_TRUE(gfunc::col::is_coloring(ug, col));
+
+	auto classes = gfunc::col::color_classes(col);
+	ASSERT_EQ(3, classes.size());
+	int nV = 0;
+	for (auto& bb : classes) {
+		nV += bb.size();
+	}
+	EXPECT_EQ(NV, nV);
+}
+
+TEST_F(ColorDSATURTest, exact) {
+
+	ColorDSATUR<ugraph> cd(ug);
+
+	//////////////////////
+	int k = cd.run();
+	//////////////////////
+
+	EXPECT_EQ(3, k);
+	EXPECT_EQ(2, cd.info().lower_bound());
+	EXPECT_TRUE(gfunc::col::is_coloring(ug, cd.coloring()));
+	EXPECT_TRUE(cd.info().is_optimal());
+	EXPECT_FALSE(cd.info().is_time_out());
+}
+
+TEST(ColorDSATUR, empty_graph) {
+
+	ugraph ug(5);
+	ColorDSATUR<ugraph> cd(ug);
+	EXPECT_EQ(1, cd.run());
+
+	ugraph ug0;
+	ColorDSATUR<ugraph> cd0(ug0);
+	EXPECT_EQ(0, cd0.run());
+}
+
+TEST(ColorDSATUR, brute_force) {
+
+	const int NV = 12;
+	for (double p : { 0.2, 0.5, 0.8 }) {
+		for (int rep = 0; rep < 5; ++rep) {
+			ugraph ug;
+			RandomGen<ugraph>::create_graph(ug, NV, p);
+
+			ColorDSATUR<ugraph> cd(ug);
+			EXPECT_EQ(brute_force_chromatic(ug), cd.run());
+			EXPECT_TRUE(gfunc::col::is_coloring(ug, cd.coloring()));
+		}
+	}
+}
+
+TEST(ColorDSATUR, dimacs) {
+
+	//zeroin.i.2 - chromatic number 30 (equal to the clique number)
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "zeroin.i.2.col");
+	ColorDSATUR<ugraph> cd(ug);
+	EXPECT_EQ(30, cd.run());
+	EXPECT_EQ(30, cd.info().lower_bound());
+	EXPECT_TRUE(gfunc::col::is_coloring(ug, cd.coloring()));
+}
+
+TEST(ColorDSATUR, sparse_heuristics) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_4.clq");
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	vint col, cols;
+	EXPECT_EQ(gfunc::col::dsatur(ug, col), gfunc::col::dsatur(sug, cols));
+	EXPECT_EQ(col, cols);
+	EXPECT_TRUE(gfunc::col::is_coloring(sug, cols));
+
+	EXPECT_EQ(gfunc::col::rlf(ug, col), gfunc::col::rlf(sug, cols));
+	EXPECT_EQ(col, cols);
+	EXPECT_TRUE(gfunc::col::is_coloring(sug, cols));
+}
+
+TEST(ColorDSATUR, sparse_empty_graph) {
+
+	//isolated vertices have empty sparse neighborhoods
+	sparse_ugraph sug(5);
+	sug.add_edge(0, 1);
+
+	vint col;
+	EXPECT_EQ(2, gfunc::col::dsatur(sug, col));
+	EXPECT_TRUE(gfunc::col::is_coloring(sug, col));
+	EXPECT_EQ(2, gfunc::col::rlf(sug, col));
+	EXPECT_TRUE(gfunc::col::is_coloring(sug, col));
+
+	sparse_ugraph sug0;
+	EXPECT_EQ(0, gfunc::col::dsatur(sug0, col));
+	EXPECT_EQ(0, gfunc::col::rlf(sug0, col));
+}
+
+TEST(ColorDSATUR, time_out) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_4.clq");
+
+	ColorDSATUR<ugraph> cd(ug);
+	cd.time_out(0.0);
+
+	//////////////////////
+	int k = cd.run();
+	//////////////////////
+
+	EXPECT_TRUE(cd.info().is_time_out());
+	EXPECT_LE(cd.info().lower_bound(), k);
+	EXPECT_TRUE(gfunc::col::is_coloring(ug, cd.coloring()));
+}
@@ -57,3 +57,95 @@ TEST(Decode, GraphFastRootSort) {
 	EXPECT_EQ(dec[4], 102);
 	EXPECT_EQ(dec[5], 103);	
 }
+
+TEST(Decode, composed_orderings) {
+
+	//two permutations and a reduction, all in format [NEW]->[OLD]
+	const int NV = 200;
+	vint o1(NV), o2(NV), o3;
+	for (int v = 0; v < NV; ++v) {
+		o1[v] = (v * 7) % NV;
+		o2[v] = NV - 1 - v;
+	}
+	for (int v = 0; v < NV; v += 3) { o3.push_back(v); }
+
+	Decode d;
+	d.add_ordering(o1);
+	d.add_ordering(o2);
+	d.add_ordering(o3);
+	EXPECT_EQ(3, d.orderings().size());
+	ASSERT_EQ(o3.size(), d.composed_ordering().size());
+
+	//unwinds the orderings one by one
+	vint vlist, vexp;
+	for (int v = 0; v < static_cast<int>(o3.size()); ++v) {
+		vlist.push_back(v);
+		vexp.push_back(o1[o2[o3[v]]]);
+	}
+	EXPECT_EQ(vexp, d.composed_ordering());
+	EXPECT_EQ(vexp, d.decode(vlist));
+	EXPECT_EQ(vexp[5], d.decode(5));
+
+	vint vinp(vlist);
+	EXPECT_EQ(0, d.decode_in_place(vinp));
+	EXPECT_EQ(vexp, vinp);
+
+	//out of range
+	EXPECT_EQ(EMPTY_ELEM, d.decode(static_cast<int>(o3.size())));
+	vint vbad = { 0, NV };
+	EXPECT_EQ(-1, d.decode_in_place(vbad));
+	EXPECT_EQ(vexp[0], vbad[0]);
+	EXPECT_EQ(EMPTY_ELEM, vbad[1]);
+
+	//no orderings
+	d.clear();
+	EXPECT_TRUE(d.is_empty());
+	EXPECT_EQ(7, d.decode(7));
+	EXPECT_EQ(vlist, d.decode(vlist));
+}
+
+TEST(Decode, bitsets_and_values) {
+
+	const int NV = 150;
+	vint o1(NV), o2;
+	for (int v = 0; v < NV; ++v) { o1[v] = (v * 11) % NV; }
+	for (int v = 1; v < NV; v += 2) { o2.push_back(v); }
+
+	Decode d;
+	d.add_ordering(o1);
+	d.add_ordering(o2);
+	const int NR = static_cast<int>(o2.size());
+
+	//set of vertices
+	bitarray bbn(NR);
+	bbn.set_bit(0); bbn.set_bit(3); bbn.set_bit(64); bbn.set_bit(NR - 1);
+	bitarray bbo(NV);
+	bbo.set_bit(2);														//cleared
+	EXPECT_EQ(0, d.decode(bbn, bbo));
+
+	vint lexp = d.decode(vint{ 0, 3, 64, NR - 1 });
+	std::sort(lexp.begin(), lexp.end());
+	EXPECT_EQ(lexp, static_cast<vint>(bbo));
+
+	sparse_bitarray sbn(NR);
+	sbn.set_bit(0); sbn.set_bit(3); sbn.set_bit(64); sbn.set_bit(NR - 1);
+	sparse_bitarray sbo(NV);
+	EXPECT_EQ(0, d.decode(sbn, sbo));
+	EXPECT_EQ(lexp, static_cast<vint>(sbo));
+
+	//coloring
+	vint col(NR);
+	for (int v = 0; v < NR; ++v) { col[v] = v % 5; }
+	vint colo(NV, EMPTY_ELEM);
+	EXPECT_EQ(0, d.decode_values(col, colo));
+	for (int v = 0; v < NR; ++v) {
+		EXPECT_EQ(col[v], colo[d.decode(v)]);
+	}
+	EXPECT_EQ(NV - NR, std::count(colo.begin(), colo.end(), EMPTY_ELEM));
+
+	//the decoded vertices do not fit
+	bitarray bbs(10);
+	EXPECT_EQ(-1, d.decode(bbn, bbs));
+	vint cols(10, 0);
+	EXPECT_EQ(-1, d.decode_values(col, cols));
+}
@@ -0,0 +1,188 @@
+/**
+* @file  test_graph_components.cpp
+* @brief Unit tests for connected components and per-component solving (class GraphComponents)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/graph_components.h"
+#include "graph/algorithms/bfs.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include <atomic>
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphComponents, toy) {
+
+	//K4 {0, 1, 2, 3} with pendant vertex 4, triangle {5, 6, 7}, isolated vertex 8, edge {9, 10}
+	ugraph ug(11);
+	ug.add_edge(0, 1); ug.add_edge(0, 2); ug.add_edge(0, 3);
+	ug.add_edge(1, 2); ug.add_edge(1, 3); ug.add_edge(2, 3);
+	ug.add_edge(0, 4);
+	ug.add_edge(5, 6); ug.add_edge(5, 7); ug.add_edge(6, 7);
+	ug.add_edge(9, 10);
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	GraphComponents<ugraph> gc(ug);
+
+	//////////////////////
+	EXPECT_EQ(4, gc.find_components());
+	//////////////////////
+
+	vint sizes_exp = { 5, 3, 2, 1 };
+	EXPECT_EQ(sizes_exp, gc.sizes());
+	vint labels_exp = { 0, 0, 0, 0, 0, 1, 1, 1, 3, 2, 2 };
+	EXPECT_EQ(labels_exp, gc.labels());
+	vint tri_exp = { 5, 6, 7 };
+	EXPECT_EQ(tri_exp, gc.vertices(1));
+	EXPECT_EQ(1, gc.number_of_singletons());
+	EXPECT_EQ(5, gc.largest_size());
+	EXPECT_EQ(1, gc.smallest_size());
+	EXPECT_DOUBLE_EQ(11.0 / 4, gc.mean_size());
+
+	BBScan bb = gc.component(1);
+	EXPECT_EQ(3, bb.size());
+	EXPECT_TRUE(bb.is_bit(6));
+
+	//compact graph of the largest component
+	ugraph ug0;
+	EXPECT_EQ(5, gc.extract(0, ug0));
+	EXPECT_EQ(7, ug0.number_of_edges());
+	EXPECT_TRUE(ug0.is_edge(0, 4));
+	EXPECT_EQ(-1, gc.extract(4, ug0));
+
+	//same components for sparse graphs
+	GraphComponents<sparse_ugraph> gcs(sug, 2);
+	EXPECT_EQ(4, gcs.find_components());
+	EXPECT_EQ(labels_exp, gcs.labels());
+	EXPECT_EQ(3, gcs.component(1).size());
+
+	sparse_ugraph sug2;
+	EXPECT_EQ(2, gcs.extract(2, sug2));
+	EXPECT_TRUE(sug2.is_edge(0, 1));
+}
+
+TEST(GraphComponents, random_graphs) {
+
+	for (uint64_t seed = 1; seed <= 3; ++seed) {
+		const int NV = 3000;
+		sparse_ugraph sug;
+		ParallelRandomGen<sparse_ugraph>::create_graph(sug, NV, 1.0 / NV, seed);
+		ugraph ug;
+		GraphConversion::sug2ug(sug, ug);
+
+		GraphComponents<ugraph> gc(ug);
+		const int nC = gc.find_components();
+		GraphComponents<sparse_ugraph> gcs(sug, 4);
+		EXPECT_EQ(nC, gcs.find_components());
+		EXPECT_EQ(gc.labels(), gcs.labels());
+		EXPECT_EQ(gc.sizes(), gcs.sizes());
+		EXPECT_TRUE(std::is_sorted(gc.sizes().rbegin(), gc.sizes().rend()));
+
+		//every component is the set reached by a BFS from any of its vertices
+		BFS<sparse_ugraph> bfs(sug);
+		for (int c : { 0, 1, nC / 2, nC - 1 }) {
+			const vint vc = gcs.vertices(c);
+			bfs.run(vc.back());
+			EXPECT_EQ(gcs.size(c), bfs.number_of_visited());
+			for (auto v : vc) {
+				EXPECT_TRUE(bfs.visited().is_bit(v));
+			}
+		}
+	}
+}
+
+TEST(GraphComponents, for_each_component) {
+
+	sparse_ugraph sug;
+	ParallelRandomGen<sparse_ugraph>::create_graph(sug, 2000, 1.5 / 2000, 7);
+
+	GraphComponents<sparse_ugraph> gcs(sug, 3);
+	const int nC = gcs.find_components();
+	const int nLarge = nC - gcs.number_of_singletons();
+
+	//every non-trivial component is processed once, edges are preserved
+	std::vector<std::atomic<int>> seen(nC);
+	for (auto& s : seen) { s.store(0); }
+	std::atomic<uint64_t> nEdges(0);
+	EXPECT_EQ(nLarge, gcs.for_each_component([&](int c, sparse_ugraph& g, const vint& n2o) {
+		++seen[c];
+		nEdges += g.number_of_edges();
+		EXPECT_EQ(gcs.vertices(c), n2o);
+	}, 2));
+
+	EXPECT_EQ(sug.number_of_edges(), nEdges.load());
+	for (auto c = 0; c < nC; ++c) {
+		EXPECT_EQ(c < nLarge ? 1 : 0, seen[c].load());
+	}
+}
+
+TEST(GraphComponents, drivers) {
+
+	//sparse random graph with many components and a hidden clique of 12 vertices
+	sparse_ugraph sug;
+	vint clq;
+	GraphModelGen<sparse_ugraph>::create_planted_clique(sug, 5000, 1.0 / 5000, 12, clq);
+	ugraph ug;
+	GraphConversion::sug2ug(sug, ug);
+
+	GraphComponents<sparse_ugraph> gcs(sug, 2);
+	ASSERT_LT(1, gcs.find_components());
+
+	//coreness - same as the decomposition of the whole graph
+	vint core;
+	KCoreParallel kc(sug, 1);
+	kc.find_kcore(1);
+	EXPECT_EQ(kc.max_core_number(), gcs.coreness(core));
+	EXPECT_EQ(kc.coreness_numbers(), core);
+
+	//coloring - a proper coloring with the colors of the largest component
+	vint col;
+	const int k = gcs.coloring(col);
+	EXPECT_LE(12, k);
+	EXPECT_EQ(k, 1 + *std::max_element(col.begin(), col.end()));
+	const int NV = static_cast<int>(ug.number_of_vertices());
+	for (auto v = 0; v < NV; ++v) {
+		for (auto u = v + 1; u < NV; ++u) {
+			if (ug.is_edge(v, u)) { ASSERT_NE(col[v], col[u]); }
+		}
+	}
+
+	//clique heuristic
+	vint clqh;
+	EXPECT_LE(12, gcs.clique_heur(clqh));
+	EXPECT_TRUE(gfunc::clq::is_clique(sug, clqh));
+
+	//same results for dense graphs
+	GraphComponents<ugraph> gc(ug, 1);
+	gc.find_components();
+	vint cored;
+	EXPECT_EQ(kc.max_core_number(), gc.coreness(cored));
+	EXPECT_EQ(core, cored);
+	vint clqd;
+	EXPECT_EQ(static_cast<int>(clqh.size()), gc.clique_heur(clqd));
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, clqd));
+}
+
+TEST(GraphComponents, empty_graph) {
+
+	ugraph ug(5);
+	GraphComponents<ugraph> gc(ug);
+	EXPECT_EQ(5, gc.find_components());
+	EXPECT_EQ(5, gc.number_of_singletons());
+	EXPECT_EQ(0, gc.for_each_component([](int, ugraph&, const vint&) {}, 2));
+
+	vint clq, core, col;
+	EXPECT_EQ(1, gc.clique_heur(clq));
+	EXPECT_EQ(1, clq.size());
+	EXPECT_EQ(0, gc.coreness(core));
+	EXPECT_EQ(1, gc.coloring(col));
+}
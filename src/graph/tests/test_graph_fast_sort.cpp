@@ -10,6 +10,8 @@
 
 #include "graph/algorithms/graph_fast_sort.h"				//includes #include "graph/simple_ugraph.h"
 #include "graph/algorithms/graph_fast_sort_weighted.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/triangles.h"
 
 #include "gtest/gtest.h"
 #include <iostream>
@@ -404,6 +406,126 @@ TEST(GraphFastRootSort, new_order_dimacs) {
 	//sorter.print(gt::PRINT_NODES, cout);
 }
 
+namespace {
+
+	/*
+	* @brief Reference degenerate ordering - the original O(|V|^2) implementation: selects
+	*		 the active vertex with minimum (maximum) degree scanning @ord, first vertex on ties
+	*/
+	template<class Graph_t>
+	vint degen_ordering_ref(Graph_t& g, vint deg, const vint& ord, bool min_first) {
+		const int NV = g.number_of_vertices();
+		vector<char> active(NV, 1);
+		vint res;
+		for (int i = 0; i < NV; i++) {
+			int v = EMPTY_ELEM;
+			for (auto u : ord) {
+				if (active[u] && (v == EMPTY_ELEM || (min_first ? deg[u] < deg[v] : deg[u] > deg[v]))) {
+					v = u;
+				}
+			}
+			res.emplace_back(v);
+			active[v] = 0;
+			for (int w = 0; w < NV; w++) {
+				if (active[w] && g.is_edge(v, w)) { deg[w]--; }
+			}
+		}
+		return res;
+	}
+
+	/*
+	* @brief checks that the bucket-based degenerate orderings of @g match the reference ones
+	*/
+	template<class Graph_t>
+	void check_degen_orderings(Graph_t& g) {
+		using gt = GraphFastRootSort<Graph_t>;
+		gt sorter(g);
+
+		vint id, deg;
+		gt::compute_deg(g, deg);
+		for (int v = 0; v < (int)g.number_of_vertices(); v++) { id.emplace_back(v); }
+
+		sorter.compute_deg_root();
+		EXPECT_EQ(degen_ordering_ref(g, deg, id, true), sorter.sort_degen_non_decreasing_deg(false));
+		sorter.compute_deg_root();
+		EXPECT_EQ(degen_ordering_ref(g, deg, id, false), sorter.sort_degen_non_increasing_deg(false));
+		EXPECT_EQ(degen_ordering_ref(g, deg, id, true), sorter.sort_degen_non_decreasing_deg_B(false));
+
+		//composite orderings - ties by the previous (support) ordering
+		sorter.compute_deg_root();
+		sorter.compute_support_root();
+		vint ord = sorter.sort_non_decreasing_deg_with_support_tb(false);
+		EXPECT_EQ(degen_ordering_ref(g, deg, ord, true), sorter.sort_degen_composite_non_decreasing_deg(false));
+
+		sorter.compute_deg_root();
+		ord = sorter.sort_non_increasing_deg_with_support_tb(false);
+		EXPECT_EQ(degen_ordering_ref(g, deg, ord, false), sorter.sort_degen_composite_non_increasing_deg(false));
+	}
+}
+
+TEST(GraphFastRootSort, degen_bucket_vs_reference) {
+
+	//DIMACS
+	string name = "brock200_2.clq";
+	name.insert(0, TESTS_GRAPH_DATA_CMAKE);
+	ugraph ug(name);
+	check_degen_orderings(ug);
+
+	//random graphs - many ties in sparse graphs, isolated vertices in sparse bitsets
+	for (double p : { 0.01, 0.05, 0.3, 0.7 }) {
+		ugraph ugr;
+		RandomGen<ugraph>::create_graph(ugr, 300, p);
+		check_degen_orderings(ugr);
+
+		sparse_ugraph sug(300);
+		for (int i = 0; i < 299; i++) {
+			for (int j = i + 1; j < 300; j++) {
+				if (ugr.is_edge(i, j)) { sug.add_edge(i, j); }
+			}
+		}
+		check_degen_orderings(sug);
+	}
+
+	//empty graph and graph with no edges
+	ugraph ug0(5);
+	check_degen_orderings(ug0);
+}
+
+TEST(GraphFastRootSort, triangle_ordering) {
+
+	//K4 {0, 1, 2, 3} plus triangle {3, 4, 5} and pendant vertex 6
+	ugraph ug(7);
+	ug.add_edge(0, 1); ug.add_edge(0, 2); ug.add_edge(0, 3);
+	ug.add_edge(1, 2); ug.add_edge(1, 3); ug.add_edge(2, 3);
+	ug.add_edge(3, 4); ug.add_edge(3, 5); ug.add_edge(4, 5);
+	ug.add_edge(5, 6);
+
+	using gt = GraphFastRootSort<ugraph>;
+	gt sorter(ug);
+
+	//triangles: 3, 3, 3, 4, 1, 1, 0 - ties broken by degree (5 has degree 3), then stable by index
+	TriangleCount<ugraph> tc(ug);
+	tc.count_per_vertex();
+	EXPECT_TRUE(sorter.new_order(gt::MAX_TRIANGLES).empty());					//triangles not set
+	EXPECT_EQ(-1, sorter.set_triangles(vector<uint64_t>(3, 0)));				//wrong size
+	EXPECT_EQ(0, sorter.set_triangles(tc.triangles()));
+	sorter.compute_deg_root();
+	vector<uint64_t> tri_exp = { 3, 3, 3, 4, 1, 1, 0 };
+	EXPECT_EQ(tri_exp, sorter.triangles());
+
+	vint ord_exp = { 3, 0, 1, 2, 5, 4, 6 };
+	EXPECT_EQ(ord_exp, sorter.sort_non_increasing_tri(false));
+
+	ord_exp = { 6, 4, 5, 0, 1, 2, 3 };
+	EXPECT_EQ(ord_exp, sorter.sort_non_decreasing_tri(false));
+
+	//driver
+	ord_exp = { 3, 0, 1, 2, 5, 4, 6 };
+	EXPECT_EQ(ord_exp, sorter.new_order(gt::MAX_TRIANGLES, FIRST_TO_LAST, OLD_TO_NEW));
+	std::reverse(ord_exp.begin(), ord_exp.end());
+	EXPECT_EQ(ord_exp, sorter.new_order(gt::MAX_TRIANGLES, LAST_TO_FIRST, OLD_TO_NEW));
+}
+
 ////////////////////////////////////
 // 
 // TESTS for sorting subgraphs
@@ -15,6 +15,7 @@
 #include "graph/simple_ugraph.h"
 #include "utils/common.h"
 #include <iostream>
+#include <algorithm>
 
 using vint = std::vector<int>;
 
@@ -114,6 +115,150 @@ TEST_F(GraphMapTest, predefined_single_ordering){
 	gm.print_mappings();*/
 }
 
+TEST_F(GraphMapTest, map_bitsets) {
+
+	//l2r={1, 2, 3 ,0}, r2l={3, 0, 1, 2}
+	GraphMap gm;
+	gm.build_mapping< GraphFastRootSort<ugraph>>(ug, GraphFastRootSort<ugraph>::MAX, _sort::FIRST_TO_LAST,
+		GraphFastRootSort<ugraph>::MIN, _sort::FIRST_TO_LAST, "MAX F2L", "MIN F2L");
+
+	bitarray bbl(NV), bbr(NV);
+	bbl.set_bit(0); bbl.set_bit(3);
+	bbr.set_bit(2);
+
+	gm.map_l2r(bbl, bbr);
+	vint lr_exp = { 0, 1 };
+	EXPECT_EQ(lr_exp, static_cast<vint>(bbr));
+
+	//keeps the contents of the output
+	bitarray bbl2(NV);
+	bbl2.set_bit(1);
+	gm.map_l2r(bbl2, bbr, false);
+	vint lr2_exp = { 0, 1, 2 };
+	EXPECT_EQ(lr2_exp, static_cast<vint>(bbr));
+
+	bitarray bbl3(NV);
+	gm.map_r2l(bbl3, bbr);
+	vint rl_exp = { 0, 1, 3 };
+	EXPECT_EQ(rl_exp, static_cast<vint>(bbl3));
+
+	//sparse bitsets
+	sparse_bitarray sbl(NV), sbr(NV);
+	sbl.set_bit(0); sbl.set_bit(3);
+	gm.map_l2r(sbl, sbr);
+	EXPECT_EQ(lr_exp, static_cast<vint>(sbr));
+	sbl.erase_bit();
+	sbl.set_bit(1);
+	gm.map_l2r(sbl, sbr, false);
+	EXPECT_EQ(lr2_exp, static_cast<vint>(sbr));
+}
+
+TEST(GraphMap, map_bitsets_large) {
+
+	//random permutations of 5000 vertices
+	const int NV = 5000;
+	vint o2nL(NV), o2nR(NV);
+	for (int v = 0; v < NV; ++v) {
+		o2nL[v] = v;
+		o2nR[v] = (v * 37 + 11) % NV;
+	}
+	std::reverse(o2nL.begin(), o2nL.end());
+
+	GraphMap gm;
+	ASSERT_EQ(0, gm.build_mapping(o2nL, o2nR));
+	EXPECT_TRUE(gm.has_inverse());
+
+	for (int step : { 1, 3, 97 }) {
+		bitarray bbl(NV);
+		sparse_bitarray sbl(NV);
+		vint lv;
+		for (int v = 0; v < NV; v += step) { bbl.set_bit(v); sbl.set_bit(v); lv.push_back(gm.map_l2r(v)); }
+		std::sort(lv.begin(), lv.end());
+
+		bitarray bbr(NV);
+		gm.map_l2r(bbl, bbr);
+		EXPECT_EQ(lv, static_cast<vint>(bbr));
+
+		sparse_bitarray sbr(NV);
+		gm.map_l2r(sbl, sbr);
+		EXPECT_EQ(lv, static_cast<vint>(sbr));
+
+		for (int nThreads : { 1, 4 }) {
+			bitarray bbp(NV);
+			bbp.set_bit(NV - 1);
+			gm.map_l2r_parallel(bbl, bbp, nThreads);
+			EXPECT_TRUE(bbp == bbr);
+
+			bitarray bbb(NV);
+			gm.map_r2l_parallel(bbb, bbp, nThreads);
+			EXPECT_TRUE(bbb == bbl);
+		}
+	}
+
+	//cached inverse of a given mapping
+	GraphMap gm1;
+	vint l2r(gm.get_l2r());
+	gm1.set_l2r(l2r, "L");
+	EXPECT_FALSE(gm1.has_inverse());
+	gm1.cache_inverse();
+	EXPECT_TRUE(gm1.has_inverse());
+	EXPECT_EQ(gm.get_r2l(), gm1.get_r2l());
+
+	//the inverse is no longer valid when one of the mappings is set on its own
+	gm1.set_r2l(l2r, "R");
+	EXPECT_FALSE(gm1.has_inverse());
+	gm1.set_r2l(l2r, "R", true);
+	EXPECT_TRUE(gm1.has_inverse());
+	EXPECT_TRUE(gm1.is_consistent());
+}
+
+TEST(GraphMap, map_bitsets_partial) {
+
+	//vertices v % 3 == 0 have no image, the images are the odd vertices (even vertices are not an image)
+	const int NV = 3000;
+	vint l2r(NV, EMPTY_ELEM);
+	int next = 1;
+	for (int v = NV - 1; v >= 0; --v) {
+		if (v % 3 != 0 && next < NV) { l2r[v] = next; next += 2; }
+	}
+
+	GraphMap gm;
+	gm.set_l2r(l2r, "L");
+	gm.cache_inverse();
+	ASSERT_TRUE(gm.has_inverse());
+	EXPECT_EQ(EMPTY_ELEM, gm.map_r2l(0));
+
+	bitarray bbl(NV);
+	bbl.set_bit(0, NV - 1);
+	vint lv;
+	for (int v = 0; v < NV; ++v) {
+		if (l2r[v] >= 0) { lv.push_back(l2r[v]); }
+	}
+	std::sort(lv.begin(), lv.end());
+
+	bitarray bbr(NV);
+	gm.map_l2r(bbl, bbr);
+	EXPECT_EQ(lv, static_cast<vint>(bbr));
+
+	sparse_bitarray sbl(NV), sbr(NV);
+	sbl.set_bit(0, NV - 1);
+	gm.map_l2r(sbl, sbr);
+	EXPECT_EQ(lv, static_cast<vint>(sbr));
+
+	for (int nThreads : { 1, 4 }) {
+		bitarray bbp(NV);
+		gm.map_l2r_parallel(bbl, bbp, nThreads);
+		EXPECT_TRUE(bbp == bbr);
+
+		//back to the vertices which have an image
+		bitarray bbb(NV);
+		gm.map_r2l_parallel(bbb, bbp, nThreads);
+		for (int v = 0; v < NV; ++v) {
+			EXPECT_EQ(l2r[v] >= 0, bbb.is_bit(v));
+		}
+	}
+}
+
 ///////////////
 //
 // DEPRECATED TESTS - CHECK
@@ -0,0 +1,172 @@
+/**
+* @file  test_graph_reduce.cpp
+* @brief Unit tests for the maximum clique reduction pipeline (class GraphReduction)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/graph_reduce.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_parallel.h"
+
+using namespace std;
+using namespace bitgraph;
+
+TEST(GraphReduction, core) {
+
+	//K4 {0, 1, 2, 3} with pendant vertex 4, triangle {5, 6, 7}, isolated vertex 8
+	ugraph ug(9);
+	ug.add_edge(0, 1); ug.add_edge(0, 2); ug.add_edge(0, 3);
+	ug.add_edge(1, 2); ug.add_edge(1, 3); ug.add_edge(2, 3);
+	ug.add_edge(0, 4);
+	ug.add_edge(5, 6); ug.add_edge(5, 7); ug.add_edge(6, 7);
+
+	GraphReduction<ugraph> red(ug, 1);
+	ugraph ugr;
+	Decode d;
+
+	//////////////////////
+	EXPECT_EQ(4, red.reduce(ugr, d, 3));
+	//////////////////////
+
+	EXPECT_EQ(5, red.number_of_removed(GraphReduction<ugraph>::CORE));
+	EXPECT_EQ(0, red.number_of_removed(GraphReduction<ugraph>::DOMINATION));
+	EXPECT_EQ(1, red.number_of_components());
+	EXPECT_EQ(6, ugr.number_of_edges());
+
+	vint clq = { 0, 1, 2, 3 };
+	EXPECT_EQ(clq, d.decode(clq));
+	EXPECT_EQ(4, red.kernel().size());
+
+	//no clique larger than 4 - nothing left, the output graph is not modified
+	Decode d4;
+	EXPECT_EQ(0, red.reduce(ugr, d4, 4));
+	EXPECT_EQ(4, ugr.number_of_vertices());
+	EXPECT_TRUE(d4.is_empty());
+}
+
+TEST(GraphReduction, domination) {
+
+	//star with center 0 and leaves 1..4, path 5-6-0
+	ugraph ug(7);
+	for (int v = 1; v <= 4; ++v) { ug.add_edge(0, v); }
+	ug.add_edge(5, 6);
+	ug.add_edge(0, 6);
+
+	GraphReduction<ugraph> red(ug, 2);
+	ugraph ugr;
+	Decode d;
+
+	//leaves 2, 3, 4 have the same neighborhood as 1, N(1) and N(5) are subsets of N(6) and N(0)
+	EXPECT_EQ(2, red.reduce(ugr, d, 0, GraphReduction<ugraph>::DOMINATION));
+	EXPECT_EQ(5, red.number_of_removed(GraphReduction<ugraph>::DOMINATION));
+	EXPECT_EQ(0, red.number_of_removed(GraphReduction<ugraph>::CORE));
+	EXPECT_EQ(1, red.number_of_rounds());
+
+	vint kernel_exp = { 0, 6 };
+	EXPECT_EQ(kernel_exp, red.mapping());
+	EXPECT_TRUE(ugr.is_edge(0, 1));
+
+	//independent set - only one vertex is left
+	ugraph ugi(5);
+	GraphReduction<ugraph> redi(ugi);
+	EXPECT_EQ(1, redi.reduce(0));
+	EXPECT_TRUE(redi.kernel().is_bit(0));
+}
+
+TEST(GraphReduction, components) {
+
+	//triangles {0, 2, 4} and {1, 3, 5}, edge {6, 7}
+	ugraph ug(8);
+	ug.add_edge(0, 2); ug.add_edge(0, 4); ug.add_edge(2, 4);
+	ug.add_edge(1, 3); ug.add_edge(1, 5); ug.add_edge(3, 5);
+	ug.add_edge(6, 7);
+
+	GraphReduction<ugraph> red(ug);
+	ugraph ugr;
+	Decode d;
+	EXPECT_EQ(6, red.reduce(ugr, d, 2, GraphReduction<ugraph>::COMPONENTS));
+	EXPECT_EQ(2, red.number_of_removed(GraphReduction<ugraph>::COMPONENTS));
+
+	vint comp_exp = { 0, 3, 6 };
+	EXPECT_EQ(comp_exp, red.components());
+	vint map_exp = { 0, 2, 4, 1, 3, 5 };
+	EXPECT_EQ(map_exp, red.mapping());
+	EXPECT_TRUE(ugr.is_edge(0, 2));
+	EXPECT_TRUE(ugr.is_edge(3, 5));
+	EXPECT_FALSE(ugr.is_edge(2, 3));
+
+	//unknown rule
+	EXPECT_EQ(-1, red.reduce(ugr, d, 2, 0x10));
+}
+
+TEST(GraphReduction, preserves_maximum_clique) {
+
+	for (double p : { 0.1, 0.3, 0.6 }) {
+		for (uint64_t seed = 1; seed <= 3; ++seed) {
+			ugraph ug;
+			ParallelRandomGen<ugraph>::create_graph(ug, 150, p, seed);
+			sparse_ugraph sug;
+			GraphConversion::ug2sug(ug, sug);
+
+			CliqueParallel<ugraph> cp(ug);
+			cp.number_of_threads(1);
+			const int omega = cp.run();
+
+			for (int lb : { 0, omega / 2, omega - 1 }) {
+				GraphReduction<ugraph> red(ug, 2);
+				ugraph ugr;
+				Decode d;
+				const int nR = red.reduce(ugr, d, lb);
+				ASSERT_LT(0, nR);
+				EXPECT_GE(ug.number_of_vertices(), nR);
+
+				CliqueParallel<ugraph> cpr(ugr);
+				cpr.number_of_threads(1);
+				EXPECT_EQ(omega, cpr.run());
+				vint clq = d.decode(cpr.clique());
+				EXPECT_TRUE(gfunc::clq::is_clique(ug, clq));
+
+				//same reduction for sparse graphs
+				GraphReduction<sparse_ugraph> reds(sug, 3);
+				sparse_ugraph sugr;
+				Decode ds;
+				EXPECT_EQ(nR, reds.reduce(sugr, ds, lb));
+				EXPECT_EQ(red.mapping(), reds.mapping());
+				EXPECT_EQ(red.components(), reds.components());
+				EXPECT_EQ(ugr.number_of_edges(), sugr.number_of_edges());
+			}
+		}
+	}
+}
+
+TEST(GraphReduction, sparse_planted_clique) {
+
+	//sparse graph with a hidden clique of 25 vertices
+	sparse_ugraph sug;
+	vint clq;
+	GraphModelGen<sparse_ugraph>::create_planted_clique(sug, 20000, 0.0005, 25, clq);
+
+	GraphReduction<sparse_ugraph> red(sug);
+	sparse_ugraph sugr;
+	Decode d;
+	const int nR = red.reduce(sugr, d, 10);
+
+	//only the planted clique is left
+	EXPECT_GE(20000 / 100, nR);
+	EXPECT_LE(25, nR);
+	for (auto v : clq) {
+		EXPECT_TRUE(red.kernel().is_bit(v));
+	}
+
+	vint lv(nR);
+	for (int v = 0; v < nR; ++v) { lv[v] = v; }
+	vint kernel = d.decode(lv);
+	EXPECT_EQ(red.mapping(), kernel);
+}
@@ -0,0 +1,143 @@
+/**
+* @file  test_kcore_parallel.cpp
+* @brief Unit tests for the multi-threaded k-core decomposition (class KCoreParallel)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/kcore_parallel.h"
+#include <memory>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief TRUE if @ord is a permutation of V(@g) in non-decreasing coreness where every vertex
+	*		 has at most @core[v] neighbors after it (degeneracy ordering)
+	*/
+	template<class Graph_t>
+	bool is_degeneracy_ordering(Graph_t& g, const vint& ord, const vint& core) {
+		const int NV = g.number_of_vertices();
+		if (static_cast<int>(ord.size()) != NV) { return false; }
+
+		vint pos(NV, EMPTY_ELEM);
+		for (int i = 0; i < NV; ++i) {
+			if (ord[i] < 0 || ord[i] >= NV || pos[ord[i]] != EMPTY_ELEM) { return false; }
+			pos[ord[i]] = i;
+		}
+
+		for (int i = 0; i < NV; ++i) {
+			int v = ord[i];
+			if (i > 0 && core[ord[i - 1]] > core[v]) { return false; }
+
+			int nLater = 0;
+			auto& nv = g.neighbors(v);
+			if (!nv.is_empty()) {
+				nv.init_scan(bbo::NON_DESTRUCTIVE);
+				int u = bbo::noBit;
+				while ((u = nv.next_bit()) != bbo::noBit) {
+					if (pos[u] > i) { ++nLater; }
+				}
+			}
+			if (nLater > core[v]) { return false; }
+		}
+		return true;
+	}
+}
+
+TEST(KCoreParallel, star) {
+
+	//star graph with 11 vertices and a clique {0, 1, 6}
+	sparse_ugraph sug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "star.clq");
+
+	KCore<sparse_ugraph> kc(sug);
+	kc.find_kcore();
+
+	KCoreParallel kcp(sug, 2);
+	EXPECT_EQ(11, kcp.number_of_vertices());
+	EXPECT_EQ(sug.number_of_edges(), kcp.number_of_edges());
+
+	////////////////////
+	ASSERT_EQ(0, kcp.find_kcore(2));
+	///////////////////
+
+	EXPECT_EQ(kc.coreness_numbers(), kcp.coreness_numbers());
+	EXPECT_EQ(2, kcp.max_core_number());
+	EXPECT_EQ(2, kcp.coreness(6));
+	EXPECT_TRUE(is_degeneracy_ordering(sug, kcp.kcore_ordering(), kcp.coreness_numbers()));
+}
+
+TEST(KCoreParallel, csr) {
+
+	//path 0-1-2-3 and triangle 4-5-6
+	vector<KCoreParallel::offset_t> off = { 0, 1, 3, 5, 6, 8, 10, 12 };
+	vint adj = { 1,  0, 2,  1, 3,  2,  5, 6,  4, 6,  4, 5 };
+
+	KCoreParallel kcp(off, adj);
+	ASSERT_EQ(0, kcp.find_kcore(3));
+
+	vint core_exp = { 1, 1, 1, 1, 2, 2, 2 };
+	EXPECT_EQ(core_exp, kcp.coreness_numbers());
+	EXPECT_EQ(2, kcp.max_core_number());
+
+	//bad CSR graphs
+	KCoreParallel kcp1(vector<KCoreParallel::offset_t>{ 0, 1, 3 }, vint{ 1, 0 });
+	EXPECT_EQ(-1, kcp1.find_kcore());
+
+	KCoreParallel kcp2(vector<KCoreParallel::offset_t>{ 0, 1, 2 }, vint{ 1, 7 });
+	EXPECT_EQ(-1, kcp2.find_kcore());
+
+	//empty graph
+	KCoreParallel kcp3(vector<KCoreParallel::offset_t>{}, vint{});
+	EXPECT_EQ(0, kcp3.find_kcore());
+	EXPECT_EQ(0, kcp3.max_core_number());
+}
+
+TEST(KCoreParallel, dense) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+
+	KCore<ugraph> kc(ug);
+	kc.find_kcore();
+
+	KCoreParallel kcp(ug);
+	for (int nThreads : { 1, 2, 4 }) {
+		ASSERT_EQ(0, kcp.find_kcore(nThreads));
+		EXPECT_EQ(kc.coreness_numbers(), kcp.coreness_numbers());
+		EXPECT_EQ(kc.max_core_number(), kcp.max_core_number());
+		EXPECT_TRUE(is_degeneracy_ordering(ug, kcp.kcore_ordering(), kcp.coreness_numbers()));
+	}
+}
+
+TEST(KCoreParallel, sparse_random) {
+
+	//large frontiers - exercises the parallel rounds
+	const int NV = 20000;
+	sparse_ugraph sug;
+	std::unique_ptr<SparseRandomGen<sparse_ugraph>> gen(new SparseRandomGen<sparse_ugraph>());
+	gen->create_ugraph(sug, NV, 0.0005);
+
+	KCore<sparse_ugraph> kc(sug);
+	kc.find_kcore();
+
+	KCoreParallel kcp(sug, 4);
+	ASSERT_EQ(0, kcp.find_kcore(1));
+	vint ord1 = kcp.kcore_ordering();
+	EXPECT_EQ(kc.coreness_numbers(), kcp.coreness_numbers());
+	EXPECT_TRUE(is_degeneracy_ordering(sug, ord1, kcp.coreness_numbers()));
+
+	//the ordering does not depend on the number of threads
+	for (int nThreads : { 2, 3, 8 }) {
+		ASSERT_EQ(0, kcp.find_kcore(nThreads));
+		EXPECT_EQ(kc.coreness_numbers(), kcp.coreness_numbers());
+		EXPECT_EQ(ord1, kcp.kcore_ordering());
+	}
+}
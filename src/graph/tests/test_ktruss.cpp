@@ -0,0 +1,192 @@
+/**
+* @file  test_ktruss.cpp
+* @brief Unit tests for the truss decomposition (class KTruss)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/kcore.h"
+#include "graph/algorithms/ktruss.h"
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief trussness of every edge (u, w), u < w, by definition: the k-truss is obtained removing
+	*		 edges with less than k - 2 triangles until none is left (only for small graphs)
+	*/
+	vector<vint> brute_force_truss(ugraph& g) {
+		const int NV = g.number_of_vertices();
+		vector<vint> truss(NV, vint(NV, 0));
+		vector<vint> alive(NV, vint(NV, 0));
+		for (int u = 0; u < NV; ++u) {
+			for (int w = 0; w < NV; ++w) {
+				alive[u][w] = g.is_edge(u, w) ? 1 : 0;
+			}
+		}
+
+		for (int k = 2; ; ++k) {
+
+			//k-truss from the (k-1)-truss
+			bool removed = true;
+			while (removed) {
+				removed = false;
+				for (int u = 0; u < NV; ++u) {
+					for (int w = u + 1; w < NV; ++w) {
+						if (!alive[u][w]) { continue; }
+						int nTri = 0;
+						for (int x = 0; x < NV; ++x) {
+							if (alive[u][x] && alive[w][x]) { ++nTri; }
+						}
+						if (nTri < k - 2) {
+							alive[u][w] = alive[w][u] = 0;
+							removed = true;
+						}
+					}
+				}
+			}
+
+			bool empty = true;
+			for (int u = 0; u < NV; ++u) {
+				for (int w = u + 1; w < NV; ++w) {
+					if (alive[u][w]) { truss[u][w] = k; empty = false; }
+				}
+			}
+			if (empty) { break; }
+		}
+		return truss;
+	}
+}
+
+TEST(KTruss, toy) {
+
+	//K4 {0, 1, 2, 3}, triangle {3, 4, 5} and pendant edge (5, 6)
+	ugraph ug(7);
+	ug.add_edge(0, 1); ug.add_edge(0, 2); ug.add_edge(0, 3);
+	ug.add_edge(1, 2); ug.add_edge(1, 3); ug.add_edge(2, 3);
+	ug.add_edge(3, 4); ug.add_edge(3, 5); ug.add_edge(4, 5);
+	ug.add_edge(5, 6);
+
+	KTruss<ugraph> kt(ug);
+	EXPECT_EQ(10, kt.number_of_edges());
+	EXPECT_EQ(KTruss<ugraph>::NO_EDGE, kt.edge_id(0, 4));
+	EXPECT_EQ(make_pair(1, 3), kt.edge(kt.edge_id(3, 1)));
+
+	//////////////////////
+	EXPECT_EQ(4, kt.find_truss());
+	//////////////////////
+
+	EXPECT_EQ(2, kt.support()[kt.edge_id(0, 1)]);
+	EXPECT_EQ(3, kt.support()[kt.edge_id(2, 3)] + kt.support()[kt.edge_id(5, 6)] + kt.support()[kt.edge_id(4, 5)]);
+
+	EXPECT_EQ(4, kt.trussness(0, 1));
+	EXPECT_EQ(3, kt.trussness(3, 4));
+	EXPECT_EQ(2, kt.trussness(5, 6));
+	EXPECT_EQ(EMPTY_ELEM, kt.trussness(0, 6));
+
+	//max truss - K4
+	EXPECT_EQ(6, kt.truss_edges().size());
+	ugraph ugt;
+	EXPECT_EQ(6, kt.truss_subgraph(ugt));
+	EXPECT_EQ(7, ugt.number_of_vertices());
+	EXPECT_TRUE(ugt.is_edge(0, 3));
+	EXPECT_FALSE(ugt.is_edge(3, 4));
+
+	//3-truss
+	EXPECT_EQ(9, kt.truss_edges(3).size());
+}
+
+TEST(KTruss, brute_force) {
+
+	const int NV = 30;
+	for (double p : { 0.1, 0.3, 0.6 }) {
+		for (int rep = 0; rep < 3; ++rep) {
+			ugraph ug;
+			RandomGen<ugraph>::create_graph(ug, NV, p);
+			auto truss = brute_force_truss(ug);
+
+			KTruss<ugraph> kt(ug);
+			kt.find_truss();
+
+			int maxTruss = 0;
+			for (KTruss<ugraph>::edge_t e = 0; e < kt.number_of_edges(); ++e) {
+				auto uw = kt.edge(e);
+				EXPECT_EQ(truss[uw.first][uw.second], kt.trussness()[e]);
+				maxTruss = std::max(maxTruss, truss[uw.first][uw.second]);
+			}
+			EXPECT_EQ(maxTruss, kt.max_truss());
+		}
+	}
+}
+
+TEST(KTruss, sparse_vs_dense) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_2.clq");
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	KTruss<ugraph> kt(ug);
+	KTruss<sparse_ugraph> kts(sug);
+	ASSERT_EQ(kt.number_of_edges(), kts.number_of_edges());
+
+	kt.find_truss();
+	for (int nThreads : { 1, 3 }) {
+		kts.find_truss(nThreads);
+		EXPECT_EQ(kt.support(), kts.support());
+		EXPECT_EQ(kt.trussness(), kts.trussness());
+		EXPECT_EQ(kt.max_truss(), kts.max_truss());
+	}
+
+	//a k-truss is a (k-1)-core, so the max truss is at most the max core number plus one
+	KCore<ugraph> kc(ug);
+	kc.find_kcore();
+	EXPECT_LE(kt.max_truss(), kc.max_core_number() + 1);
+	EXPECT_GE(kt.max_truss(), 3);
+
+	//every edge of the max truss has at least max_truss - 2 triangles inside it
+	sparse_ugraph sgt;
+	ASSERT_LT(0, kts.truss_subgraph(sgt));
+	KTruss<sparse_ugraph> kt2(sgt);
+	kt2.compute_support();
+	EXPECT_LE(kts.max_truss() - 2, *std::min_element(kt2.support().begin(), kt2.support().end()));
+}
+
+TEST(KTruss, parallel_support) {
+
+	ugraph ug;
+	RandomGen<ugraph>::create_graph(ug, 1000, 0.1);
+
+	KTruss<ugraph> kt(ug);
+	kt.compute_support(1);
+	vint sup1 = kt.support();
+	for (int nThreads : { 2, 4, 0 }) {
+		kt.compute_support(nThreads);
+		EXPECT_EQ(sup1, kt.support());
+	}
+
+	//every triangle is counted once by each of its 3 edges
+	uint64_t nTri3 = 0;
+	for (auto s : sup1) { nTri3 += s; }
+	EXPECT_EQ(0, nTri3 % 3);
+}
+
+TEST(KTruss, empty_graph) {
+
+	ugraph ug(5);
+	KTruss<ugraph> kt(ug);
+	EXPECT_EQ(0, kt.number_of_edges());
+	EXPECT_EQ(0, kt.find_truss());
+	EXPECT_TRUE(kt.truss_edges().empty());
+
+	sparse_ugraph sug(5);
+	KTruss<sparse_ugraph> kts(sug);
+	EXPECT_EQ(0, kts.find_truss(2));
+}
@@ -11,12 +11,32 @@
 
 #include "graph/graph.h"
 #include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/clique/clq_func.h"
+#include "graph/algorithms/clique/clq_parallel.h"
 #include "gtest/gtest.h"
 #include <iostream>
 
 using namespace std;
 using namespace bitgraph;	
 
+namespace {
+
+	/*
+	* @brief true if g is a simple undirected graph with the same edges as the sparse graph sg
+	*/
+	bool same_simple_ugraph(ugraph& g, sparse_ugraph& sg) {
+		const int NV = g.number_of_vertices();
+		if (NV != static_cast<int>(sg.number_of_vertices())) { return false; }
+		for (int v = 0; v < NV; ++v) {
+			if (g.is_edge(v, v) || sg.is_edge(v, v)) { return false; }
+			for (int w = 0; w < NV; ++w) {
+				if (g.is_edge(v, w) != g.is_edge(w, v) || g.is_edge(v, w) != sg.is_edge(v, w)) { return false; }
+			}
+		}
+		return true;
+	}
+}
+
 TEST(Random_Graph, random_attr_t){
 	
 	random_attr_t r1(100, 150, .3, .5, 1, 50, .1);
@@ -56,6 +76,248 @@ TEST(Random_Graph, sparse_ugraph){
 	
 }
 
+TEST(Random_Graph, transpose64) {
+
+	BITBOARD a[64] = { 0 };
+	a[0] = 0x2;						//(0, 1)
+	a[5] = bblock::MASK_BIT(63);	//(5, 63)
+	a[63] = 0x1;					//(63, 0)
+	ParallelRandomGen<ugraph>::transpose64(a);
+
+	EXPECT_EQ(bblock::MASK_BIT(63), a[0]);
+	EXPECT_EQ(0x1, a[1]);
+	EXPECT_EQ(bblock::MASK_BIT(5), a[63]);
+	for (int r = 2; r < 63; ++r) {
+		EXPECT_EQ(0, a[r]);
+	}
+}
+
+TEST(Random_Graph, parallel_ugraph) {
+
+	const int NV = 1000;
+	for (double p : { .01, .3, .8 }) {
+		ugraph ug;
+		ASSERT_EQ(0, ParallelRandomGen<ugraph>::create_graph(ug, NV, p, 7, 1));
+		EXPECT_EQ(NV, ug.number_of_vertices());
+		EXPECT_NEAR(p, ug.density(), .01);
+
+		//simple undirected graph
+		for (int v = 0; v < NV; ++v) {
+			ASSERT_FALSE(ug.is_edge(v, v));
+			for (int w = v + 1; w < NV; ++w) {
+				ASSERT_EQ(ug.is_edge(v, w), ug.is_edge(w, v));
+			}
+		}
+
+		//independent of the number of threads
+		ugraph ug3;
+		ParallelRandomGen<ugraph>::create_graph(ug3, NV, p, 7, 3);
+		EXPECT_TRUE(ug == ug3);
+
+		//different seeds
+		ugraph ug2;
+		ParallelRandomGen<ugraph>::create_graph(ug2, NV, p, 8, 2);
+		EXPECT_FALSE(ug == ug2);
+	}
+}
+
+TEST(Random_Graph, parallel_sparse_ugraph) {
+
+	const int NV = 777;						//last row block incomplete
+	for (double p : { .005, .1, .4 }) {
+		ugraph ug;
+		ParallelRandomGen<ugraph>::create_graph(ug, NV, p, 11, 2);
+
+		//same edges as the dense graph
+		for (int nThreads : { 1, 4 }) {
+			sparse_ugraph sug;
+			ASSERT_EQ(0, ParallelRandomGen<sparse_ugraph>::create_graph(sug, NV, p, 11, nThreads));
+			EXPECT_EQ(ug.number_of_edges(), sug.number_of_edges());
+			for (int v = 0; v < NV; ++v) {
+				ASSERT_FALSE(sug.is_edge(v, v));
+				EXPECT_EQ(ug.neighbors(v).size(), sug.neighbors(v).size());
+				for (int w = 0; w < NV; ++w) {
+					ASSERT_EQ(ug.is_edge(v, w), sug.is_edge(v, w));
+				}
+			}
+		}
+	}
+}
+
+TEST(Random_Graph, parallel_limits) {
+
+	ugraph ug;
+	ParallelRandomGen<ugraph>::create_graph(ug, 130, 0.0);
+	EXPECT_EQ(0, ug.number_of_edges());
+	EXPECT_EQ("r130_0.txt", ug.name());
+
+	ParallelRandomGen<ugraph>::create_graph(ug, 130, 1.0);
+	EXPECT_EQ(130 * 129 / 2, ug.number_of_edges());
+
+	sparse_ugraph sug;
+	ParallelRandomGen<sparse_ugraph>::create_graph(sug, 130, 1.0, 3, 2);
+	EXPECT_EQ(130 * 129 / 2, sug.number_of_edges());
+
+	ParallelRandomGen<sparse_ugraph>::create_graph(sug, 1, .5);
+	EXPECT_EQ(0, sug.number_of_edges());
+
+	EXPECT_EQ(-1, ParallelRandomGen<ugraph>::create_graph(ug, 0, .5));
+}
+
+TEST(Random_Graph, model_rmat) {
+
+	const int NV = 1000, M = 20000;
+	ugraph ug;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_rmat(ug, NV, M, .57, .19, .19, 5, 1));
+	EXPECT_EQ("rmat1000_20000.txt", ug.name());
+	EXPECT_GE(M, ug.number_of_edges());
+	EXPECT_LE(M / 2, ug.number_of_edges());
+
+	//skewed degrees
+	int maxDeg = 0;
+	for (int v = 0; v < NV; ++v) { maxDeg = std::max(maxDeg, ug.degree(v)); }
+	EXPECT_LT(10 * 2 * ug.number_of_edges() / NV, maxDeg);
+
+	//independent of the number of threads, same as sparse
+	sparse_ugraph sug;
+	ASSERT_EQ(0, GraphModelGen<sparse_ugraph>::create_rmat(sug, NV, M, .57, .19, .19, 5, 3));
+	EXPECT_TRUE(same_simple_ugraph(ug, sug));
+	EXPECT_EQ(ug.number_of_edges(), sug.number_of_edges());
+}
+
+TEST(Random_Graph, model_barabasi_albert) {
+
+	const int NV = 2000, D = 3;
+	ugraph ug;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_barabasi_albert(ug, NV, D, 9, 2));
+	EXPECT_GE(NV * D, ug.number_of_edges());
+	EXPECT_LE((NV - 2) * D * 9 / 10, ug.number_of_edges());
+
+	//every vertex v > 0 links to an earlier vertex
+	for (int v = 1; v < NV; ++v) {
+		int w = ug.neighbors(v).lsb();
+		ASSERT_LT(w, v);
+	}
+
+	//hubs
+	int maxDeg = 0;
+	for (int v = 0; v < NV; ++v) { maxDeg = std::max(maxDeg, ug.degree(v)); }
+	EXPECT_LT(10 * 2 * D, maxDeg);
+
+	sparse_ugraph sug;
+	ASSERT_EQ(0, GraphModelGen<sparse_ugraph>::create_barabasi_albert(sug, NV, D, 9, 1));
+	EXPECT_TRUE(same_simple_ugraph(ug, sug));
+}
+
+TEST(Random_Graph, model_geometric) {
+
+	const int NV = 600;
+	const double R = .08;
+	ugraph ug;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_geometric(ug, NV, R, 4, 3));
+
+	//edges by definition
+	for (int v = 0; v < NV; ++v) {
+		auto pv = GraphModelGen<ugraph>::geometric_point(4, v);
+		for (int w = 0; w < NV; ++w) {
+			auto pw = GraphModelGen<ugraph>::geometric_point(4, w);
+			double d2 = (pv.first - pw.first) * (pv.first - pw.first) + (pv.second - pw.second) * (pv.second - pw.second);
+			ASSERT_EQ(v != w && d2 <= R * R, ug.is_edge(v, w));
+		}
+	}
+
+	sparse_ugraph sug;
+	ASSERT_EQ(0, GraphModelGen<sparse_ugraph>::create_geometric(sug, NV, R, 4, 1));
+	EXPECT_TRUE(same_simple_ugraph(ug, sug));
+}
+
+TEST(Random_Graph, model_planted_clique) {
+
+	const int NV = 200, K = 20;
+	ugraph ug;
+	vint clq;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_planted_clique(ug, NV, .3, K, clq, 13, 2));
+	EXPECT_EQ("pc200_0.3_20.txt", ug.name());
+	ASSERT_EQ(K, clq.size());
+	EXPECT_TRUE(std::is_sorted(clq.begin(), clq.end()));
+	EXPECT_TRUE(gfunc::clq::is_clique(ug, clq));
+
+	//known optimum
+	CliqueParallel<ugraph> cp(ug);
+	EXPECT_EQ(K, cp.run());
+
+	sparse_ugraph sug;
+	vint clq2;
+	ASSERT_EQ(0, GraphModelGen<sparse_ugraph>::create_planted_clique(sug, NV, .3, K, clq2, 13, 1));
+	EXPECT_EQ(clq, clq2);
+	EXPECT_TRUE(same_simple_ugraph(ug, sug));
+}
+
+TEST(Random_Graph, model_planted_partition) {
+
+	const int NV = 900, Q = 4;
+	ugraph ug;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_planted_partition(ug, NV, Q, .5, .05, 21, 3));
+
+	//densities inside and between blocks
+	double in = 0, out = 0, pairsIn = 0, pairsOut = 0;
+	for (int v = 0; v < NV; ++v) {
+		for (int w = v + 1; w < NV; ++w) {
+			bool same = (v * Q / NV == w * Q / NV);
+			(same ? pairsIn : pairsOut) += 1;
+			if (ug.is_edge(v, w)) { (same ? in : out) += 1; }
+		}
+	}
+	EXPECT_NEAR(.5, in / pairsIn, .02);
+	EXPECT_NEAR(.05, out / pairsOut, .01);
+
+	//pIn = 1, pOut = 0 - disjoint cliques
+	sparse_ugraph sug;
+	ASSERT_EQ(0, GraphModelGen<sparse_ugraph>::create_planted_partition(sug, 10, 3, 1.0, 0.0));
+	EXPECT_EQ(3 + 3 + 6, sug.number_of_edges());
+	EXPECT_TRUE(sug.is_edge(0, 2));
+	EXPECT_FALSE(sug.is_edge(2, 3));
+	EXPECT_TRUE(sug.is_edge(6, 9));
+
+	ugraph ug2;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_planted_partition(ug2, NV, Q, .5, .05, 21, 1));
+	EXPECT_TRUE(ug == ug2);
+}
+
+TEST(Random_Graph, model_benchmark_attributes) {
+
+	random_attr_t rd(500, 500, .1, .1, 1, 1, .1);
+	EXPECT_EQ(random_attr_t::UNIFORM, rd.model);
+
+	//density parameter of each model
+	ugraph ug;
+	rd.model = random_attr_t::RMAT;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_graph(ug, 500, .1, rd, 1));
+	EXPECT_GE(.1, ug.density());
+
+	rd.model = random_attr_t::BARABASI_ALBERT;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_graph(ug, 500, .1, rd, 1));
+	EXPECT_EQ("ba500_25.txt", ug.name());
+
+	rd.model = random_attr_t::GEOMETRIC;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_graph(ug, 500, .1, rd, 1));
+	EXPECT_NEAR(.1, ug.density(), .03);
+
+	rd.model = random_attr_t::PLANTED_CLIQUE;
+	rd.k = 30;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_graph(ug, 500, .1, rd, 1));
+	EXPECT_EQ("pc500_0.1_30.txt", ug.name());
+
+	rd.model = random_attr_t::PLANTED_PARTITION;
+	rd.k = 5;
+	rd.pOut = .01;
+	ASSERT_EQ(0, GraphModelGen<ugraph>::create_graph(ug, 500, .1, rd, 1));
+	EXPECT_EQ("pp500_5_0.1_0.01.txt", ug.name());
+
+	rd.k = 0;
+	EXPECT_EQ(-1, GraphModelGen<ugraph>::create_graph(ug, 500, .1, rd, 1));
+}
+
 ////////////////////
 //
 // DSIABLED TESTS - CHECK
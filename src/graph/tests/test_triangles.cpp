@@ -0,0 +1,148 @@
+/**
+* @file  test_triangles.cpp
+* @brief Unit tests for triangle counting and clustering coefficients (class TriangleCount)
+* @dev pss
+* @details: created 17/10/2026, last update 17/10/2026
+**/
+
+#include "gtest/gtest.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include "graph/graph.h"
+#include "graph/algorithms/graph_gen.h"
+#include "graph/algorithms/graph_conversions.h"
+#include "graph/algorithms/triangles.h"
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	/*
+	* @brief triangles of each vertex by exhaustive enumeration - returns the total
+	*/
+	uint64_t brute_force_triangles(ugraph& g, vector<uint64_t>& tri) {
+		const int NV = g.number_of_vertices();
+		tri.assign(NV, 0);
+		uint64_t nTri = 0;
+		for (int a = 0; a < NV; ++a) {
+			for (int b = a + 1; b < NV; ++b) {
+				if (!g.is_edge(a, b)) { continue; }
+				for (int c = b + 1; c < NV; ++c) {
+					if (g.is_edge(a, c) && g.is_edge(b, c)) {
+						++tri[a]; ++tri[b]; ++tri[c];
+						++nTri;
+					}
+				}
+			}
+		}
+		return nTri;
+	}
+}
+
+TEST(TriangleCount, toy) {
+
+	//K4 {0, 1, 2, 3} plus triangle {3, 4, 5} and pendant vertex 6
+	ugraph ug(7);
+	ug.add_edge(0, 1); ug.add_edge(0, 2); ug.add_edge(0, 3);
+	ug.add_edge(1, 2); ug.add_edge(1, 3); ug.add_edge(2, 3);
+	ug.add_edge(3, 4); ug.add_edge(3, 5); ug.add_edge(4, 5);
+	ug.add_edge(5, 6);
+
+	TriangleCount<ugraph> tc(ug);
+
+	////////////////////////
+	EXPECT_EQ(5, tc.count());
+	////////////////////////
+
+	EXPECT_EQ(5, tc.count_per_vertex());
+	vector<uint64_t> tri_exp = { 3, 3, 3, 4, 1, 1, 0 };
+	EXPECT_EQ(tri_exp, tc.triangles());
+
+	EXPECT_DOUBLE_EQ(1.0, tc.clustering(0));
+	EXPECT_DOUBLE_EQ(0.4, tc.clustering(3));					//4 triangles / 10 pairs of neighbors
+	EXPECT_DOUBLE_EQ(1.0 / 3, tc.clustering(5));
+	EXPECT_DOUBLE_EQ(0.0, tc.clustering(6));
+
+	//15 triangle corners, 3 * 3 + 10 + 1 + 3 = 23 wedges
+	EXPECT_DOUBLE_EQ(15.0 / 23, tc.transitivity());
+}
+
+TEST(TriangleCount, brute_force) {
+
+	const int NV = 150;
+	for (double p : { 0.05, 0.3, 0.8 }) {
+		ugraph ug;
+		RandomGen<ugraph>::create_graph(ug, NV, p);
+		sparse_ugraph sug;
+		GraphConversion::ug2sug(ug, sug);
+
+		vector<uint64_t> tri;
+		uint64_t nTri = brute_force_triangles(ug, tri);
+
+		for (auto o : { TriangleCount<ugraph>::DEGREE, TriangleCount<ugraph>::DEGENERACY }) {
+			TriangleCount<ugraph> tc(ug, o);
+			TriangleCount<sparse_ugraph> tcs(sug, static_cast<TriangleCount<sparse_ugraph>::orient_t>(o));
+
+			for (int nThreads : { 1, 3 }) {
+				EXPECT_EQ(nTri, tc.count(nThreads));
+				EXPECT_EQ(nTri, tcs.count(nThreads));
+
+				EXPECT_EQ(nTri, tc.count_per_vertex(nThreads));
+				EXPECT_EQ(tri, tc.triangles());
+				EXPECT_EQ(nTri, tcs.count_per_vertex(nThreads));
+				EXPECT_EQ(tri, tcs.triangles());
+			}
+		}
+	}
+}
+
+TEST(TriangleCount, orientation) {
+
+	ugraph ug(PATH_GRAPH_TESTS_CMAKE_SRC_CODE "brock200_1.clq");
+
+	TriangleCount<ugraph> tcd(ug, TriangleCount<ugraph>::DEGREE);
+	TriangleCount<ugraph> tck(ug, TriangleCount<ugraph>::DEGENERACY);
+	EXPECT_EQ(tcd.count(), tck.count());
+
+	//degeneracy orientation - out-degree bounded by the max core number
+	KCoreParallel kc(ug);
+	kc.find_kcore();
+	EXPECT_LE(tck.max_out_degree(), kc.max_core_number());
+
+	//every vertex appears once in the orientation
+	vint ord = tck.ordering();
+	std::sort(ord.begin(), ord.end());
+	for (int v = 0; v < static_cast<int>(ord.size()); ++v) {
+		ASSERT_EQ(v, ord[v]);
+	}
+}
+
+TEST(TriangleCount, large_dense_tiles) {
+
+	//several column tiles per row
+	ugraph ug;
+	RandomGen<ugraph>::create_graph(ug, 2500, 0.1);
+	sparse_ugraph sug;
+	GraphConversion::ug2sug(ug, sug);
+
+	TriangleCount<ugraph> tc(ug);
+	TriangleCount<sparse_ugraph> tcs(sug);
+	EXPECT_EQ(tcs.count_per_vertex(), tc.count_per_vertex(2));
+	EXPECT_EQ(tcs.triangles(), tc.triangles());
+	EXPECT_NEAR(0.1, tc.transitivity(), 0.01);
+	EXPECT_NEAR(0.1, tc.average_clustering(), 0.01);
+}
+
+TEST(TriangleCount, empty_graph) {
+
+	ugraph ug(5);
+	TriangleCount<ugraph> tc(ug);
+	EXPECT_EQ(0, tc.count_per_vertex());
+	EXPECT_DOUBLE_EQ(0.0, tc.transitivity());
+	EXPECT_DOUBLE_EQ(0.0, tc.average_clustering());
+
+	sparse_ugraph sug(5);
+	TriangleCount<sparse_ugraph> tcs(sug, TriangleCount<sparse_ugraph>::DEGENERACY);
+	EXPECT_EQ(0, tcs.count(2));
+}
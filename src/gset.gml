@@ -0,0 +1,22 @@
+graph  [ hierarchic  1  directed  1 
+
+
+node  [ id 0 graphics  [ x 0 y 0 w 11 h 11 type "roundrectangle" fill "#FFFF00"] LabelGraphics  [  text 1 fontSize 7 ]  ]  
+node  [ id 1 graphics  [ x 0 y 0 w 11 h 11 type "roundrectangle" fill "#FFFF00"] LabelGraphics  [  text 2 fontSize 7 ]  ]  
+node  [ id 2 graphics  [ x 0 y 0 w 11 h 11 type "roundrectangle" fill "#FFFF00"] LabelGraphics  [  text 3 fontSize 7 ]  ]  
+node  [ id 3 graphics  [ x 0 y 0 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 4 fontSize 7 ]  ]  
+node  [ id 4 graphics  [ x 0 y 0 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 5 fontSize 7 ]  ]  
+node  [ id 5 graphics  [ x 0 y 0 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 6 fontSize 7 ]  ]  
+ edge   [  source  0 target 1 graphics  [   fill "#000000" ] ]
+ edge   [  source  0 target 2 graphics  [   fill "#000000" ] ]
+ edge   [  source  0 target 3 graphics  [   fill "#000000" ] ]
+ edge   [  source  1 target 2 graphics  [   fill "#000000" ] ]
+ edge   [  source  1 target 4 graphics  [   fill "#000000" ] ]
+ edge   [  source  2 target 5 graphics  [   fill "#000000" ] ]
+ edge   [  source  3 target 4 graphics  [   fill "#000000" ] ]
+ edge   [  source  3 target 5 graphics  [   fill "#000000" ] ]
+ edge   [  source  4 target 5 graphics  [   fill "#000000" ] ]
+
+] 
+
+
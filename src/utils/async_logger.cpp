@@ -0,0 +1,259 @@
+/**
+ * @file async_logger.cpp
+ * @brief implementation of class AsyncLogger in async_logger.h
+ * @details: created 17/10/2026, last_update 17/10/2026
+ * @dev pss
+ **/
+
+#include "async_logger.h"
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <cstdio>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#define ASYNC_LOGGER_ATFORK
+#endif
+
+using namespace std;
+
+namespace bitgraph {
+
+	namespace com {
+
+		namespace _log {
+
+			const char* to_string(int level)
+			{
+				switch (level) {
+				case DEBUG_LEVEL:	return "DEBUG";
+				case INFO_LEVEL:	return "INFO";
+				case WARNING_LEVEL:	return "WARNING";
+				default:			return "ERROR";
+				}
+			}
+
+			logRing::~logRing()
+			{
+				drain([](logRecord& r) { r.fn(nullptr, &r.payload); });
+			}
+		}
+
+		//////////////////
+		// AsyncLogger
+
+		AsyncLogger& AsyncLogger::instance()
+		{
+			//never destroyed - the logger outlives every static object that may log in its destructor
+			static AsyncLogger* pLog = new AsyncLogger();
+			return *pLog;
+		}
+
+		AsyncLogger::AsyncLogger() :
+			out_(&std::cerr),
+			baseTicks_(CycleCounter::now()),
+			baseWall_(std::chrono::system_clock::now())
+		{
+			worker_ = std::thread(&AsyncLogger::run, this);
+			std::atexit([]() { AsyncLogger::instance().shutdown(); });
+#ifdef ASYNC_LOGGER_ATFORK
+			pthread_atfork(&AsyncLogger::prepare_fork, &AsyncLogger::parent_fork, &AsyncLogger::child_fork);
+#endif
+		}
+
+		void AsyncLogger::prepare_fork()
+		{
+			//no records being formatted (localtime holds a lock of the C library)
+			AsyncLogger& alog = instance();
+			alog.drainMtx_.lock();
+			alog.mtx_.lock();
+		}
+
+		void AsyncLogger::parent_fork()
+		{
+			AsyncLogger& alog = instance();
+			alog.mtx_.unlock();
+			alog.drainMtx_.unlock();
+		}
+
+		void AsyncLogger::child_fork()
+		{
+			//no logger thread - synchronous from now on (shutdown and flush return at once)
+			AsyncLogger& alog = instance();
+			alog.rings_.clear();
+			alog.stop_.store(true);
+			alog.sync_.store(true);
+			alog.mtx_.unlock();
+			alog.drainMtx_.unlock();
+		}
+
+		AsyncLogger::ring_t& AsyncLogger::local_ring()
+		{
+			//the ring outlives its thread until the logger thread has drained it
+			struct ringHolder {
+				std::shared_ptr<ring_t> ring;
+				~ringHolder() { if (ring) { ring->closed_.store(true, std::memory_order_release); } }
+			};
+			static thread_local ringHolder h;
+
+			if (!h.ring) {
+				h.ring = std::make_shared<ring_t>(nRings_.fetch_add(1, std::memory_order_relaxed));
+				std::lock_guard<std::mutex> lock(mtx_);
+				rings_.push_back(h.ring);
+			}
+			return *h.ring;
+		}
+
+		void AsyncLogger::run()
+		{
+			CycleCounter::ticks_per_second();								//calibration, out of the callers' way
+
+			while (true) {
+				const bool isStop = stop_.load(std::memory_order_acquire);
+				const uint64_t req = flushReq_.load(std::memory_order_acquire);
+
+				drain_all();
+
+				std::unique_lock<std::mutex> lock(mtx_);
+				if (req > flushDone_) {
+					flushDone_ = req;
+					cv_.notify_all();
+				}
+				if (isStop) { break; }
+
+				//a later push either sees idle_ (and wakes this thread up) or its record is seen by has_records
+				idle_.store(true, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				cv_.wait(lock, [this]() {
+					return stop_.load(std::memory_order_relaxed) || flushReq_.load(std::memory_order_relaxed) > flushDone_ ||
+						nDropped_.load(std::memory_order_relaxed) > nDroppedReported_ || has_records();
+				});
+				idle_.store(false, std::memory_order_relaxed);
+			}
+		}
+
+		bool AsyncLogger::has_records() const
+		{
+			return std::any_of(rings_.begin(), rings_.end(), [](const std::shared_ptr<ring_t>& r) { return !r->empty(); });
+		}
+
+		std::size_t AsyncLogger::drain_all()
+		{
+			struct line_t {
+				uint64_t ticks;
+				std::string text;
+			};
+
+			std::lock_guard<std::mutex> drainLock(drainMtx_);
+			std::vector<std::shared_ptr<ring_t>> rings;
+			{
+				std::lock_guard<std::mutex> lock(mtx_);
+				rings = rings_;
+			}
+
+			std::vector<line_t> lines;
+			std::ostringstream sstr;
+			for (auto& r : rings) {
+				r->drain([&](_log::logRecord& rec) {
+					sstr.str("");
+					write_header(sstr, rec.ticks, r->id(), rec.level);
+					rec.fn(&sstr, &rec.payload);
+					lines.push_back({ rec.ticks, sstr.str() });
+				});
+			}
+
+			//records dropped since the last call
+			const uint64_t nDropped = nDropped_.load(std::memory_order_relaxed);
+			if (nDropped > nDroppedReported_) {
+				sstr.str("");
+				const uint64_t now = CycleCounter::now();
+				write_header(sstr, now, -1, _log::WARNING_LEVEL);
+				sstr << " " << nDropped - nDroppedReported_ << " records dropped (ring buffer full) - AsyncLogger";
+				lines.push_back({ now, sstr.str() });
+				nDroppedReported_ = nDropped;
+			}
+
+			std::stable_sort(lines.begin(), lines.end(), [](const line_t& a, const line_t& b) { return a.ticks < b.ticks; });
+
+			std::lock_guard<std::mutex> lock(mtx_);
+			if (!lines.empty()) {
+				for (const auto& l : lines) { *out_ << l.text << '\n'; }
+				out_->flush();
+				nWritten_.fetch_add(lines.size(), std::memory_order_relaxed);
+			}
+
+			//rings of finished threads (closed before checked empty - no more records)
+			rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<ring_t>& r) {
+				return r->closed_.load(std::memory_order_acquire) && r->empty();
+			}), rings_.end());
+
+			return lines.size();
+		}
+
+		void AsyncLogger::write_header(std::ostream& o, uint64_t ticks, int ringId, int level) const
+		{
+			using namespace std::chrono;
+
+			const double sec = static_cast<double>(static_cast<int64_t>(ticks - baseTicks_)) / CycleCounter::ticks_per_second();
+			const system_clock::time_point tp = baseWall_ + duration_cast<system_clock::duration>(duration<double>(sec));
+			const std::time_t t = system_clock::to_time_t(tp);
+			const long long usec = duration_cast<microseconds>(tp.time_since_epoch()).count() % 1000000;
+
+			char timestamp[100] = "";
+			std::strftime(timestamp, sizeof(timestamp), "[%H:%M:%S", std::localtime(&t));
+			char date[50] = "";
+			std::strftime(date, sizeof(date), "]-[%d/%b/%Y]", std::localtime(&t));
+			char frac[16] = "";
+			std::snprintf(frac, sizeof(frac), ".%06lld", usec);
+
+			o << timestamp << frac << date;
+			if (ringId >= 0) { o << "-[T" << ringId << "]"; }
+			o << " " << _log::to_string(level) << ":";
+		}
+
+		void AsyncLogger::write_sync(int level, uint64_t ticks, const std::string& msg)
+		{
+			std::lock_guard<std::mutex> lock(mtx_);
+			write_header(*out_, ticks, -1, level);
+			*out_ << msg << std::endl;
+			nWritten_.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		void AsyncLogger::flush()
+		{
+			if (sync_.load(std::memory_order_acquire)) { return; }
+
+			std::unique_lock<std::mutex> lock(mtx_);
+			const uint64_t req = flushReq_.fetch_add(1, std::memory_order_acq_rel) + 1;
+			cv_.notify_all();
+			cv_.wait(lock, [this, req]() { return flushDone_ >= req || sync_.load(std::memory_order_relaxed); });
+		}
+
+		void AsyncLogger::set_output(std::ostream& o)
+		{
+			flush();
+			std::lock_guard<std::mutex> lock(mtx_);
+			out_ = &o;
+		}
+
+		void AsyncLogger::shutdown()
+		{
+			if (sync_.exchange(true)) { return; }
+
+			//new calls are written synchronously, the logger thread writes the pending records
+			{
+				std::lock_guard<std::mutex> lock(mtx_);
+				stop_.store(true, std::memory_order_release);
+				cv_.notify_all();
+			}
+			worker_.join();
+
+			//records pushed while stopping - later pushes see sync_ and drain themselves
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			drain_all();
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
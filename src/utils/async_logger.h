@@ -0,0 +1,397 @@
+/**
+* @file async_logger.h
+* @brief interface for class AsyncLogger, an asynchronous low-overhead logging backend, with the ALOG_* macros
+* @details: each thread writes its records to its own lock-free ring buffer (single producer / single consumer).
+*			A background thread drains the rings, formats the records, orders them by timestamp and writes
+*			them to the output stream (std::cerr by default) - lines of different threads never interleave.
+* @details: formatting is deferred - a call stores its arguments by value (C strings and char arrays are copied)
+*			with a cycle counter timestamp (CycleCounter, utils/cycle_counter.h).
+*			Arguments larger than PAYLOAD_SIZE bytes are formatted by the caller.
+* @details: disabled levels are removed at compile time, with the same settings as logger.h (LOGGER_DEBUG_LEVEL,
+*			LOGGER_VERBOSE_LEVEL, LOGGER_ERROR_LEVEL, warning and error by default) - the arguments of a disabled
+*			call are not evaluated. ALOG_LEVEL (0 debug - 3 error) overrides them.
+* @details: the logger thread sleeps while the rings are empty - a producer wakes it up when its ring stops
+*			being empty (no system call while the logger thread is busy).
+* @details: when a ring is full DEBUG and INFO records are dropped (and counted), WARNING and ERROR records wait.
+*			Pending records are written at exit (std::atexit) - later calls are written synchronously
+* @details: fork (POSIX) - in the child there is no logger thread: calls are written synchronously, and the
+*			records pending at fork are left to the parent (pthread_atfork)
+* @details: with LOGGER_ASYNC defined (CMake option) the LOG_* / LOGG_* macros of logger.h use this backend
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __ASYNC_LOGGER_H__
+#define __ASYNC_LOGGER_H__
+
+#include "utils/logger.h"
+#include "utils/cycle_counter.h"
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <memory>
+#include <vector>
+#include <tuple>
+#include <string>
+#include <sstream>
+#include <iostream>
+#include <chrono>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <new>
+
+namespace bitgraph {
+
+	namespace com {
+
+		namespace _log {
+
+			enum level_t { DEBUG_LEVEL = 0, INFO_LEVEL, WARNING_LEVEL, ERROR_LEVEL };
+
+			const char* to_string(int level);
+
+			/*
+			* @brief type in which an argument of type T is stored until it is formatted:
+			*		 C strings and char arrays as std::string - a const char array is not necessarily a
+			*		 string literal (e.g. a local buffer), so it is never stored as a pointer
+			*/
+			template<class T>
+			struct stored_arg {
+				using decay_t = typename std::decay<T>::type;
+				static const bool is_cstr = std::is_same<decay_t, const char*>::value || std::is_same<decay_t, char*>::value;
+				using type = typename std::conditional<is_cstr, std::string, decay_t>::type;
+			};
+
+			template<std::size_t I, std::size_t N>
+			struct print_tuple {
+				template<class Tup>
+				static void print(std::ostream& o, const Tup& t) {
+					o << " " << tag_expand(std::get<I>(t));
+					print_tuple<I + 1, N>::print(o, t);
+				}
+			};
+
+			template<std::size_t N>
+			struct print_tuple<N, N> {
+				template<class Tup>
+				static void print(std::ostream&, const Tup&) {}
+			};
+
+			//////////////////////////
+			//
+			// struct logRecord
+			// (a log call with its arguments not yet formatted)
+			//
+			//////////////////////////
+
+			struct logRecord {
+				enum { PAYLOAD_SIZE = 192 };
+				using format_fn = void(*)(std::ostream*, void*);				//formats (if the stream is not null) and destroys the payload
+
+				uint64_t ticks;
+				int level;
+				format_fn fn;
+				typename std::aligned_storage<PAYLOAD_SIZE, alignof(std::max_align_t)>::type payload;
+
+				template<class Tup>
+				static void format_payload(std::ostream* o, void* p) {
+					Tup* t = static_cast<Tup*>(p);
+					if (o) { print_tuple<0, std::tuple_size<Tup>::value>::print(*o, *t); }
+					t->~Tup();
+				}
+			};
+
+			template<class Tup>
+			struct fits_record : std::integral_constant<bool,
+				sizeof(Tup) <= logRecord::PAYLOAD_SIZE && alignof(Tup) <= alignof(std::max_align_t)> {};
+
+			///////////////////
+			//
+			// logRing class
+			//
+			// Lock-free ring buffer of records - one producer (the owner thread), one consumer (the logger thread)
+			//
+			////////////////////
+
+			class logRing {
+			public:
+				enum { CAPACITY = 1024 };										//power of 2
+
+				explicit logRing(int id) : id_(id), slots_(new logRecord[CAPACITY]) {}
+				~logRing();
+
+				int id()										const { return id_; }
+				bool empty()									const { return tail_.load(std::memory_order_acquire) == head_.load(std::memory_order_acquire); }
+
+				/*
+				* @brief stores a record with payload Tup constructed from @args (producer only)
+				* @returns false if the ring is full
+				*/
+				template<class Tup, class... Args>
+				bool push(int level, uint64_t ticks, Args&&... args) {
+					const uint64_t h = head_.load(std::memory_order_relaxed);
+					if (h - tail_.load(std::memory_order_acquire) == CAPACITY) { return false; }
+
+					logRecord& r = slots_[h & (CAPACITY - 1)];
+					r.ticks = ticks;
+					r.level = level;
+					r.fn = &logRecord::format_payload<Tup>;
+					::new (static_cast<void*>(&r.payload)) Tup(std::forward<Args>(args)...);
+
+					head_.store(h + 1, std::memory_order_release);
+					return true;
+				}
+
+				/*
+				* @brief calls @f(record) for every record in the ring and releases them (consumer only)
+				*		 - @f must call record.fn to destroy the payload
+				* @returns number of records
+				*/
+				template<class Func>
+				std::size_t drain(Func f) {
+					const uint64_t t0 = tail_.load(std::memory_order_relaxed);
+					const uint64_t h = head_.load(std::memory_order_acquire);
+					for (uint64_t t = t0; t != h; ++t) {
+						f(slots_[t & (CAPACITY - 1)]);
+						tail_.store(t + 1, std::memory_order_release);
+					}
+					return static_cast<std::size_t>(h - t0);
+				}
+
+				std::atomic<bool> closed_{ false };								//the owner thread has finished
+
+			private:
+				int id_;
+				std::unique_ptr<logRecord[]> slots_;
+				char pad0_[64];
+				std::atomic<uint64_t> head_{ 0 };								//written by the producer
+				char pad1_[64];
+				std::atomic<uint64_t> tail_{ 0 };								//written by the consumer
+				char pad2_[64];
+			};
+
+		}//end namespace _log
+
+		///////////////////
+		//
+		// AsyncLogger class
+		//
+		// Global asynchronous logger (created on first use, never destroyed)
+		//
+		////////////////////
+
+		class AsyncLogger {
+		public:
+			using ring_t = _log::logRing;
+
+			static AsyncLogger& instance();
+
+			//copy and move semantics disallowed
+			AsyncLogger(const AsyncLogger&) = delete;
+			AsyncLogger& operator =			(const AsyncLogger&) = delete;
+
+			/////////////////
+			//setters and getters
+
+			/*
+			* @brief writes pending records and sets the output stream
+			*/
+			void set_output(std::ostream& o);
+
+			uint64_t number_of_dropped()					const { return nDropped_.load(std::memory_order_relaxed); }
+			uint64_t number_of_written()					const { return nWritten_.load(std::memory_order_relaxed); }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief logs @args (streamed with tag_expand, space separated) at @level
+			*/
+			template<class... Args>
+			void log(int level, Args&&... args);
+
+			/*
+			* @brief waits until all records of the calling thread (and older records of other threads) are written
+			*/
+			void flush();
+
+			/*
+			* @brief writes pending records and stops the logger thread - later calls are written synchronously
+			*		 (registered with std::atexit)
+			*/
+			void shutdown();
+
+		private:
+			AsyncLogger();
+
+			ring_t& local_ring();
+			void run();
+
+			/*
+			* @brief writes all records in the rings ordered by timestamp (logger thread, or any thread
+			*		 after shutdown)
+			* @returns number of records written
+			*/
+			std::size_t drain_all();
+
+			/*
+			* @brief header of a line: timestamp, thread and level
+			*/
+			void write_header(std::ostream& o, uint64_t ticks, int ringId, int level)		const;
+
+			/*
+			* @brief true if some ring has records (mtx_ must be held)
+			*/
+			bool has_records()																const;
+
+			template<class Tup, class... Args>
+			void push(ring_t& r, int level, uint64_t ticks, std::true_type, Args&&... args);
+			template<class Tup, class... Args>
+			void push(ring_t& r, int level, uint64_t ticks, std::false_type, Args&&... args);
+
+			void write_sync(int level, uint64_t ticks, const std::string& msg);
+
+			/*
+			* @brief pthread_atfork handlers - the output is not in use across fork
+			*/
+			static void prepare_fork();
+			static void parent_fork();
+			static void child_fork();
+
+			////////////////
+			// data members
+
+			std::mutex mtx_;												//rings_, output
+			std::mutex drainMtx_;											//drain_all (held across fork)
+			std::condition_variable cv_;
+			std::vector<std::shared_ptr<ring_t>> rings_;
+			std::ostream* out_;
+			std::thread worker_;
+			std::atomic<bool> stop_{ false };
+			std::atomic<bool> sync_{ false };								//after shutdown
+			std::atomic<bool> idle_{ false };								//the logger thread sleeps (rings empty)
+			std::atomic<int> nRings_{ 0 };
+			std::atomic<uint64_t> flushReq_{ 0 };
+			uint64_t flushDone_ = 0;										//guarded by mtx_
+			std::atomic<uint64_t> nDropped_{ 0 };
+			std::atomic<uint64_t> nWritten_{ 0 };
+			uint64_t nDroppedReported_ = 0;								//logger thread only
+
+			uint64_t baseTicks_;											//timestamps: wall time at baseTicks_
+			std::chrono::system_clock::time_point baseWall_;
+		};
+
+	}//end namespace com
+
+	using com::AsyncLogger;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	namespace com {
+
+		template<class... Args>
+		inline
+			void AsyncLogger::log(int level, Args&&... args)
+		{
+			using tuple_t = std::tuple<typename _log::stored_arg<Args>::type...>;
+			const uint64_t ticks = CycleCounter::now();
+
+			if (sync_.load(std::memory_order_relaxed)) {
+				std::ostringstream sstr;
+				_log::print_tuple<0, sizeof...(Args)>::print(sstr, tuple_t(std::forward<Args>(args)...));
+				write_sync(level, ticks, sstr.str());
+				return;
+			}
+
+			push<tuple_t>(local_ring(), level, ticks,
+				std::integral_constant<bool, _log::fits_record<tuple_t>::value>(), std::forward<Args>(args)...);
+		}
+
+		template<class Tup, class... Args>
+		inline
+			void AsyncLogger::push(ring_t& r, int level, uint64_t ticks, std::true_type, Args&&... args)
+		{
+			while (!r.push<Tup>(level, ticks, std::forward<Args>(args)...)) {
+				if (level < _log::WARNING_LEVEL) {
+					nDropped_.fetch_add(1, std::memory_order_relaxed);
+					return;
+				}
+
+				//shut down after the call checked sync_ - no logger thread to make room
+				if (sync_.load(std::memory_order_acquire)) { drain_all(); }
+				else { std::this_thread::yield(); }
+			}
+
+			//the record may have been pushed after the last drain of shutdown - written by the caller
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (sync_.load(std::memory_order_relaxed)) { drain_all(); }
+			else if (idle_.load(std::memory_order_relaxed) && idle_.exchange(false)) {
+				//the logger thread only sleeps with every ring empty - the first record wakes it up
+				std::lock_guard<std::mutex> lock(mtx_);
+				cv_.notify_all();
+			}
+		}
+
+		template<class Tup, class... Args>
+		inline
+			void AsyncLogger::push(ring_t& r, int level, uint64_t ticks, std::false_type, Args&&... args)
+		{
+			//too large for a record - formatted now
+			std::ostringstream sstr;
+			_log::print_tuple<0, sizeof...(Args)>::print(sstr, Tup(std::forward<Args>(args)...));
+			std::string msg = sstr.str();
+			msg.erase(0, 1);													//leading space, added again when the record is formatted
+			push<std::tuple<std::string>>(r, level, ticks, std::true_type(), std::move(msg));
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// ALOG_* macros - disabled levels compile to nothing (arguments are not evaluated)
+
+#ifndef ALOG_LEVEL
+#if defined(DEBUG) || defined(LOGGER_DEBUG_LEVEL)
+#define ALOG_LEVEL 0
+#elif defined(VERBOSE) || defined(LOGGER_VERBOSE_LEVEL)
+#define ALOG_LEVEL 1
+#elif defined(ERROR) || defined(LOGGER_ERROR_LEVEL)
+#define ALOG_LEVEL 3
+#else
+#define ALOG_LEVEL 2
+#endif
+#endif
+
+#define ALOG_CALL(level, ...)	::bitgraph::AsyncLogger::instance().log(level, __VA_ARGS__)
+
+#if ALOG_LEVEL <= 0
+#define ALOG_DEBUG(...)			ALOG_CALL(::bitgraph::com::_log::DEBUG_LEVEL, __VA_ARGS__)
+#else
+#define ALOG_DEBUG(...)			((void)0)
+#endif
+
+#if ALOG_LEVEL <= 1
+#define ALOG_INFO(...)			ALOG_CALL(::bitgraph::com::_log::INFO_LEVEL, __VA_ARGS__)
+#else
+#define ALOG_INFO(...)			((void)0)
+#endif
+
+#if ALOG_LEVEL <= 2
+#define ALOG_WARNING(...)		ALOG_CALL(::bitgraph::com::_log::WARNING_LEVEL, __VA_ARGS__)
+#else
+#define ALOG_WARNING(...)		((void)0)
+#endif
+
+#define ALOG_ERROR(...)			ALOG_CALL(::bitgraph::com::_log::ERROR_LEVEL, __VA_ARGS__)
+
+#define ALOG_FLUSH()			::bitgraph::AsyncLogger::instance().flush()
+
+#endif
@@ -2,16 +2,197 @@
 * @file batch.h
 * @brief A templatized batch class to run tests of type Alg_t (or derived) with Params Param_t
 *		 (Factory of tests)
-* 
+*
 *		I. Alg_t must have a constructor for Param_t
-* 		II. AlgVar_t should derive from Alg_t (base of the hierarchy of algorithms)	
+* 		II. AlgVar_t should derive from Alg_t (base of the hierarchy of algorithms)
+*
+* @details: tests may also be run concurrently (run_all_tests_parallel) by a number of worker threads,
+*			optionally pinned to consecutive CPUs. In isolation mode each test runs in a forked process
+*			(POSIX only), so that a crash, a time-out (the process is killed) or a memory limit does not
+*			abort the batch. Otherwise time-outs are only reported, since threads cannot be stopped.
+* @details: isolation forks a multithreaded process - the child has only the forking thread. The global ThreadPool
+*			and the AsyncLogger handle fork (pthread_atfork), other threads and locks of the parent must not be
+*			relied upon by a forked test (see paramBatch::isolate)
+* @details: the outcome of each test (status, wall and CPU time, peak memory) is stored in an infoTest report,
+*			aggregated in an infoBatch report - in isolation mode the test objects are not modified.
+* @details: last_update 17/10/2026
 **/
 
 #ifndef __BATCH_H__
 #define __BATCH_H__
 
+#include "utils/info/info_base.h"
+#include "utils/logger.h"
 #include <vector>
 #include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <exception>
+#include <algorithm>
+#include <iostream>
+#include <cstdio>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <time.h>
+#define BATCH_POSIX
+#endif
+
+namespace bitgraph {
+
+	namespace com {
+
+		//////////////////////////
+		//
+		// struct paramBatch
+		// (configuration of a parallel batch - nThreads is the number of workers,
+		//  TIME_OUT the time limit of each test)
+		//
+		//////////////////////////
+
+		struct paramBatch : public paramBase {
+
+			/*
+			* each test in a forked process (POSIX). The batch workers are threads, so the child of a fork has
+			* only the thread of its test: the global ThreadPool (no workers in the child, tasks are run by the
+			* waiting thread) and the AsyncLogger (synchronous in the child) are safe to use, other threads,
+			* thread pools and locks of the parent are not
+			*/
+			bool isolate = false;
+			bool pin = false;												//worker w pinned to CPU firstCpu + w
+			int firstCpu = 0;
+			std::size_t MEM_LIMIT = 0;										//address space of a forked test in bytes (0 - no limit)
+
+			void reset() override {
+				paramBase::reset();
+				isolate = false;
+				pin = false;
+				firstCpu = 0;
+				MEM_LIMIT = 0;
+			}
+
+			std::ostream& print(std::ostream& o = std::cout, bool endl = true) const override {
+				paramBase::print(o, false);
+				o << "\nISOLATE: " << std::boolalpha << isolate
+					<< "\nPIN: " << pin << " (first CPU " << firstCpu << ")"
+					<< "\nMEM_LIMIT(bytes): " << MEM_LIMIT;
+				if (endl) o << std::endl;
+				return o;
+			}
+		};
+
+		//////////////////////
+		//
+		//	infoTest
+		//
+		//  @brief report of a test of a batch - timeSearch_ is the wall time of the test
+		//
+		///////////////////////
+
+		struct infoTest : public infoBase {
+
+			enum status_t { NOT_RUN = 0, OK, TIME_OUT, CRASHED, FAILED };			//FAILED - exception or non-zero exit code
+
+			int id_ = -1;													//index of the test in the batch
+			status_t status_ = NOT_RUN;
+			int worker_ = -1;
+			int cpu_ = -1;													//CPU of the worker if pinned, -1 otherwise
+			int signal_ = 0;												//signal which killed a forked test
+			int exitCode_ = 0;												//exit code of a forked test
+			double cpuTime_ = 0;											//CPU time (in seconds)
+			long maxRSS_ = 0;												//peak resident memory of a forked test (in KB)
+
+			static const char* to_string(status_t s) {
+				switch (s) {
+				case OK:		return "OK";
+				case TIME_OUT:	return "TIME_OUT";
+				case CRASHED:	return "CRASHED";
+				case FAILED:	return "FAILED";
+				default:		return "NOT_RUN";
+				}
+			}
+
+			void clear(bool lazy = false) override {
+				infoBase::clear(lazy);
+				status_ = NOT_RUN;
+				worker_ = -1;
+				cpu_ = -1;
+				signal_ = 0;
+				exitCode_ = 0;
+				cpuTime_ = 0;
+				maxRSS_ = 0;
+			}
+
+			std::ostream& printReport(std::ostream& o = std::cout, bool is_endl = true) const override {
+				o << id_ << "\t" << to_string(status_) << "\t" << worker_ << "\t" << cpu_ << "\t"
+					<< timeSearch_ << "\t" << cpuTime_ << "\t" << maxRSS_ << "\t" << signal_ << "\t" << exitCode_;
+				if (is_endl) { o << std::endl; }
+				return o;
+			}
+		};
+
+		//////////////////////
+		//
+		//	infoBatch
+		//
+		//  @brief aggregated report of a batch - timeSearch_ is the wall time of the batch,
+		//		   data_.nThreads the number of workers and data_.TIME_OUT the time limit of each test
+		//
+		///////////////////////
+
+		struct infoBatch : public infoBase {
+
+			std::vector<infoTest> tests_;
+
+			int number_of_tests()								const { return static_cast<int>(tests_.size()); }
+
+			int number_of(infoTest::status_t s) const {
+				return static_cast<int>(std::count_if(tests_.begin(), tests_.end(),
+					[s](const infoTest& t) { return t.status_ == s; }));
+			}
+
+			/*
+			* @brief sum of the wall times of the tests - divided by the batch time it is the speedup of the workers
+			*/
+			double total_test_time() const {
+				double tot = 0;
+				for (const auto& t : tests_) { tot += t.timeSearch_; }
+				return tot;
+			}
+
+			void clear(bool lazy = false) override {
+				infoBase::clear(lazy);
+				tests_.clear();
+			}
+
+			std::ostream& printReport(std::ostream& o = std::cout, bool is_endl = true) const override {
+				o << "*****************************\n";
+				o << "TESTS:" << number_of_tests() << "\t WORKERS:" << data_.nThreads << "\t TIME_OUT(s):" << data_.TIME_OUT << "\n";
+				o << "OK:" << number_of(infoTest::OK) << "\t TIME_OUT:" << number_of(infoTest::TIME_OUT)
+					<< "\t CRASHED:" << number_of(infoTest::CRASHED) << "\t FAILED:" << number_of(infoTest::FAILED) << "\n";
+				o << "time_batch:" << timeSearch_ << "\t time_tests:" << total_test_time() << "\n";
+				o << "*****************************\n";
+				o << "id\tstatus\tworker\tcpu\twall(s)\tcpu(s)\trss(KB)\tsignal\texit\n";
+				for (const auto& t : tests_) { t.printReport(o, true); }
+				if (is_endl) { o << std::endl; }
+				return o;
+			}
+		};
+
+	}//end namespace com
+
+	using com::paramBatch;
+	using com::infoTest;
+	using com::infoBatch;
+
+}//end namespace bitgraph
 
 template <class Alg_t, class Param_t>
 class Batch{
@@ -24,6 +205,11 @@ public:
 	int number_of_tests				()			{ return tests.size(); }
 std::unique_ptr<Alg_t>& get_test	(int id)	{ return tests[id]; }
 
+	/**
+	* @brief report of the last parallel run
+	**/
+	const bitgraph::infoBatch& info	()	const	{ return info_; }
+
 /////////////////////////
 //basic operations
 
@@ -39,8 +225,8 @@ std::unique_ptr<Alg_t>& get_test	(int id)	{ return tests[id]; }
 	/**
 	* @brief clears all tests - deallocates memory
 	**/
-	void clear(){ tests.clear(); }
-	
+	void clear(){ tests.clear(); info_.clear(); }
+
 	/**
 	* @brief runs all tests
 	**/
@@ -51,16 +237,253 @@ std::unique_ptr<Alg_t>& get_test	(int id)	{ return tests[id]; }
 			//pTest->tear_down();
 		}
 	}
-	
+
+	/**
+	* @brief runs all tests concurrently by p.nThreads workers (hardware threads if <= 0), which take
+	*		 the tests in order. The outcome of each test is reported in info()
+	* @param p: workers, time limit of each test (TIME_OUT), isolation, CPU pinning and memory limit
+	* @returns number of tests with status OK
+	**/
+	int run_all_tests_parallel(const bitgraph::paramBatch& p);
+
+/////////
+//internals
+protected:
+
+	/**
+	* @brief runs test @id in the calling thread - a time-out is only reported
+	**/
+	void run_inline(int id, const bitgraph::paramBatch& p, bitgraph::infoTest& res);
+
+	/**
+	* @brief runs test @id in a forked process, killed on time-out
+	**/
+	void run_forked(int id, const bitgraph::paramBatch& p, bitgraph::infoTest& res);
+
+	/**
+	* @brief pins the calling thread to @cpu
+	* @returns 0 if success, -1 otherwise
+	**/
+	static int pin_thread(int cpu);
+
 /////////
 //data members
 protected:
 	std::vector < std::unique_ptr<Alg_t> > tests;
+	bitgraph::infoBatch info_;
 };
 
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+template <class Alg_t, class Param_t>
+inline
+int Batch<Alg_t, Param_t>::pin_thread(int cpu)
+{
+#ifdef BATCH_POSIX
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET(cpu, &set);
+	return (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0) ? 0 : -1;
+#else
+	return -1;
+#endif
+}
+
+template <class Alg_t, class Param_t>
+inline
+int Batch<Alg_t, Param_t>::run_all_tests_parallel(const bitgraph::paramBatch& p)
+{
+	using bitgraph::infoTest;
+	using bitgraph::infoBase;
+
+	const int nTests = static_cast<int>(tests.size());
+	int nWorkers = p.nThreads;
+	if (nWorkers <= 0) { nWorkers = static_cast<int>(std::thread::hardware_concurrency()); }
+	nWorkers = std::max(1, std::min(nWorkers, nTests));
+
+	bool isolate = p.isolate;
+#ifndef BATCH_POSIX
+	if (isolate || p.pin) {
+		LOG_WARNING("isolation and CPU pinning require POSIX - tests run in threads - Batch::run_all_tests_parallel");
+		isolate = false;
+	}
+#endif
+
+	info_.clear();
+	info_.data_ = p;
+	info_.number_of_threads(nWorkers);
+	info_.tests_.resize(nTests);
+	info_.startTimer(infoBase::phase_t::SEARCH);
+
+	const int nCpu = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+	std::atomic<int> next(0);
+
+	//workers are dedicated threads - tests are long-running, and each worker keeps its CPU
+	auto worker = [&](int w) {
+		int cpu = -1;
+		if (p.pin) {
+			cpu = (p.firstCpu + w) % nCpu;
+			if (pin_thread(cpu) == -1) {
+				LOGG_WARNING("worker ", w, " could not be pinned to CPU ", cpu, " - Batch::run_all_tests_parallel");
+				cpu = -1;
+			}
+		}
+
+		int id;
+		while ((id = next.fetch_add(1)) < nTests) {
+			infoTest& res = info_.tests_[id];
+			res.id_ = id;
+			res.worker_ = w;
+			res.cpu_ = cpu;
+			res.data_.TIME_OUT = p.TIME_OUT;
+			if (isolate) { run_forked(id, p, res); }
+			else { run_inline(id, p, res); }
+		}
+	};
+
+	std::vector<std::thread> pool;
+	pool.reserve(nWorkers - 1);
+	for (auto w = 1; w < nWorkers; ++w) {
+		pool.emplace_back(worker, w);
+	}
+	worker(0);
+	for (auto& th : pool) { th.join(); }
+
+	info_.readTimer(infoBase::phase_t::SEARCH);
+	return info_.number_of(infoTest::OK);
+}
+
+template <class Alg_t, class Param_t>
+inline
+void Batch<Alg_t, Param_t>::run_inline(int id, const bitgraph::paramBatch& p, bitgraph::infoTest& res)
+{
+	using bitgraph::infoTest;
+
+#ifdef BATCH_POSIX
+	timespec cpu0, cpu1;
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu0);
+#endif
+	res.startTimer(bitgraph::infoBase::phase_t::SEARCH);
+
+	res.status_ = infoTest::OK;
+	try {
+		tests[id]->start();
+	}
+	catch (std::exception& e) {
+		LOGG_ERROR("test ", id, " threw an exception: ", e.what(), " - Batch::run_inline");
+		res.status_ = infoTest::FAILED;
+	}
+	catch (...) {
+		LOGG_ERROR("test ", id, " threw an unknown exception - Batch::run_inline");
+		res.status_ = infoTest::FAILED;
+	}
+
+	res.readTimer(bitgraph::infoBase::phase_t::SEARCH);
+#ifdef BATCH_POSIX
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu1);
+	res.cpuTime_ = (cpu1.tv_sec - cpu0.tv_sec) + (cpu1.tv_nsec - cpu0.tv_nsec) * 1e-9;
 #endif
 
+	//threads cannot be stopped - the time-out is only reported
+	if (res.status_ == infoTest::OK && res.timeSearch_ > p.TIME_OUT) {
+		res.status_ = infoTest::TIME_OUT;
+	}
+}
+
+template <class Alg_t, class Param_t>
+inline
+void Batch<Alg_t, Param_t>::run_forked(int id, const bitgraph::paramBatch& p, bitgraph::infoTest& res)
+{
+#ifdef BATCH_POSIX
+	using bitgraph::infoTest;
+	enum { EXIT_EXCEPTION = 2 };
+
+	//buffered output is not duplicated in the child
+	static std::mutex mtxFork;
+	pid_t pid;
+	{
+		std::lock_guard<std::mutex> lck(mtxFork);
+		std::cout.flush();
+		std::cerr.flush();
+		std::fflush(nullptr);
+		pid = fork();
+	}
+
+	if (pid == -1) {
+		LOGG_ERROR("fork failed for test ", id, " - Batch::run_forked");
+		res.status_ = infoTest::FAILED;
+		return;
+	}
+
+	//////////////////
+	// child
+	if (pid == 0) {
+		if (p.MEM_LIMIT > 0) {
+			rlimit rl;
+			rl.rlim_cur = rl.rlim_max = static_cast<rlim_t>(p.MEM_LIMIT);
+			setrlimit(RLIMIT_AS, &rl);
+		}
+		int code = 0;
+		try {
+			tests[id]->start();
+		}
+		catch (...) {
+			code = EXIT_EXCEPTION;
+		}
+		std::cout.flush();
+		std::fflush(nullptr);
+		_exit(code);
+	}
+
+	//////////////////
+	// parent - polls the child, with increasing sleeps up to 5ms, and kills it on time-out
+	res.startTimer(bitgraph::infoBase::phase_t::SEARCH);
+	auto start = std::chrono::steady_clock::now();
+	bool killed = false;
+	int st = 0;
+	rusage ru;
+	int sleep_us = 50;
+	while (true) {
+		pid_t r = wait4(pid, &st, WNOHANG, &ru);
+		if (r == pid) { break; }
+		if (r == -1) {
+			LOGG_ERROR("wait4 failed for test ", id, " - Batch::run_forked");
+			res.status_ = infoTest::FAILED;
+			return;
+		}
 
+		const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		if (!killed && elapsed > p.TIME_OUT) {
+			kill(pid, SIGKILL);
+			killed = true;
+		}
+		std::this_thread::sleep_for(std::chrono::microseconds(sleep_us));
+		sleep_us = std::min(2 * sleep_us, 5000);
+	}
+	res.readTimer(bitgraph::infoBase::phase_t::SEARCH);
 
+	res.cpuTime_ = ru.ru_utime.tv_sec + ru.ru_stime.tv_sec + (ru.ru_utime.tv_usec + ru.ru_stime.tv_usec) * 1e-6;
+	res.maxRSS_ = ru.ru_maxrss;
 
+	if (killed) {
+		res.status_ = infoTest::TIME_OUT;
+		res.signal_ = SIGKILL;
+	}
+	else if (WIFSIGNALED(st)) {
+		res.status_ = infoTest::CRASHED;
+		res.signal_ = WTERMSIG(st);
+	}
+	else if (WIFEXITED(st) && WEXITSTATUS(st) != 0) {
+		res.status_ = infoTest::FAILED;
+		res.exitCode_ = WEXITSTATUS(st);
+	}
+	else {
+		res.status_ = infoTest::OK;
+	}
+#else
+	run_inline(id, p, res);
+#endif
+}
 
+#endif
@@ -0,0 +1,337 @@
+/**
+ * @file bench_harness.cpp
+ * @brief implementation of class BenchHarness in bench_harness.h
+ * @details: created 17/10/2026, last_update 17/10/2026
+ * @dev pss
+ **/
+
+#include "bench_harness.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <sstream>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+
+using namespace std;
+
+namespace bitgraph {
+
+	namespace com {
+
+		constexpr double BenchHarness::DEFAULT_TOLERANCE;
+
+		//////////////////
+		// stats_t
+
+		double stats_t::percentile(const vector<double>& samples, double p)
+		{
+			if (samples.empty()) { return 0; }
+			const double pos = (p / 100.0) * (samples.size() - 1);
+			const size_t i = static_cast<size_t>(pos);
+			if (i + 1 >= samples.size()) { return samples.back(); }
+			return samples[i] + (pos - i) * (samples[i + 1] - samples[i]);
+		}
+
+		stats_t stats_t::compute(vector<double> samples)
+		{
+			stats_t s;
+			if (samples.empty()) { return s; }
+
+			s.n = static_cast<int>(samples.size());
+			s.mean = for_each(samples.begin(), samples.end(), _mat::MeanValue());
+			s.stddev = for_each(samples.begin(), samples.end(), _mat::StdDevValue(s.mean));
+
+			sort(samples.begin(), samples.end());
+			s.min = samples.front();
+			s.max = samples.back();
+			s.median = percentile(samples, 50);
+			s.p90 = percentile(samples, 90);
+			s.p95 = percentile(samples, 95);
+			s.p99 = percentile(samples, 99);
+			return s;
+		}
+
+		//////////////////
+		// regression_t
+
+		const char* regression_t::to_string(flag_t f)
+		{
+			switch (f) {
+			case SAME:		return "SAME";
+			case IMPROVED:	return "IMPROVED";
+			case REGRESSED:	return "REGRESSED";
+			default:		return "NEW";
+			}
+		}
+
+		//////////////////
+		// BenchHarness
+
+		bool BenchHarness::perf_counters(bool enable)
+		{
+			if (!enable) {
+				perf_.reset();
+				return false;
+			}
+			if (!perf_) { perf_ = std::make_shared<PerfCounters>(); }
+			return perf_counters();
+		}
+
+		int BenchHarness::number_of_incorrect() const
+		{
+			return static_cast<int>(count_if(rec_.begin(), rec_.end(), [](const benchRecord& r) { return !r.correct; }));
+		}
+
+		vector<regression_t> BenchHarness::compare(const vector<benchRecord>& baseline) const
+		{
+			vector<regression_t> cmp;
+			for (const auto& r : rec_) {
+				regression_t c;
+				c.instance = r.instance;
+				c.alg = r.alg;
+				c.curr = r.wall.median;
+
+				auto it = find_if(baseline.begin(), baseline.end(), [&r](const benchRecord& b) {
+					return b.instance == r.instance && b.alg == r.alg;
+				});
+				if (it != baseline.end()) {
+					c.base = it->wall.median;
+					c.ratio = (c.base > 0) ? c.curr / c.base : 1.0;
+
+					//differences below the noise of either run are not flagged
+					const double noise = 2 * max(r.wall.stddev, it->wall.stddev);
+					const double diff = c.curr - c.base;
+					if (diff > tol_ * c.base && diff > noise) { c.flag = regression_t::REGRESSED; }
+					else if (-diff > tol_ * c.base && -diff > noise) { c.flag = regression_t::IMPROVED; }
+					else { c.flag = regression_t::SAME; }
+				}
+				cmp.push_back(c);
+			}
+			return cmp;
+		}
+
+		int BenchHarness::number_of_regressions(const vector<regression_t>& cmp)
+		{
+			return static_cast<int>(count_if(cmp.begin(), cmp.end(), [](const regression_t& c) {
+				return c.flag == regression_t::REGRESSED;
+			}));
+		}
+
+		//////////////////
+		// I/O
+
+		namespace {
+
+			const char* STAT_NAMES[] = { "n", "mean", "stddev", "min", "max", "median", "p90", "p95", "p99" };
+			const int NUM_STATS = 9;
+			const char* METRIC_NAMES[] = { "wall", "cpu", "cycles" };
+
+			void stat_values(const stats_t& s, double v[]) {
+				v[0] = s.n; v[1] = s.mean; v[2] = s.stddev; v[3] = s.min; v[4] = s.max;
+				v[5] = s.median; v[6] = s.p90; v[7] = s.p95; v[8] = s.p99;
+			}
+
+			void set_stat_values(stats_t& s, const double v[]) {
+				s.n = static_cast<int>(v[0]); s.mean = v[1]; s.stddev = v[2]; s.min = v[3]; s.max = v[4];
+				s.median = v[5]; s.p90 = v[6]; s.p95 = v[7]; s.p99 = v[8];
+			}
+
+			//hardware counters are stored as -1 if not measured
+			void perf_values(const perfSample& p, double v[]) {
+				for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) { v[e] = p.valid[e] ? p.value[e] : -1; }
+			}
+
+			void set_perf_values(perfSample& p, const double v[]) {
+				for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+					p.valid[e] = (v[e] >= 0);
+					p.value[e] = p.valid[e] ? v[e] : 0;
+				}
+			}
+
+			string quote(const string& str, char q = '"') {
+				string res(1, q);
+				for (auto c : str) {
+					if (c == q || c == '\\') { res += '\\'; }
+					res += c;
+				}
+				return res + q;
+			}
+
+			//JSON string - control characters are escaped as \uXXXX
+			string json_string(const string& str) {
+				string res(1, '"');
+				char buf[8];
+				for (auto c : str) {
+					if (c == '"' || c == '\\') { res += '\\'; res += c; }
+					else if (static_cast<unsigned char>(c) < 0x20) {
+						snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+						res += buf;
+					}
+					else { res += c; }
+				}
+				return res + '"';
+			}
+
+			//JSON has no NaN or infinity - written as null
+			struct json_number {
+				double v;
+				friend ostream& operator<<(ostream& o, const json_number& n) {
+					return std::isfinite(n.v) ? (o << n.v) : (o << "null");
+				}
+			};
+
+			//splits a CSV line - fields may be quoted (with escaped quotes)
+			vector<string> split_csv(const string& line) {
+				vector<string> fields;
+				string cur;
+				bool inQuotes = false;
+				for (size_t i = 0; i < line.size(); ++i) {
+					const char c = line[i];
+					if (inQuotes) {
+						if (c == '\\' && i + 1 < line.size()) { cur += line[++i]; }
+						else if (c == '"') { inQuotes = false; }
+						else { cur += c; }
+					}
+					else if (c == '"') { inQuotes = true; }
+					else if (c == ',') { fields.push_back(cur); cur.clear(); }
+					else if (c != '\r') { cur += c; }
+				}
+				fields.push_back(cur);
+				return fields;
+			}
+		}
+
+		std::ostream& BenchHarness::write_csv(std::ostream& o) const
+		{
+			o << "instance,alg,value,expected,correct";
+			for (auto m : METRIC_NAMES) {
+				for (auto s : STAT_NAMES) { o << "," << m << "_" << s; }
+			}
+			for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+				o << ",perf_" << perfSample::to_string(static_cast<perfSample::event_t>(e));
+			}
+			o << "\n";
+
+			o.precision(9);
+			double v[NUM_STATS];
+			double pv[perfSample::NUM_EVENTS];
+			for (const auto& r : rec_) {
+				o << quote(r.instance) << "," << quote(r.alg) << "," << r.value << "," << r.expected << "," << r.correct;
+				for (const stats_t* s : { &r.wall, &r.cpu, &r.cycles }) {
+					stat_values(*s, v);
+					for (auto i = 0; i < NUM_STATS; ++i) { o << "," << v[i]; }
+				}
+				perf_values(r.perf, pv);
+				for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) { o << "," << pv[e]; }
+				o << "\n";
+			}
+			return o;
+		}
+
+		std::ostream& BenchHarness::write_json(std::ostream& o) const
+		{
+			o.precision(9);
+			double v[NUM_STATS];
+			o << "[";
+			for (size_t k = 0; k < rec_.size(); ++k) {
+				const benchRecord& r = rec_[k];
+				o << (k ? ",\n" : "\n") << "  {\"instance\": " << json_string(r.instance) << ", \"alg\": " << json_string(r.alg)
+					<< ", \"value\": " << r.value << ", \"expected\": " << r.expected
+					<< ", \"correct\": " << (r.correct ? "true" : "false");
+				int m = 0;
+				for (const stats_t* s : { &r.wall, &r.cpu, &r.cycles }) {
+					stat_values(*s, v);
+					o << ", \"" << METRIC_NAMES[m++] << "\": {";
+					for (auto i = 0; i < NUM_STATS; ++i) {
+						o << (i ? ", " : "") << "\"" << STAT_NAMES[i] << "\": " << json_number{ v[i] };
+					}
+					o << "}";
+				}
+				if (!r.perf.empty()) {
+					o << ", \"perf\": {\"ipc\": " << json_number{ r.perf.ipc() }
+						<< ", \"cache_miss_rate\": " << json_number{ r.perf.cache_miss_rate() }
+						<< ", \"branch_miss_rate\": " << json_number{ r.perf.branch_miss_rate() };
+					for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+						if (r.perf.valid[e]) {
+							o << ", \"" << perfSample::to_string(static_cast<perfSample::event_t>(e)) << "\": " << json_number{ r.perf.value[e] };
+						}
+					}
+					o << "}";
+				}
+				o << "}";
+			}
+			o << "\n]\n";
+			return o;
+		}
+
+		int BenchHarness::read_csv(std::istream& in, vector<benchRecord>& rec)
+		{
+			rec.clear();
+			string line;
+			if (!getline(in, line)) {
+				LOG_ERROR("empty baseline - BenchHarness::read_csv");
+				return -1;
+			}
+
+			const size_t nFields = 5 + 3 * NUM_STATS + perfSample::NUM_EVENTS;
+			while (getline(in, line)) {
+				if (line.empty() || line == "\r") { continue; }
+				vector<string> f = split_csv(line);
+				if (f.size() != nFields) {
+					LOG_ERROR("wrong number of fields in a baseline record - BenchHarness::read_csv");
+					rec.clear();
+					return -1;
+				}
+
+				benchRecord r;
+				r.instance = f[0];
+				r.alg = f[1];
+				r.correct = (f[4] == "1");
+
+				//stoi / stod throw on non-numeric or out of range fields
+				try {
+					r.value = stoi(f[2]);
+					r.expected = stoi(f[3]);
+
+					double v[NUM_STATS];
+					size_t pos = 5;
+					for (stats_t* s : { &r.wall, &r.cpu, &r.cycles }) {
+						for (auto i = 0; i < NUM_STATS; ++i) { v[i] = stod(f[pos++]); }
+						set_stat_values(*s, v);
+					}
+					double pv[perfSample::NUM_EVENTS];
+					for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) { pv[e] = stod(f[pos++]); }
+					set_perf_values(r.perf, pv);
+				}
+				catch (std::exception& e) {
+					LOGG_ERROR("non-numeric field in a baseline record: ", e.what(), " - BenchHarness::read_csv");
+					rec.clear();
+					return -1;
+				}
+				rec.push_back(r);
+			}
+			return static_cast<int>(rec.size());
+		}
+
+		std::ostream& BenchHarness::print(std::ostream& o) const
+		{
+			o << "*****************************\n";
+			o << "REPS:" << nReps_ << "\t WARMUP:" << nWarmup_ << "\t INCORRECT:" << number_of_incorrect() << "\n";
+			o << "*****************************\n";
+			for (const auto& r : rec_) {
+				o << r.instance << "\t" << r.alg << "\t" << r.value << "\t" << (r.correct ? "OK" : "WRONG")
+					<< "\t" << r.wall.median << "\t" << r.wall.mean << "\t" << r.wall.stddev << "\t" << r.wall.p95
+					<< "\t" << r.cpu.median << "\t" << r.cycles.median;
+				if (!r.perf.empty()) {
+					o << "\t" << r.perf.ipc() << "\t" << r.perf.cache_miss_rate() << "\t" << r.perf.branch_miss_rate();
+				}
+				o << endl;
+			}
+			return o;
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
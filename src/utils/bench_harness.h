@@ -0,0 +1,285 @@
+/**
+* @file bench_harness.h
+* @brief interface for class BenchHarness, a statistical benchmarking harness: warm-up and repeated runs of
+*		 an algorithm on the instances of a Benchmark, with timing statistics, correctness checks against the
+*		 stored optimum, CSV / JSON export and comparison against a saved baseline
+* @details: every repetition measures wall time (steady clock), CPU time of the process and cycles
+*			(PrecisionTimer::process_cpu_time and CycleCounter, utils/prec_timer.h). Statistics are computed with
+*			com::_mat::MeanValue and StdDevValue, percentiles by linear interpolation of the sorted samples.
+* @details: optionally (perf_counters(true)) hardware counters (PerfCounters, utils/perf_counters.h) are read
+*			around every repetition; records keep their mean per repetition (IPC, cache and branch miss rates).
+*			They count the calling thread only, so they are not read if the algorithms run with more threads.
+* @details: a record regresses if its median wall time exceeds the baseline median by more than the relative
+*			tolerance AND by more than twice the larger standard deviation (the difference is above the noise)
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __BENCH_HARNESS_H__
+#define __BENCH_HARNESS_H__
+
+#include "utils/benchmark.h"
+#include "utils/prec_timer.h"
+#include "utils/perf_counters.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <ctime>
+#include <cstdint>
+#include <memory>
+
+namespace bitgraph {
+
+	namespace com {
+
+		//////////////////////////
+		//
+		// struct stats_t
+		// (summary statistics of a sample)
+		//
+		//////////////////////////
+
+		struct stats_t {
+			int n = 0;
+			double mean = 0;
+			double stddev = 0;
+			double min = 0;
+			double max = 0;
+			double median = 0;
+			double p90 = 0;
+			double p95 = 0;
+			double p99 = 0;
+
+			/*
+			* @brief statistics of @samples (all zero if empty)
+			*/
+			static stats_t compute(std::vector<double> samples);
+
+			/*
+			* @brief @p-th percentile (p in [0, 100]) of the SORTED @samples, by linear interpolation
+			*/
+			static double percentile(const std::vector<double>& samples, double p);
+		};
+
+		//////////////////////////
+		//
+		// struct benchRecord
+		// (repeated runs of an algorithm on an instance)
+		//
+		//////////////////////////
+
+		struct benchRecord {
+			std::string instance;
+			std::string alg;
+			int value = -1;													//value of the last repetition
+			int expected = -1;												//stored optimum (-1 if unknown)
+			bool correct = true;											//every repetition found the expected value
+			stats_t wall;													//in seconds
+			stats_t cpu;													//in seconds
+			stats_t cycles;
+			perfSample perf;												//hardware counters, mean per repetition (empty if not measured)
+		};
+
+		//////////////////////////
+		//
+		// struct regression_t
+		// (a record compared with the baseline, by median wall time)
+		//
+		//////////////////////////
+
+		struct regression_t {
+			enum flag_t { SAME = 0, IMPROVED, REGRESSED, NEW };
+
+			std::string instance;
+			std::string alg;
+			double base = 0;												//baseline median
+			double curr = 0;												//current median
+			double ratio = 0;												//curr / base
+			flag_t flag = NEW;
+
+			static const char* to_string(flag_t f);
+		};
+
+		///////////////////
+		//
+		// BenchHarness class
+		//
+		////////////////////
+
+		class BenchHarness {
+		public:
+			friend std::ostream& operator<<	(std::ostream& o, const BenchHarness& bh) { return bh.print(o); }
+
+			enum { NO_VALUE = -1 };											//no stored optimum (as Benchmark::get_value)
+			static constexpr double DEFAULT_TOLERANCE = 0.05;
+
+			//////////////////////////////
+			//construction / destruction
+
+			explicit BenchHarness(int nReps = 5, int nWarmup = 1) :
+				nReps_(nReps), nWarmup_(nWarmup), nThreads_(1), tol_(DEFAULT_TOLERANCE)
+			{}
+
+			////////////////
+			//setters and getters
+
+			void number_of_repetitions(int n) { nReps_ = n; }
+			void number_of_warmups(int n) { nWarmup_ = n; }
+			int number_of_repetitions()						const { return nReps_; }
+			int number_of_warmups()							const { return nWarmup_; }
+
+			/*
+			* @brief number of threads of the algorithms run (1 by default, hardware threads if <= 0)
+			*/
+			void number_of_threads(int n) { nThreads_ = n; }
+			int number_of_threads()							const { return nThreads_; }
+
+			/*
+			* @brief relative increase of the median wall time flagged as a regression (5% by default)
+			*/
+			void tolerance(double t) { tol_ = t; }
+			double tolerance()								const { return tol_; }
+
+			/*
+			* @brief reads hardware counters around each repetition (false by default)
+			* @returns true if counters are available and number_of_threads() is 1 - records are not measured otherwise
+			* @details: only the calling thread is counted - run() must be called from it. Pool workers are
+			*			not, so parallel runs (number_of_threads() != 1) are not measured
+			*/
+			bool perf_counters(bool enable);
+			bool perf_counters()							const { return perf_ && perf_->available() && nThreads_ == 1; }
+
+			const std::vector<benchRecord>& records()		const { return rec_; }
+			int number_of_incorrect()						const;
+
+			void clear() { rec_.clear(); }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief runs @f() (returns the solution value) number_of_warmups() times unmeasured, then
+			*		 number_of_repetitions() times measured
+			* @param expected: optimum to check the values against (NO_VALUE - not checked)
+			* @returns the new record
+			*/
+			template<class Func>
+			const benchRecord& run(const std::string& instance, const std::string& alg, Func f, int expected = NO_VALUE);
+
+			/*
+			* @brief runs @f(filename) on every instance of @b, checked against its stored values
+			* @returns number of instances with wrong values
+			*/
+			template<class Func>
+			int run(Benchmark& b, const std::string& alg, Func f);
+
+			/*
+			* @brief compares the records with @baseline (same instance and algorithm) by median wall time
+			*/
+			std::vector<regression_t> compare(const std::vector<benchRecord>& baseline)		const;
+
+			static int number_of_regressions(const std::vector<regression_t>& cmp);
+
+			/////////////
+			// I/O
+
+			/*
+			* @brief one row per record - strings are quoted, header in the first row
+			*/
+			std::ostream& write_csv(std::ostream& o)		const;
+			std::ostream& write_json(std::ostream& o)		const;
+
+			/*
+			* @brief reads records written by write_csv (a baseline)
+			* @returns number of records read, -1 if the format is not valid (also for baselines written
+			*		   without the perf columns, which must be generated again)
+			*/
+			static int read_csv(std::istream& in, std::vector<benchRecord>& rec);
+
+			std::ostream& print(std::ostream& o = std::cout)	const;
+
+		private:
+
+			////////////////
+			// data members
+
+			int nReps_;
+			int nWarmup_;
+			int nThreads_;
+			double tol_;
+			std::shared_ptr<PerfCounters> perf_;						//null if disabled
+			std::vector<benchRecord> rec_;
+		};
+
+	}//end namespace com
+
+	using com::BenchHarness;
+	using com::benchRecord;
+	using com::regression_t;
+	using com::stats_t;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	namespace com {
+
+		template<class Func>
+		inline
+			const benchRecord& BenchHarness::run(const std::string& instance, const std::string& alg, Func f, int expected)
+		{
+			benchRecord r;
+			r.instance = instance;
+			r.alg = alg;
+			r.expected = expected;
+
+			for (auto i = 0; i < nWarmup_; ++i) { f(); }
+
+			const bool isPerf = perf_counters();
+			std::vector<double> wall, cpu, cyc;
+			for (auto i = 0; i < nReps_; ++i) {
+				const perfSample p0 = isPerf ? perf_->read() : perfSample();
+				const double c0 = PrecisionTimer::process_cpu_time();
+				const uint64_t k0 = CycleCounter::now();
+				const auto t0 = std::chrono::steady_clock::now();
+
+				r.value = f();
+
+				wall.push_back(std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count());
+				cyc.push_back(static_cast<double>(CycleCounter::now() - k0));
+				cpu.push_back(PrecisionTimer::process_cpu_time() - c0);
+				if (isPerf) { r.perf += perf_->read() - p0; }
+
+				if (expected != NO_VALUE && r.value != expected) { r.correct = false; }
+			}
+
+			r.wall = stats_t::compute(std::move(wall));
+			r.cpu = stats_t::compute(std::move(cpu));
+			r.cycles = stats_t::compute(std::move(cyc));
+			r.perf /= nReps_;
+
+			rec_.push_back(std::move(r));
+			return rec_.back();
+		}
+
+		template<class Func>
+		inline
+			int BenchHarness::run(Benchmark& b, const std::string& alg, Func f)
+		{
+			int nWrong = 0;
+			for (const auto& file : b.getArrayOfFilenames()) {
+				const benchRecord& r = run(file, alg, [&f, &file]() { return f(file); }, b.get_value(file));
+				if (!r.correct) { ++nWrong; }
+			}
+			return nWrong;
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
+
+#endif
@@ -25,6 +25,7 @@
 #include <iomanip>
 #include <iostream>
 #include <random>
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <algorithm>
@@ -580,6 +581,66 @@ namespace bitgraph {
 
 
 
+			//////////////////
+			//
+			// class Xoshiro256
+			//
+			// (xoshiro256** engine seeded by splitmix64 [Blackman and Vigna 2018])
+			// Small state and cheap seeding, so independent streams can be created per thread
+			// or per unit of work: Xoshiro256(seed, stream) is reproducible for every pair (seed, stream).
+			// Satisfies UniformRandomBitGenerator (can be used with std:: distributions)
+			//
+			//////////////////
+
+			class Xoshiro256 {
+			public:
+				using result_type = uint64_t;
+
+				static constexpr result_type min() { return 0; }
+				static constexpr result_type max() { return ~result_type(0); }
+
+				/*
+				* @brief splitmix64 step - updates @x and returns the next output
+				*/
+				static uint64_t splitmix64(uint64_t& x) {
+					uint64_t z = (x += 0x9E3779B97F4A7C15ULL);
+					z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+					z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+					return z ^ (z >> 31);
+				}
+
+				explicit Xoshiro256(uint64_t seed = RandomUniformGen<>::FIXED_RANDOM_SEED, uint64_t stream = 0) {
+					this->seed(seed, stream);
+				}
+
+				void seed(uint64_t seed, uint64_t stream = 0) {
+					uint64_t x = seed ^ splitmix64(stream);
+					for (auto& w : s_) { w = splitmix64(x); }
+				}
+
+				result_type operator()() {
+					const uint64_t res = rotl(s_[1] * 5, 7) * 9;
+					const uint64_t t = s_[1] << 17;
+					s_[2] ^= s_[0]; s_[3] ^= s_[1];
+					s_[1] ^= s_[2]; s_[0] ^= s_[3];
+					s_[2] ^= t;
+					s_[3] = rotl(s_[3], 45);
+					return res;
+				}
+
+				/*
+				* @brief uniform double in (0, 1] (53 random bits)
+				*/
+				double uniform_pos() {
+					return (((*this)() >> 11) + 1) * (1.0 / 9007199254740992.0);
+				}
+
+			private:
+				static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+				uint64_t s_[4];
+			};
+
 			inline
 				bool uniform_dist(double p) {
 				//returns true with prob p, 0 with 1-p
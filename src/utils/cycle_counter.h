@@ -0,0 +1,97 @@
+/**
+* @file cycle_counter.h
+* @brief header for class CycleCounter, a calibrated cycle counter for sub-microsecond timing of hot paths
+* @details: reads the time-stamp counter (x86), the virtual counter (ARM64) or the steady clock (other platforms).
+*			The tick rate is calibrated once against the steady clock (~10ms)
+* @details: no dependencies on other BitGraph headers - included by logger.h through async_logger.h
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __CYCLE_COUNTER_H__
+#define __CYCLE_COUNTER_H__
+
+#include <chrono>
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace bitgraph {
+
+	namespace _impl {
+
+		/////////////////////
+		//
+		// CycleCounter class
+		//
+		// Calibrated cycle counter for sub-microsecond timing of hot paths
+		// (ticks are not comparable between machines - convert with to_seconds)
+		//
+		////////////////////
+
+		class CycleCounter {
+		public:
+			using tick_t = uint64_t;
+
+			/*
+			* @brief current value of the counter (in ticks)
+			*/
+			static tick_t now() {
+#if defined(_MSC_VER) || defined(__x86_64__) || defined(__i386__)
+				return __rdtsc();
+#elif defined(__aarch64__)
+				uint64_t v;
+				asm volatile("mrs %0, cntvct_el0" : "=r"(v));
+				return v;
+#else
+				return static_cast<tick_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+					std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+			}
+
+			/*
+			* @brief ticks per second, calibrated against the steady clock on first call
+			*/
+			static double ticks_per_second() {
+				static const double rate = calibrate();
+				return rate;
+			}
+
+			static double to_seconds(tick_t ticks) { return ticks / ticks_per_second(); }
+
+			void tic() { start_ = now(); }
+
+			/*
+			* @returns ticks elapsed since the last call to tic()
+			*/
+			tick_t toc() const { return now() - start_; }
+			double toc_seconds() const { return to_seconds(toc()); }
+
+		private:
+			static double calibrate() {
+				using sclock_t = std::chrono::steady_clock;
+				const auto t0 = sclock_t::now();
+				const tick_t c0 = now();
+				auto t1 = t0;
+				do {
+					t1 = sclock_t::now();
+				} while (t1 - t0 < std::chrono::milliseconds(10));
+				const tick_t c1 = now();
+				const double sec = std::chrono::duration<double>(t1 - t0).count();
+				return (c1 > c0) ? (c1 - c0) / sec : 1e9;
+			}
+
+			tick_t start_ = 0;
+		};
+
+	}//end namespace _impl
+
+	using _impl::CycleCounter;
+
+}//end namespace bitgraph
+
+#endif
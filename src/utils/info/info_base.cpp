@@ -54,9 +54,41 @@ std::ostream& infoBase::printTimers(std::ostream& o) const
 	o << "TIME_OUT_HEUR(s):" << data_.TIME_OUT_HEUR << endl;
 	o << "*****************************" << endl;
 
+	if (perf_) { printPerfCounters(o); }
+
 	return o;
 }
 
+std::ostream& infoBase::printPerfCounters(std::ostream& o) const
+{
+	o << "*****************************\n";
+	if (!perf_ || !perf_->available()) {
+		o << "perf counters: not available" << endl;
+	}
+	else if (data_.nThreads != 1) {
+		o << "perf counters: not available (parallel run)" << endl;
+	}
+	else {
+		o << "perf counters: calling thread only" << endl;
+		o << "perf_parse:\t";		perfPhase_[phase_t::PARSE].print(o);
+		o << "perf_preproc:\t";	perfPhase_[phase_t::PREPROC].print(o);
+		o << "perf_search:\t";		perfPhase_[phase_t::SEARCH].print(o);
+	}
+	o << "*****************************" << endl;
+
+	return o;
+}
+
+bool infoBase::enablePerfCounters(bool enable)
+{
+	if (!enable) {
+		perf_.pc_.reset();
+		return false;
+	}
+	if (!perf_) { perf_.pc_.reset(new PerfCounters()); }
+	return perf_->available() && data_.nThreads == 1;
+}
+
 std::ostream& infoBase::printReport(std::ostream& o, bool is_endl) const
 {
 	o << data_.name << "\t" << data_.N << "\t" << data_.M << "\t" << data_.TIME_OUT << "\t" << data_.TIME_OUT_HEUR << "\t"
@@ -65,6 +97,11 @@ std::ostream& infoBase::printReport(std::ostream& o, bool is_endl) const
 		<< algHeur_ << "\t"*/
 		<< timeParse_ << "\t" << timePreproc_ << "\t" << timeIncumbent_ << "\t" << timeSearch_ << "\t";
 
+	if (perf_) {
+		const perfSample& ps = perfPhase_[phase_t::SEARCH];
+		o << ps.ipc() << "\t" << ps.cache_miss_rate() << "\t" << ps.branch_miss_rate() << "\t";
+	}
+
 	if (is_endl) {	o << endl;	}
 
 	return o;
@@ -72,6 +109,8 @@ std::ostream& infoBase::printReport(std::ostream& o, bool is_endl) const
 
 void infoBase::startTimer(phase_t t)
 {
+	if (is_perf_phase(t)) { perfStart_[t] = perf_->read(); }
+
 	switch (t) {
 	case phase_t::SEARCH:
 		startTimeSearch_ = PrecisionTimer::clock_t::now();
@@ -118,6 +157,7 @@ void infoBase::clearTimer(phase_t t) {
 		LOGG_ERROR("timer type: ", (int)t, " - com::infoBase::clearTimer");
 		std::exit(-1);
 	}
+	perfPhase_[t] = perfSample();
 }
 
 void infoBase::clearAllTimers() {
@@ -156,6 +196,8 @@ double infoBase::readTimer(phase_t t)
 		std::exit(-1);
 	}
 
+	perfPhase_[t] = is_perf_phase(t) ? perf_->read() - perfStart_[t] : perfSample();
+
 	return elapsedTime;
 }
 
@@ -9,7 +9,9 @@
 #define _INFO_BASE_H_
 
 #include "utils/prec_timer.h"
+#include "utils/perf_counters.h"
 #include <iostream>
+#include <memory>
 #include <string>
 #include <limits>
 #include <vector>
@@ -67,6 +69,9 @@ namespace bitgraph {
 		//  @brief base struct to report results of graph algorithms.
 		// 
 		//  Supports basic configuration parameters and timers.
+		//  Hardware counters (PerfCounters) are read with the timers of the PARSE,
+		//  PREPROC and SEARCH phases once enabled with enablePerfCounters() - they count
+		//  the calling thread only, so they are not read in parallel runs (number_of_threads() != 1)
 		//  
 		//  TODO- conceived as a struct initially (all data members are public), 
 		//  added getters/setters later, possibly convert to a CLASS (31/08/2025)
@@ -103,6 +108,32 @@ namespace bitgraph {
 			tpoint_t startTimeIncumbent_;
 			double timeIncumbent_ = 0;				//time when last new incumbent was found (in seconds)
 
+			/*
+			* @brief owner of the hardware counters - copies are disabled (counters are not shared, and
+			*		 are only opened by enablePerfCounters in the thread to be counted)
+			*/
+			struct perfHandle {
+				std::unique_ptr<PerfCounters> pc_;
+
+				perfHandle() = default;
+				perfHandle(const perfHandle&) {}
+				perfHandle& operator = (const perfHandle& h) {
+					if (this != &h) { pc_.reset(); }
+					return *this;
+				}
+				perfHandle(perfHandle&&) = default;
+				perfHandle& operator = (perfHandle&&) = default;
+
+				PerfCounters* get() const noexcept { return pc_.get(); }
+				PerfCounters* operator->() const noexcept { return pc_.get(); }
+				explicit operator bool() const noexcept { return pc_ != nullptr; }
+			};
+
+			// hardware counters (disabled by default and in copies, which keep the samples of finished phases)
+			perfHandle perf_;
+			perfSample perfStart_[4];				//counters at startTimer, indexed by phase_t
+			perfSample perfPhase_[4];				//counters of the phase at readTimer, indexed by phase_t
+
 
 			///////////////////////
 			//constructors / destructor
@@ -125,6 +156,14 @@ namespace bitgraph {
 			double search_time() const { return timeSearch_; }
 			double incumbent_time() const { return timeIncumbent_; }
 
+			bool perf_counters_enabled() const noexcept { return static_cast<bool>(perf_); }
+
+			/*
+			* @brief hardware counters of phase @t (PARSE, PREPROC or SEARCH), empty if not enabled
+			*		 or if the phase ran with number_of_threads() != 1
+			*/
+			const perfSample& perf_counters(phase_t t) const { return perfPhase_[t]; }
+
 			//////////////////////
 			//setters - only for general info, timers should not be set manually
 						
@@ -135,6 +174,15 @@ namespace bitgraph {
 			void time_out_heur(double t) { data_.TIME_OUT_HEUR = t; }
 			void number_of_threads(int n) { data_.nThreads = n; }
 
+			/*
+			* @brief opens hardware counters for the calling thread (@enable = true) or closes them
+			* @returns true if counters are available and number_of_threads() is 1 - otherwise phases
+			*		   report empty samples
+			* @details: only the calling thread is counted - startTimer / readTimer must be called from it.
+			*			Pool workers are not, so phases which run with number_of_threads() != 1 are not measured
+			*/
+			bool enablePerfCounters(bool enable = true);
+
 
 			//timers
 			/*
@@ -200,6 +248,20 @@ namespace bitgraph {
 			*/
 			std::ostream& printTimers(std::ostream& o = std::cout) const;
 
+			/*
+			* @brief streams hardware counters of the PARSE, PREPROC and SEARCH phases (thread which
+			*		 enabled them only, see enablePerfCounters)
+			* @param o output stream
+			* @returns output stream
+			*/
+			std::ostream& printPerfCounters(std::ostream& o = std::cout) const;
+
+		private:
+			/*
+			* @brief true if phase @t is measured with the hardware counters
+			*/
+			bool is_perf_phase(phase_t t) const { return perf_ && data_.nThreads == 1 && t != phase_t::LAST_INCUMBENT; }
+
 		};
 
 	}//namespace com
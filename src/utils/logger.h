@@ -60,6 +60,10 @@ template <typename T> struct is_rangeloop_supported : std::false_type {};
 template <typename T> struct is_rangeloop_supported<std::vector<T>> : std::true_type {};
 template <typename T> struct is_rangeloop_supported<std::initializer_list<T>> : std::true_type {};
 
+// Tag expansion function for non-range-loop types (declared first - used by the range-loop version)
+template<typename T>
+typename std::enable_if<!is_rangeloop_supported<T>::value, std::string>::type tag_expand(const T& arg);
+
 // Tag expansion function for supported range-loop types
 template<typename T>
 typename std::enable_if<is_rangeloop_supported<T>::value, std::string>::type tag_expand(const T& arg) {
@@ -205,6 +209,34 @@ void _Error2(T&&... args) {
 #define Logy(...) _Silent(__VA_ARGS__)
 #define LOGY(...) _Silent2(__VA_ARGS__)
 
+//////////////////////////////////////////
+// asynchronous backend (utils/async_logger.h) - CMake option LOGGER_ASYNC
+// (compile-time levels as above, calls return without writing to std::cerr)
+
+#ifdef LOGGER_ASYNC
+#include "utils/async_logger.h"
+
+#undef LOG_ERROR
+#undef LOG_WARNING
+#undef LOG_INFO
+#undef LOG_PRINT
+#undef LOG_DEBUG
+#define LOG_ERROR(msg)			ALOG_ERROR(msg)
+#define LOG_WARNING(msg)		ALOG_WARNING(msg)
+#define LOG_INFO(msg)			ALOG_INFO(msg)
+#define LOG_PRINT(msg)			ALOG_INFO(msg)
+#define LOG_DEBUG(msg)			ALOG_DEBUG(msg)
+
+#undef LOGG_DEBUG
+#undef LOGG_INFO
+#undef LOGG_WARNING
+#undef LOGG_ERROR
+#define LOGG_DEBUG(...)			ALOG_DEBUG(__VA_ARGS__)
+#define LOGG_INFO(...)			ALOG_INFO(__VA_ARGS__)
+#define LOGG_WARNING(...)		ALOG_WARNING(__VA_ARGS__)
+#define LOGG_ERROR(...)			ALOG_ERROR(__VA_ARGS__)
+#endif
+
 
 
 
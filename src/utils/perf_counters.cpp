@@ -0,0 +1,202 @@
+/**
+ * @file perf_counters.cpp
+ * @brief implementation of class PerfCounters in perf_counters.h
+ * @details: created 17/10/2026, last_update 17/10/2026
+ * @dev pss
+ **/
+
+#include "perf_counters.h"
+#include "utils/logger.h"
+#include <cstring>
+#include <cstdint>
+#include <cerrno>
+#include <atomic>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+namespace bitgraph {
+
+	namespace com {
+
+		//////////////////
+		// perfSample
+
+		const char* perfSample::to_string(event_t e)
+		{
+			switch (e) {
+			case CYCLES:			return "cycles";
+			case INSTRUCTIONS:		return "instructions";
+			case CACHE_REFERENCES:	return "cache_references";
+			case CACHE_MISSES:		return "cache_misses";
+			case BRANCHES:			return "branches";
+			case BRANCH_MISSES:		return "branch_misses";
+			default:				return "unknown";
+			}
+		}
+
+		bool perfSample::empty() const
+		{
+			for (auto e = 0; e < NUM_EVENTS; ++e) {
+				if (valid[e]) { return false; }
+			}
+			return true;
+		}
+
+		perfSample& perfSample::operator += (const perfSample& rhs)
+		{
+			for (auto e = 0; e < NUM_EVENTS; ++e) {
+				value[e] += rhs.value[e];
+				valid[e] = valid[e] || rhs.valid[e];
+			}
+			return *this;
+		}
+
+		perfSample operator - (const perfSample& lhs, const perfSample& rhs)
+		{
+			perfSample res;
+			for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+				res.valid[e] = lhs.valid[e] && rhs.valid[e];
+				res.value[e] = res.valid[e] ? lhs.value[e] - rhs.value[e] : 0;
+			}
+			return res;
+		}
+
+		perfSample& perfSample::operator /= (double d)
+		{
+			if (d != 0) {
+				for (auto e = 0; e < NUM_EVENTS; ++e) { value[e] /= d; }
+			}
+			return *this;
+		}
+
+		std::ostream& perfSample::print(std::ostream& o, bool endl) const
+		{
+			o << "IPC:" << ipc() << "\t CACHE_MISS_RATE:" << cache_miss_rate() << "\t BRANCH_MISS_RATE:" << branch_miss_rate();
+			for (auto e = 0; e < NUM_EVENTS; ++e) {
+				o << "\t " << to_string(static_cast<event_t>(e)) << ":";
+				if (valid[e]) { o << static_cast<uint64_t>(value[e]); }
+				else { o << "-"; }
+			}
+			if (endl) { o << std::endl; }
+			return o;
+		}
+
+		//////////////////
+		// PerfCounters
+
+#ifdef __linux__
+
+		namespace {
+
+			const uint64_t EVENT_CONFIG[perfSample::NUM_EVENTS] = {
+				PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+				PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES,
+				PERF_COUNT_HW_BRANCH_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES
+			};
+
+			int open_event(uint64_t config, int groupFd) {
+				perf_event_attr pe;
+				std::memset(&pe, 0, sizeof(pe));
+				pe.type = PERF_TYPE_HARDWARE;
+				pe.size = sizeof(pe);
+				pe.config = config;
+				pe.disabled = (groupFd == -1) ? 1 : 0;				//members follow their leader
+				pe.exclude_kernel = 1;
+				pe.exclude_hv = 1;
+				pe.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+				return static_cast<int>(::syscall(__NR_perf_event_open, &pe, 0, -1, groupFd, 0));
+			}
+
+			//leaders enable / disable / reset their whole group
+			void group_ioctl(const int fd[], unsigned long op) {
+				for (auto e = 0; e < perfSample::NUM_EVENTS; e += 2) {
+					if (fd[e] >= 0) { ::ioctl(fd[e], op, PERF_IOC_FLAG_GROUP); }
+					else if (fd[e + 1] >= 0) { ::ioctl(fd[e + 1], op, 0); }
+				}
+			}
+		}
+
+		PerfCounters::PerfCounters()
+		{
+			for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) { fd_[e] = -1; }
+
+			int err = 0;
+			for (auto e = 0; e < perfSample::NUM_EVENTS; e += 2) {
+				fd_[e] = open_event(EVENT_CONFIG[e], -1);
+				if (fd_[e] < 0) { err = errno; }
+
+				//the second event opens on its own if the leader is not available
+				fd_[e + 1] = open_event(EVENT_CONFIG[e + 1], fd_[e]);
+				if (fd_[e + 1] < 0) { err = errno; }
+			}
+
+			if (err != 0) {
+				status_ = string("perf_event_open: ") + std::strerror(err);
+
+				//the reason is the same for every object - warned once per process
+				static std::atomic_flag warned = ATOMIC_FLAG_INIT;
+				if (!available() && !warned.test_and_set()) {
+					LOGG_WARNING("hardware counters not available (", status_, ") - PerfCounters::PerfCounters");
+				}
+			}
+
+			start();
+		}
+
+		PerfCounters::~PerfCounters()
+		{
+			for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+				if (fd_[e] >= 0) { ::close(fd_[e]); }
+			}
+		}
+
+		perfSample PerfCounters::read() const
+		{
+			perfSample s;
+			uint64_t buf[3];											//value, time_enabled, time_running
+			for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+				if (fd_[e] < 0 || ::read(fd_[e], buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf))) { continue; }
+				s.valid[e] = true;
+				if (buf[2] == 0) { continue; }							//enabled but never scheduled
+				s.value[e] = (buf[2] < buf[1]) ? static_cast<double>(buf[0]) * buf[1] / buf[2] : static_cast<double>(buf[0]);
+			}
+			return s;
+		}
+
+		void PerfCounters::reset() { group_ioctl(fd_, PERF_EVENT_IOC_RESET); }
+		void PerfCounters::stop() { group_ioctl(fd_, PERF_EVENT_IOC_DISABLE); }
+		void PerfCounters::start() { group_ioctl(fd_, PERF_EVENT_IOC_ENABLE); }
+
+#else
+
+		PerfCounters::PerfCounters() : status_("perf events are only supported on Linux")
+		{
+			for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) { fd_[e] = -1; }
+		}
+
+		PerfCounters::~PerfCounters() {}
+		perfSample PerfCounters::read() const { return perfSample(); }
+		void PerfCounters::reset() {}
+		void PerfCounters::stop() {}
+		void PerfCounters::start() {}
+
+#endif
+
+		bool PerfCounters::available() const
+		{
+			for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+				if (fd_[e] >= 0) { return true; }
+			}
+			return false;
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
@@ -0,0 +1,147 @@
+/**
+* @file perf_counters.h
+* @brief interface for class PerfCounters, hardware performance counters (cycles, instructions, cache and
+*		 branch events) of the calling thread read through the Linux perf_event interface
+* @details: events are opened in three groups of two - {cycles, instructions}, {cache references, cache misses},
+*			{branches, branch misses} - so that the events of a ratio (IPC, miss rates) are always scheduled
+*			together. When the PMU multiplexes, values are scaled by time_enabled / time_running.
+* @details: counters only see the thread which constructed the object (user space only) - threads created
+*			before it, such as the workers of the global ThreadPool, are never counted.
+* @details: where perf events cannot be opened (non-Linux, containers, perf_event_paranoid) the affected
+*			events are flagged as not valid and reads return zero - no errors are raised
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __PERF_COUNTERS_H__
+#define __PERF_COUNTERS_H__
+
+#include <iostream>
+#include <string>
+
+namespace bitgraph {
+
+	namespace com {
+
+		//////////////////////////
+		//
+		// struct perfSample
+		// (values of the hardware counters - cumulative or a difference between two reads)
+		//
+		//////////////////////////
+
+		struct perfSample {
+			enum event_t { CYCLES = 0, INSTRUCTIONS, CACHE_REFERENCES, CACHE_MISSES, BRANCHES, BRANCH_MISSES, NUM_EVENTS };
+
+			double value[NUM_EVENTS] = {};
+			bool valid[NUM_EVENTS] = {};
+
+			static const char* to_string(event_t e);
+
+			bool is_valid(event_t e)				const { return valid[e]; }
+			bool empty()							const;
+
+			/*
+			* @brief instructions per cycle (-1 if not available)
+			*/
+			double ipc()							const { return ratio(INSTRUCTIONS, CYCLES); }
+
+			/*
+			* @brief cache misses per cache reference (-1 if not available)
+			*/
+			double cache_miss_rate()				const { return ratio(CACHE_MISSES, CACHE_REFERENCES); }
+
+			/*
+			* @brief branch misses per branch (-1 if not available)
+			*/
+			double branch_miss_rate()				const { return ratio(BRANCH_MISSES, BRANCHES); }
+
+			perfSample& operator +=					(const perfSample& rhs);
+			friend perfSample operator -			(const perfSample& lhs, const perfSample& rhs);
+
+			/*
+			* @brief every value divided by @d (e.g. mean of repetitions)
+			*/
+			perfSample& operator /=					(double d);
+
+			std::ostream& print(std::ostream& o = std::cout, bool endl = true)	const;
+
+		private:
+			double ratio(event_t num, event_t den)	const {
+				return (valid[num] && valid[den] && value[den] > 0) ? value[num] / value[den] : -1.0;
+			}
+		};
+
+		///////////////////
+		//
+		// PerfCounters class
+		//
+		// Counters start on construction and run until destruction; phases
+		// are measured as differences between reads
+		//
+		////////////////////
+
+		class PerfCounters {
+		public:
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @brief opens and starts all counters that are available
+			*/
+			PerfCounters();
+			~PerfCounters();
+
+			//copy and move semantics disallowed (owns file descriptors)
+			PerfCounters(const PerfCounters&) = delete;
+			PerfCounters& operator =			(const PerfCounters&) = delete;
+			PerfCounters(PerfCounters&&) = delete;
+			PerfCounters& operator =			(PerfCounters&&) = delete;
+
+			////////////////
+			//getters
+
+			/*
+			* @brief true if at least one counter could be opened
+			*/
+			bool available()								const;
+			bool available(perfSample::event_t e)			const { return fd_[e] >= 0; }
+
+			/*
+			* @brief reason why counters are missing (empty if all of them are available)
+			*/
+			const std::string& status()						const { return status_; }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief current (scaled) values of the counters since construction or the last reset()
+			*/
+			perfSample read()								const;
+
+			/*
+			* @brief sets the counters to zero
+			*/
+			void reset();
+
+			/*
+			* @brief stops / restarts counting (counters are enabled on construction)
+			*/
+			void stop();
+			void start();
+
+		private:
+			int fd_[perfSample::NUM_EVENTS];
+			std::string status_;
+		};
+
+	}//end namespace com
+
+	using com::perfSample;
+	using com::PerfCounters;
+
+}//end namespace bitgraph
+
+#endif
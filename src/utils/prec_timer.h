@@ -1,8 +1,11 @@
 /**
 * @file: prec_timer.h
-* @brief: header for class PreciseTimer that manages timestamps and time intervals
-* @details: uses std::chrono 
-* @detals: created 01/11/2024, last update 06/07/2025
+* @brief: header for class PreciseTimer that manages timestamps and time intervals, for the cycle counter
+*		  CycleCounter and for scoped timers which accumulate into named slots (TimerSlots, ScopedTimer)
+* @details: wall time uses std::chrono. CPU time is the real CPU time of the process (CLOCK_PROCESS_CPUTIME_ID)
+*			or of the calling thread (CLOCK_THREAD_CPUTIME_ID) on POSIX systems, std::clock elsewhere
+* @details: CycleCounter is in utils/cycle_counter.h (no dependencies, used by the asynchronous logger)
+* @detals: created 01/11/2024, last update 17/10/2026
 **/
 
 #ifndef __PRECISION_TIMER__
@@ -15,6 +18,17 @@
 #endif
 
 #include "utils/common.h"
+#include "utils/cycle_counter.h"
+#include <atomic>
+#include <mutex>
+#include <ctime>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <time.h>
+#define BITGRAPH_POSIX_CPU_CLOCKS
+#endif
 
 /******************
 *
@@ -39,27 +53,189 @@ namespace bitgraph {
 		public:
 			void wall_tic() { wall_time = get_wall_time(); }
 			double wall_toc()  const { return com::_time::toDouble(get_wall_time() - wall_time); };
-			void cpu_tic() { cpu_time = get_cpu_time(); }
-			double cpu_toc() const { return com::_time::toDouble(get_cpu_time() - cpu_time); };
+
+			/*
+			* @brief CPU time consumed by the process (all its threads) - exceeds wall time
+			*		 for multi-threaded runs
+			*/
+			void cpu_tic() { cpu_time = process_cpu_time(); }
+			double cpu_toc() const { return process_cpu_time() - cpu_time; };
+
+			/*
+			* @brief CPU time consumed by the calling thread - tic and toc must be called from the same thread
+			*/
+			void thread_tic() { thread_time = thread_cpu_time(); }
+			double thread_toc() const { return thread_cpu_time() - thread_time; };
 
 			static std::string local_timestamp(bool date = true) {
 				return com::_time::tp2string(wall_clock_t::now(), date);				//MUST BE wall clock
 			}
+
+			/*
+			* @brief CPU time of the process in seconds (since an unspecified origin)
+			*/
+			static double process_cpu_time() {
+#ifdef BITGRAPH_POSIX_CPU_CLOCKS
+				return read_clock(CLOCK_PROCESS_CPUTIME_ID);
+#else
+				return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+#endif
+			}
+
+			/*
+			* @brief CPU time of the calling thread in seconds (since an unspecified origin)
+			*		 (CPU time of the process where per-thread clocks are not available)
+			*/
+			static double thread_cpu_time() {
+#ifdef BITGRAPH_POSIX_CPU_CLOCKS
+				return read_clock(CLOCK_THREAD_CPUTIME_ID);
+#else
+				return process_cpu_time();
+#endif
+			}
+
 		private:
-			timepoint_t get_cpu_time() const { return clock_t::now(); }
 			wall_timepoint_t get_wall_time() const { return wall_clock_t::now(); }
 
+#ifdef BITGRAPH_POSIX_CPU_CLOCKS
+			static double read_clock(clockid_t id) {
+				timespec ts;
+				if (::clock_gettime(id, &ts) != 0) {
+					return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+				}
+				return ts.tv_sec + ts.tv_nsec * 1e-9;
+			}
+#endif
+
 		private:
-			timepoint_t cpu_time;
+			double cpu_time = 0.0;
+			double thread_time = 0.0;
 			wall_timepoint_t wall_time;
 		};
 
+		/////////////////////
+		//
+		// TimerSlots class
+		//
+		// Named accumulators of cycle counts, shared by all threads (relaxed atomics).
+		// Slots are registered once and never removed; a global instance is available.
+		// The number of slots is published (release) after the name of a new slot is written,
+		// so the getters may run concurrently with slot()
+		//
+		////////////////////
+
+		class TimerSlots {
+		public:
+			enum { MAX_SLOTS = 64 };
+
+			static TimerSlots& instance() {
+				static TimerSlots ts;
+				return ts;
+			}
+
+			/*
+			* @brief id of the slot called @name, registered if it does not exist
+			* @returns the slot id, -1 if there are already MAX_SLOTS slots
+			*/
+			int slot(const std::string& name) {
+				std::lock_guard<std::mutex> lock(mtx_);
+				const int n = nSlots_.load(std::memory_order_relaxed);
+				for (int i = 0; i < n; ++i) {
+					if (names_[i] == name) { return i; }
+				}
+				if (n == MAX_SLOTS) { return -1; }
+				names_[n] = name;
+				nSlots_.store(n + 1, std::memory_order_release);
+				return n;
+			}
+
+			void add(int id, CycleCounter::tick_t ticks) {
+				if (id < 0) { return; }
+				ticks_[id].fetch_add(ticks, std::memory_order_relaxed);
+				calls_[id].fetch_add(1, std::memory_order_relaxed);
+			}
+
+			////////////////
+			//getters
+
+			int number_of_slots() const { return nSlots_.load(std::memory_order_acquire); }
+			const std::string& name(int id) const { return names_[id]; }
+			CycleCounter::tick_t ticks(int id) const { return ticks_[id].load(std::memory_order_relaxed); }
+			uint64_t calls(int id) const { return calls_[id].load(std::memory_order_relaxed); }
+			double seconds(int id) const { return CycleCounter::to_seconds(ticks(id)); }
+
+			/*
+			* @brief sets all accumulators to zero (slots remain registered)
+			*/
+			void reset() {
+				for (int i = 0; i < MAX_SLOTS; ++i) {
+					ticks_[i].store(0, std::memory_order_relaxed);
+					calls_[i].store(0, std::memory_order_relaxed);
+				}
+			}
+
+			/*
+			* @brief one line per slot: name, total seconds, calls
+			*/
+			std::ostream& print(std::ostream& o = std::cout) const {
+				const int n = number_of_slots();
+				for (int i = 0; i < n; ++i) {
+					o << names_[i] << "\t" << seconds(i) << "s\t" << calls(i) << " calls" << std::endl;
+				}
+				return o;
+			}
+
+		private:
+			std::mutex mtx_;
+			std::atomic<int> nSlots_{ 0 };
+			std::string names_[MAX_SLOTS];
+			std::atomic<CycleCounter::tick_t> ticks_[MAX_SLOTS] = {};
+			std::atomic<uint64_t> calls_[MAX_SLOTS] = {};
+		};
+
+		/////////////////////
+		//
+		// ScopedTimer class
+		//
+		// Adds the cycles elapsed in its lifetime to a slot of a TimerSlots registry
+		//
+		////////////////////
+
+		class ScopedTimer {
+		public:
+			explicit ScopedTimer(int id, TimerSlots& ts = TimerSlots::instance()) :
+				ts_(ts), id_(id), start_(CycleCounter::now())
+			{}
+			~ScopedTimer() { ts_.add(id_, CycleCounter::now() - start_); }
+
+			ScopedTimer(const ScopedTimer&) = delete;
+			ScopedTimer& operator = (const ScopedTimer&) = delete;
+
+		private:
+			TimerSlots& ts_;
+			int id_;
+			CycleCounter::tick_t start_;
+		};
+
 	}//end namespace _impl
 
 	using _impl::PrecisionTimer;
+	using _impl::TimerSlots;
+	using _impl::ScopedTimer;
 
 }//end namespace bitgraph
 
+////////////////
+// Scoped timer into the global slot @name - the slot is looked up once per call site
+// e.g. { SCOPED_TIMER("coloring"); ... }
+
+#define SCOPED_TIMER_CAT_(a, b) a##b
+#define SCOPED_TIMER_CAT(a, b) SCOPED_TIMER_CAT_(a, b)
+#define SCOPED_TIMER(name)																	\
+	static const int SCOPED_TIMER_CAT(scoped_timer_id_, __LINE__) =						\
+		::bitgraph::TimerSlots::instance().slot(name);											\
+	::bitgraph::ScopedTimer SCOPED_TIMER_CAT(scoped_timer_, __LINE__)(SCOPED_TIMER_CAT(scoped_timer_id_, __LINE__))
+
 #endif
 
 
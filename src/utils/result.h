@@ -0,0 +1,126 @@
+/**
+* @file result.h
+* @brief interface for class Result, the outcome of one run of an algorithm on an instance
+*		 (solution value, bounds, steps, counters and timings) - the input of TestAnalyser
+* @details: tic() / toc() measure wall time and process CPU time (std::clock) of the run
+* @details: created 2013, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __RESULT_H__
+#define __RESULT_H__
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <ctime>
+#include <cstdint>
+
+namespace bitgraph {
+
+	namespace com {
+
+		///////////////////
+		//
+		// Result class
+		//
+		////////////////////
+
+		class Result {
+		public:
+			friend std::ostream& operator<<	(std::ostream& o, const Result& r) { return r.print(o); }
+
+			////////////////
+			//setters and getters
+
+			void set_name(std::string name) { name_ = std::move(name); }
+			void set_LB(int lb) { lb_ = lb; }
+			void set_UB(int ub) { ub_ = ub; }
+			void set_number_of_steps(uint64_t n) { nSteps_ = n; }
+			void set_is_tout(bool tout) { isTimeOut_ = tout; }
+
+			/*
+			* @brief adds @val to counter @idx (counters are created on demand, initialized to 0)
+			*/
+			void inc_counter(int idx, int val = 1);
+
+			const std::string& name()						const { return name_; }
+			int get_LB()									const { return lb_; }
+			int get_UB()									const { return ub_; }
+			uint64_t number_of_steps()						const { return nSteps_; }
+			bool is_tout()									const { return isTimeOut_; }
+			const std::vector<int>& counters()				const { return counters_; }
+
+			/*
+			* @brief time between tic() and toc() - CPU time of the process and wall time (in seconds)
+			*/
+			double get_user_time()							const { return userTime_; }
+			double get_wall_time()							const { return wallTime_; }
+
+			//////////////
+			// timing
+
+			void tic();
+			void toc();
+
+			/////////////
+			// I/O
+
+			std::ostream& print(std::ostream& o = std::cout)	const;
+
+			////////////////
+			// data members
+		private:
+			std::string name_;
+			int lb_ = 0;
+			int ub_ = 0;
+			uint64_t nSteps_ = 0;
+			bool isTimeOut_ = false;
+			std::vector<int> counters_;
+
+			std::clock_t cpuStart_ = 0;
+			std::chrono::steady_clock::time_point wallStart_;
+			double userTime_ = 0;
+			double wallTime_ = 0;
+		};
+
+		inline
+			void Result::inc_counter(int idx, int val)
+		{
+			if (idx >= static_cast<int>(counters_.size())) {
+				counters_.resize(idx + 1, 0);
+			}
+			counters_[idx] += val;
+		}
+
+		inline
+			void Result::tic()
+		{
+			cpuStart_ = std::clock();
+			wallStart_ = std::chrono::steady_clock::now();
+		}
+
+		inline
+			void Result::toc()
+		{
+			userTime_ = static_cast<double>(std::clock() - cpuStart_) / CLOCKS_PER_SEC;
+			wallTime_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart_).count();
+		}
+
+		inline
+			std::ostream& Result::print(std::ostream& o) const
+		{
+			o << name_ << "\t" << lb_ << "\t" << ub_ << "\t" << nSteps_ << "\t" << userTime_ << "\t" << wallTime_
+				<< "\t" << (isTimeOut_ ? "TOUT" : "OK");
+			for (auto c : counters_) { o << "\t" << c; }
+			return o;
+		}
+
+	}//end namespace com
+
+	using com::Result;
+
+}//end namespace bitgraph
+
+#endif
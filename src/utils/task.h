@@ -2,38 +2,58 @@
 * @file task.h
 * @brief convenience functions and classed to run callable objects or member functions as async threads.
 * 		 Application: algorithm test framework - algoritms are run sequentially  and main thread waits for each one to finish
-* @details: created 2013, last_update 22/07/2025
+* @details: tasks run in the global work-stealing pool (thread_pool.h) - no thread is created per task, and the
+*			waiting thread executes pending tasks of the pool (possibly the task itself) instead of blocking
+* @details: thread_count resolves the number of threads of the parallel algorithms, which call com::run_parallel
+* @details: created 2013, last_update 17/10/2026
 * @dev: pss
 **/ 
 
 #ifndef __TASK_H__	
 #define __TASK_H__	
 
-#include <future>
 #include <exception>
 #include <type_traits>
+#include <thread>
+#include <limits>
+#include <algorithm>
+#include <cstddef>
 #include "logger.h"
+#include "thread_pool.h"
 
 namespace bitgraph {
 
 	namespace com {
+
+		/**
+		* @brief: number of threads of a parallel run - hardware threads if @nThreads <= 0, at most @nWork
+		*		  (independent pieces of work) and at least 1
+		**/
+		inline
+		int thread_count(int nThreads, std::size_t nWork = std::numeric_limits<std::size_t>::max())
+		{
+			if (nThreads <= 0) {
+				nThreads = static_cast<int>(std::thread::hardware_concurrency());
+			}
+			return static_cast<int>(std::max<std::size_t>(1, std::min<std::size_t>(std::max(nThreads, 1), nWork)));
+		}
 		
 		/**
-		* @brief: Runs a task asynchronously (different thread) according to a member function of an object with generic params and waits for it to finish
+		* @brief: Runs a task asynchronously (pool task) according to a member function of an object with generic params and waits for it to finish
 		*		  providing the task's return value.
 		* @return: task's return value or a default value if an exception is caught
 		* @details: the task MUST have a return value. The task, if required, must throw an exception derived from std::exception.
 		**/
 		template<typename func_t, typename obj_t, typename... Args>
 		inline
-		typename std::result_of<func_t(obj_t&, Args...)>::type
+		task_result_t<func_t&, obj_t*, Args...>
 		run_task_async(func_t func, obj_t& obj, Args&&... args) noexcept	
 		{	
-			using ret_t = typename std::result_of<func_t(obj_t&, Args...)>::type;
+			using ret_t = task_result_t<func_t&, obj_t*, Args...>;
 			ret_t value{};
 
 			//future to hold the result of the async task
-			std::future<ret_t> fut = std::async(std::launch::async, func, std::ref(obj), std::forward<Args>(args)...);
+			TaskFuture<ret_t> fut = async(ThreadPool::instance(), func, &obj, std::forward<Args>(args)...);
 			
 			try {
 				value = fut.get();		//can throw			
@@ -46,22 +66,22 @@ namespace bitgraph {
 		}
 
 		/**
-		* @brief: Runs a task  asynchronously (different thread) to a callable object as a thread with generic params and waits for it to finish
+		* @brief: Runs a task  asynchronously (pool task) to a callable object as a thread with generic params and waits for it to finish
 		*		  providing the task's return value.
 		* @return: task's return value or a default value if an exception is caught
 		* @details: the task MUST have a return value. The task, if required, must throw an exception derived from std::exception.
 		**/
 		template<typename callable_t, typename... Args>
 		inline
-		typename std::result_of<callable_t(Args...)>::type
+		task_result_t<callable_t, Args...>
 		run_task_async(callable_t&& obj, Args&&... args) noexcept
 		{		
 
-			using ret_t = typename std::result_of<callable_t(Args...)>::type;
+			using ret_t = task_result_t<callable_t, Args...>;
 			ret_t value{};
 
 			//future to hold the result of the async task
-			std::future<ret_t> fut = std::async(std::launch::async, obj, std::forward<Args>(args)...);;
+			TaskFuture<ret_t> fut = async(ThreadPool::instance(), std::forward<callable_t>(obj), std::forward<Args>(args)...);
 		
 			try {
 				value = fut.get();			//can throw				
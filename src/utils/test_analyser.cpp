@@ -0,0 +1,154 @@
+/**
+ * @file test_analyser.cpp
+ * @brief implementation of class TestAnalyser in test_analyser.h
+ * @details: created 2013, last_update 17/10/2026
+ * @dev pss
+ **/
+
+#include "test_analyser.h"
+#include "utils/common.h"
+#include "utils/logger.h"
+#include <algorithm>
+
+using namespace std;
+
+namespace bitgraph {
+
+	namespace com {
+
+		void TestAnalyser::add_test(bool new_rep, const Result& r)
+		{
+			if (new_rep || res_.empty()) {
+				res_.emplace_back();
+			}
+			res_.back().push_back(r);
+		}
+
+		void TestAnalyser::clear()
+		{
+			res_.clear();
+			steps_.clear();
+			lb_.clear();
+			ub_.clear();
+			time_.clear();
+			sdTime_.clear();
+			nFails_.clear();
+			counters_.clear();
+		}
+
+		int TestAnalyser::analyser(info_t* info)
+		{
+			const int nAlg = number_of_algorithms();
+			for (const auto& rep : res_) {
+				if (static_cast<int>(rep.size()) != nAlg) {
+					LOG_ERROR("repetitions with different number of algorithms - TestAnalyser::analyser");
+					return -1;
+				}
+			}
+
+			steps_.assign(nAlg, 0);
+			lb_.assign(nAlg, 0);
+			ub_.assign(nAlg, 0);
+			time_.assign(nAlg, 0);
+			sdTime_.assign(nAlg, 0);
+			nFails_.assign(nAlg, 0);
+			counters_.assign(nAlg, vector<double>());
+
+			for (auto a = 0; a < nAlg; ++a) {
+				_mat::MeanValue mSteps, mLB, mUB, mTime;
+				vector<double> times;
+				vector<vector<int>> cnt;
+				for (const auto& rep : res_) {
+					const Result& r = rep[a];
+					if (r.is_tout()) {
+						++nFails_[a];
+						continue;
+					}
+					mSteps(static_cast<double>(r.number_of_steps()));
+					mLB(r.get_LB());
+					mUB(r.get_UB());
+					mTime(r.get_user_time());
+					times.push_back(r.get_user_time());
+					cnt.push_back(r.counters());
+				}
+
+				//all repetitions failed - no averages
+				if (times.empty()) { continue; }
+
+				steps_[a] = mSteps;
+				lb_[a] = mLB;
+				ub_[a] = mUB;
+				time_[a] = mTime;
+				sdTime_[a] = for_each(times.begin(), times.end(), _mat::StdDevValue(time_[a]));
+
+				//counters - missing counters are 0
+				size_t nC = 0;
+				for (const auto& c : cnt) { nC = max(nC, c.size()); }
+				for (size_t i = 0; i < nC; ++i) {
+					_mat::MeanValue mC;
+					for (const auto& c : cnt) { mC(i < c.size() ? c[i] : 0); }
+					counters_[a].push_back(mC);
+				}
+			}
+
+			if (info != nullptr) {
+				*info = info_t();
+				int errorIdx = -1;
+				info->same_sol = consistent_sol_val(errorIdx);
+				for (const auto& rep : res_) {
+					for (const auto& r : rep) {
+						info->same_steps = info->same_steps && (r.number_of_steps() == rep.front().number_of_steps());
+						info->same_lb = info->same_lb && (r.get_LB() == rep.front().get_LB());
+						info->same_ub = info->same_ub && (r.get_UB() == rep.front().get_UB());
+					}
+				}
+			}
+
+			return 0;
+		}
+
+		bool TestAnalyser::consistent_sol_val(int& errorIdx) const
+		{
+			errorIdx = -1;
+			for (auto i = 0; i < number_of_repetitions(); ++i) {
+				int val = -1;
+				bool first = true;
+				for (const auto& r : res_[i]) {
+					if (r.is_tout()) { continue; }
+					if (first) {
+						val = r.get_LB();
+						first = false;
+					}
+					else if (r.get_LB() != val) {
+						errorIdx = i;
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		std::ostream& TestAnalyser::print(std::ostream& o) const
+		{
+			if (res_.empty()) { return o; }
+
+			const string name = res_.front().front().name();
+			for (auto a = 0; a < static_cast<int>(steps_.size()); ++a) {
+				o << name << "\t" << a << "\t" << number_of_repetitions() << "\t" << nFails_[a];
+
+				//all repetitions failed - no report
+				if (nFails_[a] == number_of_repetitions()) {
+					o << "\t-" << endl;
+					continue;
+				}
+
+				o << "\t" << lb_[a] << "\t" << ub_[a] << "\t" << steps_[a] << "\t" << time_[a] << "\t" << sdTime_[a];
+				for (auto c : counters_[a]) { o << "\t" << c; }
+				o << endl;
+			}
+			return o;
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
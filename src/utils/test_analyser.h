@@ -0,0 +1,113 @@
+/**
+* @file test_analyser.h
+* @brief interface for class TestAnalyser, which aggregates the results (Result) of several algorithms
+*		 over repetitions of the same instance and checks that they agree
+* @details: results are added by repetition - the first result of a repetition opens a new row, the rest
+*			are the next algorithms of that row. All repetitions must have the same number of algorithms.
+* @details: averages (steps, bounds, counters, times) are taken over the repetitions where the algorithm
+*			did not time out, with com::_mat::MeanValue and StdDevValue
+* @details: created 2013, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __TEST_ANALYSER_H__
+#define __TEST_ANALYSER_H__
+
+#include "utils/result.h"
+#include <iostream>
+#include <vector>
+
+namespace bitgraph {
+
+	namespace com {
+
+		///////////////////
+		//
+		// TestAnalyser class
+		//
+		////////////////////
+
+		class TestAnalyser {
+		public:
+			friend std::ostream& operator<<	(std::ostream& o, const TestAnalyser& ta) { return ta.print(o); }
+
+			/*
+			* @brief agreement between the algorithms, over all the repetitions
+			*/
+			struct info_t {
+				bool same_sol = true;										//same solution value (LB) when not timed out
+				bool same_steps = true;
+				bool same_lb = true;										//same LB, timed out or not
+				bool same_ub = true;
+			};
+
+			////////////////
+			//setters and getters
+
+			int number_of_repetitions()					const { return static_cast<int>(res_.size()); }
+			int number_of_algorithms()					const { return res_.empty() ? 0 : static_cast<int>(res_.front().size()); }
+
+			/*
+			* @brief averages by algorithm (after analyser())
+			*/
+			const std::vector<double>& get_steps()		const { return steps_; }
+			const std::vector<double>& get_lb()			const { return lb_; }
+			const std::vector<double>& get_ub()			const { return ub_; }
+			const std::vector<double>& get_times()		const { return time_; }
+			const std::vector<double>& get_stddev_times()	const { return sdTime_; }
+			const std::vector<int>& get_fails()			const { return nFails_; }
+			const std::vector<std::vector<double>>& get_counters()	const { return counters_; }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief adds result @r, in a new repetition if @new_rep, otherwise as the next algorithm of the last one
+			*/
+			void add_test(bool new_rep, const Result& r);
+
+			/*
+			* @brief averages of every algorithm over the repetitions
+			* @param info: agreement between the algorithms (if not null)
+			* @returns 0 if success, -1 if the repetitions do not have the same number of algorithms
+			*/
+			int analyser(info_t* info = nullptr);
+
+			/*
+			* @brief checks that the algorithms which did not time out found the same solution value (LB)
+			*		 in every repetition
+			* @param errorIdx: first repetition with different values, -1 if none
+			*/
+			bool consistent_sol_val(int& errorIdx)		const;
+
+			void clear();
+
+			/////////////
+			// I/O
+
+			/*
+			* @brief one line per algorithm - repetitions, fails, averages and counters
+			*/
+			std::ostream& print(std::ostream& o = std::cout)	const;
+
+			////////////////
+			// data members
+		private:
+			std::vector<std::vector<Result>> res_;						//[repetition][algorithm]
+
+			std::vector<double> steps_;
+			std::vector<double> lb_;
+			std::vector<double> ub_;
+			std::vector<double> time_;
+			std::vector<double> sdTime_;
+			std::vector<int> nFails_;
+			std::vector<std::vector<double>> counters_;					//[algorithm][counter]
+		};
+
+	}//end namespace com
+
+	using com::TestAnalyser;
+
+}//end namespace bitgraph
+
+#endif
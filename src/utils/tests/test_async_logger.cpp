@@ -0,0 +1,271 @@
+/**
+* @file test_async_logger.cpp
+* @brief Unit tests for the asynchronous logger (class AsyncLogger in async_logger.h), with the cost per log call
+*		 compared with the synchronous logger of logger.h
+* @details: ALOG_LEVEL is set to 1 (INFO) to check that disabled levels are removed at compile time
+* @details created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#define ALOG_LEVEL 1
+
+#include "gtest/gtest.h"
+#include "utils/async_logger.h"
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <iostream>
+#include <cstdio>
+#include <chrono>
+
+#ifdef __unix__
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <atomic>
+#endif
+
+using namespace std;
+using namespace bitgraph;
+using namespace bitgraph::com;
+
+namespace {
+
+	//larger than a record payload - formatted by the caller
+	struct bigArg {
+		int v[100];
+		friend std::ostream& operator<< (std::ostream& o, const bigArg& b) { return o << "big:" << b.v[0] << "," << b.v[99]; }
+	};
+
+	vector<string> split_lines(const string& str) {
+		vector<string> lines;
+		istringstream in(str);
+		string line;
+		while (getline(in, line)) { lines.push_back(line); }
+		return lines;
+	}
+}
+
+class AsyncLoggerTest : public ::testing::Test {
+protected:
+	void SetUp() override { AsyncLogger::instance().set_output(sstr); }
+	void TearDown() override { AsyncLogger::instance().set_output(std::cerr); }
+
+	stringstream sstr;
+};
+
+TEST(AsyncLogger, stored_arg) {
+
+	static_assert(std::is_same<_log::stored_arg<const char(&)[6]>::type, std::string>::value, "const buffer copied");
+	static_assert(std::is_same<_log::stored_arg<const char*&>::type, std::string>::value, "C string copied");
+	static_assert(std::is_same<_log::stored_arg<char*>::type, std::string>::value, "C string copied");
+	static_assert(std::is_same<_log::stored_arg<char(&)[6]>::type, std::string>::value, "mutable buffer copied");
+	static_assert(std::is_same<_log::stored_arg<const int&>::type, int>::value, "value");
+	EXPECT_TRUE((_log::fits_record<std::tuple<std::string, int, double>>::value));
+	EXPECT_FALSE((_log::fits_record<std::tuple<bigArg>>::value));
+}
+
+TEST_F(AsyncLoggerTest, writes_formatted_lines) {
+
+	ALOG_ERROR("error message", 42);
+	ALOG_WARNING("vector:", vector<int>{ 1, 2, 3 });
+	ALOG_FLUSH();
+
+	vector<string> lines = split_lines(sstr.str());
+	ASSERT_EQ(2, lines.size());
+	EXPECT_NE(string::npos, lines[0].find("ERROR: error message 42"));
+	EXPECT_NE(string::npos, lines[1].find("WARNING: vector: [ 1 2 3 ]"));
+	EXPECT_EQ('[', lines[0][0]);												//timestamp
+}
+
+TEST_F(AsyncLoggerTest, compile_time_levels) {
+
+	int n = 0;
+	ALOG_DEBUG("not evaluated", ++n);											//removed - ALOG_LEVEL 1
+	ALOG_INFO("evaluated", ++n);
+	ALOG_FLUSH();
+
+	EXPECT_EQ(1, n);
+	vector<string> lines = split_lines(sstr.str());
+	ASSERT_EQ(1, lines.size());
+	EXPECT_NE(string::npos, lines[0].find("INFO: evaluated 1"));
+}
+
+TEST_F(AsyncLoggerTest, copies_arguments) {
+
+	string name = "first";
+	ALOG_ERROR("name:", name.c_str(), name);									//formatted later by the logger thread
+	name = "second";
+
+	//a const char array which is not a literal
+	{
+		const char buf[] = { 'b', 'u', 'f', '\0' };
+		ALOG_ERROR("buffer:", buf);
+	}
+
+	bigArg b;
+	b.v[0] = 7;
+	b.v[99] = 9;
+	ALOG_ERROR(b);
+	ALOG_FLUSH();
+
+	vector<string> lines = split_lines(sstr.str());
+	ASSERT_EQ(3, lines.size());
+	EXPECT_NE(string::npos, lines[0].find("name: first first"));
+	EXPECT_NE(string::npos, lines[1].find("buffer: buf"));
+	EXPECT_NE(string::npos, lines[2].find("ERROR: big:7,9"));
+}
+
+TEST_F(AsyncLoggerTest, wakes_up_without_flush) {
+
+	//the logger thread sleeps with the rings empty - each record must wake it up
+	AsyncLogger& alog = AsyncLogger::instance();
+	for (int i = 0; i < 20; ++i) {
+		const uint64_t nWritten = alog.number_of_written();
+		ALOG_ERROR("record", i);
+
+		const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+		while (alog.number_of_written() == nWritten && std::chrono::steady_clock::now() < deadline) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(i % 3));
+		}
+		ASSERT_LT(nWritten, alog.number_of_written()) << "record " << i << " not written";
+	}
+}
+
+TEST_F(AsyncLoggerTest, threads_do_not_interleave) {
+
+	const int NUM_THREADS = 4;
+	const int NUM_MSG = 500;
+	vector<thread> vt;
+	for (int t = 0; t < NUM_THREADS; ++t) {
+		vt.emplace_back([t, NUM_MSG]() {
+			for (int i = 0; i < NUM_MSG; ++i) { ALOG_WARNING("thread", t, "msg", i, "end"); }
+			ALOG_FLUSH();
+		});
+	}
+	for (auto& th : vt) { th.join(); }
+	ALOG_FLUSH();
+
+	vector<string> lines = split_lines(sstr.str());
+	ASSERT_EQ(NUM_THREADS * NUM_MSG, lines.size());
+
+	//every line is complete, in order per thread
+	vector<int> next(NUM_THREADS, 0);
+	for (const auto& l : lines) {
+		const size_t pos = l.find("WARNING: thread ");
+		ASSERT_NE(string::npos, pos);
+		istringstream in(l.substr(pos + 16));
+		int t = -1, i = -1;
+		string msg, end;
+		in >> t >> msg >> i >> end;
+		ASSERT_TRUE(t >= 0 && t < NUM_THREADS);
+		EXPECT_EQ("end", end);
+		EXPECT_EQ(next[t]++, i);
+	}
+}
+
+#ifdef __unix__
+TEST_F(AsyncLoggerTest, fork) {
+
+	//another thread is logging when the process forks
+	std::atomic<bool> stop(false);
+	std::thread busy([&stop]() {
+		while (!stop.load()) { ALOG_INFO("parent"); }
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+	pid_t pid = ::fork();
+	ASSERT_NE(-1, pid);
+	if (pid == 0) {
+		//child: no logger thread - written synchronously, flush returns
+		sstr.str("");
+		ALOG_ERROR("child", 1);
+		ALOG_FLUSH();
+		::_exit(sstr.str().find("ERROR: child 1") != string::npos ? 0 : 1);
+	}
+
+	//the child must not hang on the lock or the thread of the parent
+	int status = 0;
+	pid_t r = 0;
+	for (auto i = 0; i < 500 && (r = ::waitpid(pid, &status, WNOHANG)) == 0; ++i) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	if (r == 0) {
+		::kill(pid, SIGKILL);
+		::waitpid(pid, &status, 0);
+	}
+	stop.store(true);
+	busy.join();
+
+	EXPECT_EQ(pid, r);
+	EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+	//the parent is not affected
+	ALOG_FLUSH();
+	sstr.str("");
+	ALOG_ERROR("parent", 2);
+	ALOG_FLUSH();
+	EXPECT_NE(string::npos, sstr.str().find("ERROR: parent 2"));
+}
+#endif
+
+TEST_F(AsyncLoggerTest, cost_per_call) {
+
+	const int NUM_BATCHES = 50;
+	const int BATCH = 1000;														//fits in a ring - nothing dropped
+	AsyncLogger& alog = AsyncLogger::instance();
+	const uint64_t nDropped = alog.number_of_dropped();
+
+	//asynchronous
+	uint64_t ticksAsync = 0;
+	for (int b = 0; b < NUM_BATCHES; ++b) {
+		const uint64_t t0 = CycleCounter::now();
+		for (int i = 0; i < BATCH; ++i) { ALOG_INFO("kcore iteration", i, "lb:", 3.5); }
+		ticksAsync += CycleCounter::now() - t0;
+		ALOG_FLUSH();
+	}
+	EXPECT_EQ(nDropped, alog.number_of_dropped());
+
+	//disabled level
+	uint64_t ticksOff = 0;
+	for (int b = 0; b < NUM_BATCHES; ++b) {
+		const uint64_t t0 = CycleCounter::now();
+		for (int i = 0; i < BATCH; ++i) { ALOG_DEBUG("kcore iteration", i, "lb:", 3.5); }
+		ticksOff += CycleCounter::now() - t0;
+	}
+
+	const double N = NUM_BATCHES * BATCH;
+	const double nsAsync = CycleCounter::to_seconds(ticksAsync) * 1e9 / N;
+	const double nsOff = CycleCounter::to_seconds(ticksOff) * 1e9 / N;
+	std::cout << "[ns per call] async: " << nsAsync << "\t disabled: " << nsOff;
+
+#ifdef __unix__
+	//synchronous logger.h (stderr to /dev/null - the header is written with fprintf)
+	std::fflush(stderr);
+	const int fdErr = ::dup(2);
+	const int fdNull = ::open("/dev/null", O_WRONLY);
+	::dup2(fdNull, 2);
+	stringstream sync;
+	streambuf* old = std::cerr.rdbuf(sync.rdbuf());
+	uint64_t ticksSync = 0;
+	for (int b = 0; b < NUM_BATCHES; ++b) {
+		const uint64_t t0 = CycleCounter::now();
+		for (int i = 0; i < BATCH; ++i) { _Info2("kcore iteration", i, "lb:", 3.5); }
+		ticksSync += CycleCounter::now() - t0;
+		sync.str("");
+	}
+	std::cerr.rdbuf(old);
+	std::fflush(stderr);
+	::dup2(fdErr, 2);
+	::close(fdErr);
+	::close(fdNull);
+
+	const double nsSync = CycleCounter::to_seconds(ticksSync) * 1e9 / N;
+	std::cout << "\t sync (logy): " << nsSync;
+	EXPECT_LT(nsAsync, nsSync);
+#endif
+	std::cout << std::endl;
+}
@@ -1,8 +1,17 @@
 #include "gtest/gtest.h"
 #include "utils/batch.h"
 #include "utils/logger.h"
+#include "utils/thread_pool.h"
+#include "utils/async_logger.h"
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <sstream>
+#include <stdexcept>
+#include <cstdlib>
 
 using namespace std;
+using namespace bitgraph;
 
 //configuration data for the hierarchy of algorithms
 struct param_t{
@@ -73,3 +82,190 @@ TEST(Batch, basic){
 
 }
 
+
+//algorithm with a behavior chosen by i_ - j_ is a duration (ms) or a size (MB)
+class AlgWork : public AlgBase {
+public:
+	enum { SLEEP = 0, THROW, CRASH, ALLOC, THROW_INT, PARALLEL };
+	using AlgBase::AlgBase;
+	param_t start() override {
+		switch (result_.i_) {
+		case THROW:
+			throw std::runtime_error("AlgWork");
+		case THROW_INT:
+			throw result_.j_;
+		case PARALLEL: {
+			//global pool and asynchronous logger - also in a forked test
+			std::atomic<int> n(0);
+			com::run_parallel(8, [&n](int t) { n += t; });
+			if (n.load() != 28) { throw std::logic_error("AlgWork - run_parallel"); }
+			ALOG_FLUSH();
+			break;
+		}
+		case CRASH:
+			std::abort();
+		case ALLOC: {
+			std::vector<char> mem(static_cast<std::size_t>(result_.j_) << 20, 1);
+			result_.j_ = mem[mem.size() / 2];
+			break;
+		}
+		default:
+			std::this_thread::sleep_for(std::chrono::milliseconds(result_.j_));
+		}
+#ifdef BATCH_POSIX
+		cpu_ = sched_getcpu();
+#endif
+		return result_;
+	}
+	int cpu_ = -1;
+};
+
+TEST(Batch, parallel) {
+
+	Batch<AlgWork, param_t> b;
+	for (auto i = 0; i < 8; i++) {
+		b.add_test(param_t{ AlgWork::SLEEP, 100 });
+	}
+
+	paramBatch p;
+	p.nThreads = 4;
+
+	//////////////////////////////////////
+	EXPECT_EQ(8, b.run_all_tests_parallel(p));
+	//////////////////////////////////////
+
+	const infoBatch& info = b.info();
+	EXPECT_EQ(8, info.number_of_tests());
+	EXPECT_EQ(4, info.number_of_threads());
+	EXPECT_EQ(8, info.number_of(infoTest::OK));
+	for (auto i = 0; i < 8; i++) {
+		EXPECT_EQ(i, info.tests_[i].id_);
+		EXPECT_LE(0, info.tests_[i].worker_);
+		EXPECT_GT(4, info.tests_[i].worker_);
+		EXPECT_LE(0.1, info.tests_[i].search_time());
+	}
+
+	//sleeping tests overlap
+	EXPECT_LE(0.8, info.total_test_time());
+	EXPECT_GT(0.6, info.search_time());
+
+	std::ostringstream oss;
+	info.printReport(oss);
+	EXPECT_NE(std::string::npos, oss.str().find("OK:8"));
+}
+
+TEST(Batch, inline_errors) {
+
+	Batch<AlgWork, param_t> b;
+	b.add_test(param_t{ AlgWork::THROW, 0 });
+	b.add_test(param_t{ AlgWork::SLEEP, 300 });
+	b.add_test(param_t{ AlgWork::SLEEP, 0 });
+	b.add_test(param_t{ AlgWork::THROW_INT, 5 });
+
+	paramBatch p;
+	p.nThreads = 2;
+	p.TIME_OUT = 0.1;
+	EXPECT_EQ(1, b.run_all_tests_parallel(p));
+
+	//threads are not stopped - the time-out is reported
+	EXPECT_EQ(infoTest::FAILED, b.info().tests_[0].status_);
+	EXPECT_EQ(infoTest::TIME_OUT, b.info().tests_[1].status_);
+	EXPECT_EQ(infoTest::OK, b.info().tests_[2].status_);
+	EXPECT_LE(0.3, b.info().tests_[1].search_time());
+	EXPECT_EQ(infoTest::FAILED, b.info().tests_[3].status_);				//not a std::exception
+}
+
+#ifdef BATCH_POSIX
+
+TEST(Batch, isolation) {
+
+	Batch<AlgWork, param_t> b;
+	b.add_test(param_t{ AlgWork::CRASH, 0 });
+	b.add_test(param_t{ AlgWork::SLEEP, 5000 });
+	b.add_test(param_t{ AlgWork::ALLOC, 1024 });
+	b.add_test(param_t{ AlgWork::THROW, 0 });
+	b.add_test(param_t{ AlgWork::ALLOC, 16 });
+
+	paramBatch p;
+	p.nThreads = 3;
+	p.TIME_OUT = 0.2;
+	p.isolate = true;
+	p.MEM_LIMIT = std::size_t(512) << 20;
+
+	//////////////////////////////////////
+	EXPECT_EQ(1, b.run_all_tests_parallel(p));
+	//////////////////////////////////////
+
+	const infoBatch& info = b.info();
+	EXPECT_EQ(infoTest::CRASHED, info.tests_[0].status_);
+	EXPECT_EQ(SIGABRT, info.tests_[0].signal_);
+
+	//killed on time-out
+	EXPECT_EQ(infoTest::TIME_OUT, info.tests_[1].status_);
+	EXPECT_GT(2.0, info.tests_[1].search_time());
+
+	//bad_alloc beyond the memory limit
+	EXPECT_EQ(infoTest::FAILED, info.tests_[2].status_);
+	EXPECT_NE(0, info.tests_[2].exitCode_);
+	EXPECT_EQ(infoTest::FAILED, info.tests_[3].status_);
+
+	EXPECT_EQ(infoTest::OK, info.tests_[4].status_);
+	EXPECT_LE(16 * 1024, info.tests_[4].maxRSS_);
+
+	//the test objects are not modified by forked tests
+	EXPECT_EQ(16, b.get_test(4)->data().j_);
+}
+
+TEST(Batch, isolation_with_threads) {
+
+	//the global pool is busy and the logger thread is running when the tests are forked
+	AsyncLogger::instance();
+	std::atomic<bool> stop(false);
+	std::thread busy([&stop]() {
+		while (!stop.load()) {
+			com::run_parallel(4, [](int) { std::this_thread::sleep_for(std::chrono::microseconds(100)); });
+		}
+	});
+
+	Batch<AlgWork, param_t> b;
+	for (auto i = 0; i < 8; i++) {
+		b.add_test(param_t{ AlgWork::PARALLEL, 0 });
+	}
+
+	paramBatch p;
+	p.nThreads = 4;
+	p.TIME_OUT = 10;
+	p.isolate = true;
+	EXPECT_EQ(8, b.run_all_tests_parallel(p));
+
+	stop.store(true);
+	busy.join();
+
+	//the parent is not affected
+	std::atomic<int> n(0);
+	com::run_parallel(8, [&n](int t) { n += t; });
+	EXPECT_EQ(28, n.load());
+}
+
+TEST(Batch, pinning) {
+
+	Batch<AlgWork, param_t> b;
+	for (auto i = 0; i < 4; i++) {
+		b.add_test(param_t{ AlgWork::SLEEP, 10 });
+	}
+
+	paramBatch p;
+	p.nThreads = 2;
+	p.pin = true;
+	EXPECT_EQ(4, b.run_all_tests_parallel(p));
+
+	//each test ran on the CPU of its worker
+	const int nCpu = static_cast<int>(std::thread::hardware_concurrency());
+	for (auto i = 0; i < 4; i++) {
+		const infoTest& t = b.info().tests_[i];
+		EXPECT_EQ(t.worker_ % nCpu, t.cpu_);
+		EXPECT_EQ(t.cpu_, b.get_test(i)->cpu_);
+	}
+}
+
+#endif
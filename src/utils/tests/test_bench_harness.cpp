@@ -0,0 +1,169 @@
+/**
+* @file test_bench_harness.cpp
+* @brief Unit tests for the statistical benchmarking harness (class BenchHarness in bench_harness.h)
+* @details created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#include "gtest/gtest.h"
+#include "utils/bench_harness.h"
+#include <sstream>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	//Benchmark has a protected constructor
+	class Bk : public Benchmark {
+	public:
+		explicit Bk(string path) : Benchmark(path) {}
+	};
+
+	int busy_work(int n) {
+		volatile int acc = 0;
+		for (auto i = 0; i < n; ++i) { acc = acc + (i & 7); }
+		return 7;
+	}
+}
+
+TEST(BenchHarness, stats) {
+
+	stats_t s = stats_t::compute({ 5, 1, 4, 2, 3 });
+
+	EXPECT_EQ(5, s.n);
+	EXPECT_DOUBLE_EQ(3, s.mean);
+	EXPECT_DOUBLE_EQ(1, s.min);
+	EXPECT_DOUBLE_EQ(5, s.max);
+	EXPECT_DOUBLE_EQ(3, s.median);
+	EXPECT_DOUBLE_EQ(4.6, s.p90);								//linear interpolation between 4 and 5
+	EXPECT_NEAR(1.414213, s.stddev, 1e-5);						//population standard deviation
+
+	stats_t e = stats_t::compute({});
+	EXPECT_EQ(0, e.n);
+	EXPECT_DOUBLE_EQ(0, e.median);
+}
+
+TEST(BenchHarness, run_and_correctness) {
+
+	BenchHarness bh(4, 2);
+	int nCalls = 0;
+
+	const benchRecord& r = bh.run("g1", "alg", [&nCalls]() { ++nCalls; return busy_work(10000); }, 7);
+
+	EXPECT_EQ(6, nCalls);										//2 warm-up + 4 measured
+	EXPECT_EQ(4, r.wall.n);
+	EXPECT_EQ(4, r.cpu.n);
+	EXPECT_TRUE(r.correct);
+	EXPECT_EQ(7, r.value);
+	EXPECT_LE(r.wall.min, r.wall.median);
+	EXPECT_LE(r.wall.median, r.wall.max);
+
+	//wrong expected value
+	bh.run("g2", "alg", []() { return busy_work(100); }, 8);
+	EXPECT_EQ(1, bh.number_of_incorrect());
+
+	//no expected value - not checked
+	bh.run("g3", "alg", []() { return busy_work(100); });
+	EXPECT_EQ(1, bh.number_of_incorrect());
+	EXPECT_EQ(3, bh.records().size());
+}
+
+TEST(BenchHarness, run_benchmark) {
+
+	Bk b("");
+	b.add_test("a.clq", 7);
+	b.add_test("b.clq", 3);
+	b.add_test("c.clq");										//no stored value
+
+	BenchHarness bh(2, 0);
+	int nWrong = bh.run(b, "alg", [](const string&) { return busy_work(100); });
+
+	EXPECT_EQ(1, nWrong);										//b.clq
+	ASSERT_EQ(3, bh.records().size());
+	EXPECT_TRUE(bh.records()[0].correct);
+	EXPECT_FALSE(bh.records()[1].correct);
+	EXPECT_TRUE(bh.records()[2].correct);
+}
+
+TEST(BenchHarness, csv_round_trip) {
+
+	BenchHarness bh(3, 0);
+	bh.run("dir/g \"1\",x", "alg", []() { return busy_work(1000); }, 7);
+	bh.run("g2", "alg", []() { return busy_work(1000); });
+
+	stringstream sstr;
+	bh.write_csv(sstr);
+
+	vector<benchRecord> base;
+	ASSERT_EQ(2, BenchHarness::read_csv(sstr, base));
+	EXPECT_EQ("dir/g \"1\",x", base[0].instance);
+	EXPECT_EQ("alg", base[0].alg);
+	EXPECT_EQ(7, base[0].expected);
+	EXPECT_TRUE(base[0].correct);
+	EXPECT_EQ(3, base[0].wall.n);
+	EXPECT_NEAR(bh.records()[0].wall.median, base[0].wall.median, 1e-8);
+	EXPECT_EQ(-1, base[1].expected);
+
+	//malformed baseline
+	stringstream bad("header\n\"g\",alg,1\n");
+	EXPECT_EQ(-1, BenchHarness::read_csv(bad, base));
+
+	//non-numeric field in a record with the right number of fields
+	string badNum = sstr.str();
+	badNum.replace(badNum.find(",7,7,"), 5, ",x,7,");
+	stringstream badNumIn(badNum);
+	EXPECT_EQ(-1, BenchHarness::read_csv(badNumIn, base));
+	EXPECT_TRUE(base.empty());
+
+	//JSON - one object per record
+	stringstream json;
+	bh.write_json(json);
+	EXPECT_NE(string::npos, json.str().find("\"instance\": \"dir/g \\\"1\\\",x\""));
+	EXPECT_NE(string::npos, json.str().find("\"wall\": {\"n\": 3"));
+}
+
+TEST(BenchHarness, json_escapes) {
+
+	BenchHarness bh(1, 0);
+	bh.run("g\t1\n", "alg", []() { return busy_work(10); });
+
+	stringstream json;
+	bh.write_json(json);
+	EXPECT_NE(string::npos, json.str().find("\"instance\": \"g\\u00091\\u000a\""));
+
+}
+
+TEST(BenchHarness, compare_with_baseline) {
+
+	BenchHarness bh(3, 0);
+	bh.run("g1", "alg", []() { return 1; });
+	bh.run("g2", "alg", []() { return 1; });
+	bh.run("g3", "alg", []() { return 1; });
+
+	//baseline built by hand - current times are far below 1s
+	vector<benchRecord> base(2);
+	base[0].instance = "g1"; base[0].alg = "alg";
+	base[0].wall.median = 1.0;									//current run much faster
+	base[1].instance = "g2"; base[1].alg = "alg";
+	base[1].wall.median = 1e-12;								//current run much slower
+
+	vector<regression_t> cmp = bh.compare(base);
+	ASSERT_EQ(3, cmp.size());
+	EXPECT_EQ(regression_t::IMPROVED, cmp[0].flag);
+	EXPECT_EQ(regression_t::REGRESSED, cmp[1].flag);
+	EXPECT_EQ(regression_t::NEW, cmp[2].flag);
+	EXPECT_EQ(1, BenchHarness::number_of_regressions(cmp));
+
+	//a noisy baseline hides the difference
+	base[1].wall.stddev = 10.0;
+	cmp = bh.compare(base);
+	EXPECT_EQ(regression_t::SAME, cmp[1].flag);
+	EXPECT_EQ(0, BenchHarness::number_of_regressions(cmp));
+
+	//same records - no change
+	cmp = bh.compare(bh.records());
+	EXPECT_EQ(regression_t::SAME, cmp[0].flag);
+	EXPECT_STREQ("SAME", regression_t::to_string(cmp[0].flag));
+}
@@ -0,0 +1,202 @@
+/**
+* @file test_perf_counters.cpp
+* @brief Unit tests for hardware performance counters (class PerfCounters in perf_counters.h) and their
+*		 use in infoBase and BenchHarness
+* @details: tests which need real counters are skipped where perf events are not available (containers,
+*			perf_event_paranoid)
+* @details created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#include "gtest/gtest.h"
+#include "utils/perf_counters.h"
+#include "utils/info/info_base.h"
+#include "utils/bench_harness.h"
+#include <sstream>
+#include <vector>
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	int busy_work(int n) {
+		volatile int acc = 0;
+		for (auto i = 0; i < n; ++i) {
+			if (i % 3 == 0) { acc = acc + (i & 7); }
+		}
+		return 7;
+	}
+}
+
+TEST(perfSample, ratios) {
+
+	perfSample s;
+	EXPECT_TRUE(s.empty());
+	EXPECT_DOUBLE_EQ(-1, s.ipc());
+
+	s.valid[perfSample::CYCLES] = s.valid[perfSample::INSTRUCTIONS] = true;
+	s.value[perfSample::CYCLES] = 200;
+	s.value[perfSample::INSTRUCTIONS] = 300;
+	EXPECT_FALSE(s.empty());
+	EXPECT_DOUBLE_EQ(1.5, s.ipc());
+	EXPECT_DOUBLE_EQ(-1, s.cache_miss_rate());					//not measured
+
+	perfSample d = s - s;
+	EXPECT_TRUE(d.valid[perfSample::CYCLES]);
+	EXPECT_DOUBLE_EQ(0, d.value[perfSample::CYCLES]);
+	EXPECT_DOUBLE_EQ(-1, d.ipc());								//no cycles
+
+	d += s;
+	d += s;
+	d /= 2;
+	EXPECT_DOUBLE_EQ(200, d.value[perfSample::CYCLES]);
+	EXPECT_DOUBLE_EQ(1.5, d.ipc());
+}
+
+TEST(PerfCounters, degrades_gracefully) {
+
+	PerfCounters pc;
+	perfSample s = pc.read();
+
+	for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+		auto ev = static_cast<perfSample::event_t>(e);
+		EXPECT_EQ(pc.available(ev), s.is_valid(ev));
+		EXPECT_GE(s.value[e], 0);
+	}
+	EXPECT_EQ(pc.available(), !s.empty());
+
+	//no-ops if not available
+	pc.stop();
+	pc.reset();
+	pc.start();
+}
+
+TEST(PerfCounters, counts_work) {
+
+	PerfCounters pc;
+	if (!pc.available(perfSample::INSTRUCTIONS)) {
+		GTEST_SKIP() << "hardware counters not available: " << pc.status();
+	}
+
+	perfSample s0 = pc.read();
+	busy_work(1000000);
+	perfSample d = pc.read() - s0;
+
+	EXPECT_GT(d.value[perfSample::INSTRUCTIONS], 1000000);
+	if (pc.available(perfSample::BRANCHES)) {
+		EXPECT_GT(d.value[perfSample::BRANCHES], 1000000);
+	}
+}
+
+TEST(PerfCounters, info_base_phases) {
+
+	infoBase info;
+	EXPECT_FALSE(info.perf_counters_enabled());
+
+	const bool isAvailable = info.enablePerfCounters();
+	EXPECT_TRUE(info.perf_counters_enabled());
+
+	info.startTimer(infoBase::phase_t::SEARCH);
+	busy_work(1000000);
+	info.readTimer(infoBase::phase_t::SEARCH);
+
+	const perfSample& ps = info.perf_counters(infoBase::phase_t::SEARCH);
+	EXPECT_EQ(isAvailable, !ps.empty());
+	EXPECT_TRUE(info.perf_counters(infoBase::phase_t::PARSE).empty() || isAvailable);
+
+	std::stringstream sstr;
+	info.printTimers(sstr);
+	EXPECT_NE(string::npos, sstr.str().find(isAvailable ? "perf_search" : "not available"));
+
+	info.clearTimer(infoBase::phase_t::SEARCH);
+	EXPECT_TRUE(info.perf_counters(infoBase::phase_t::SEARCH).empty());
+
+	info.enablePerfCounters(false);
+	EXPECT_FALSE(info.perf_counters_enabled());
+}
+
+TEST(PerfCounters, parallel_runs_not_measured) {
+
+	//workers of the pool are not counted
+	infoBase info;
+	info.number_of_threads(4);
+	EXPECT_FALSE(info.enablePerfCounters());
+	EXPECT_TRUE(info.perf_counters_enabled());
+
+	info.startTimer(infoBase::phase_t::SEARCH);
+	busy_work(100000);
+	info.readTimer(infoBase::phase_t::SEARCH);
+	EXPECT_TRUE(info.perf_counters(infoBase::phase_t::SEARCH).empty());
+
+	std::stringstream sstr;
+	info.printTimers(sstr);
+	EXPECT_NE(string::npos, sstr.str().find("not available"));
+
+	BenchHarness bh(2, 0);
+	bh.number_of_threads(0);
+	EXPECT_FALSE(bh.perf_counters(true));
+	bh.run("inst1", "alg", []() { return busy_work(100000); });
+	EXPECT_TRUE(bh.records().back().perf.empty());
+
+	bh.number_of_threads(1);
+	EXPECT_EQ(bh.perf_counters(true), bh.perf_counters());
+}
+
+TEST(PerfCounters, info_base_copies) {
+
+	infoBase info;
+	const bool isAvailable = info.enablePerfCounters();
+
+	info.startTimer(infoBase::phase_t::SEARCH);
+	busy_work(100000);
+	info.readTimer(infoBase::phase_t::SEARCH);
+
+	//copies are disabled, with the samples of finished phases
+	infoBase info2(info);
+	EXPECT_FALSE(info2.perf_counters_enabled());
+	EXPECT_EQ(nullptr, info2.perf_.get());
+	EXPECT_EQ(isAvailable, !info2.perf_counters(infoBase::phase_t::SEARCH).empty());
+
+	infoBase info3;
+	info3.enablePerfCounters();
+	info3 = info;
+	EXPECT_FALSE(info3.perf_counters_enabled());
+	EXPECT_TRUE(info.perf_counters_enabled());
+
+	//enabled again in the copy - its own counters
+	EXPECT_EQ(isAvailable, info2.enablePerfCounters());
+	EXPECT_NE(info.perf_.get(), info2.perf_.get());
+	info2.startTimer(infoBase::phase_t::SEARCH);
+	busy_work(100000);
+	info2.readTimer(infoBase::phase_t::SEARCH);
+	EXPECT_EQ(isAvailable, !info2.perf_counters(infoBase::phase_t::SEARCH).empty());
+}
+
+TEST(PerfCounters, bench_harness_records) {
+
+	BenchHarness bh(3, 0);
+	const bool isAvailable = bh.perf_counters(true);
+	EXPECT_EQ(isAvailable, bh.perf_counters());
+
+	bh.run("inst1", "alg", []() { return busy_work(100000); });
+	EXPECT_EQ(isAvailable, !bh.records().back().perf.empty());
+
+	//perf columns survive a CSV round trip
+	std::stringstream sstr;
+	bh.write_csv(sstr);
+	vector<benchRecord> base;
+	ASSERT_EQ(1, BenchHarness::read_csv(sstr, base));
+	for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) {
+		EXPECT_EQ(bh.records().back().perf.valid[e], base[0].perf.valid[e]);
+	}
+
+	//baselines without the perf columns are rejected
+	string line = sstr.str();
+	const size_t pos = line.find(",perf_");
+	ASSERT_NE(string::npos, pos);
+	string rec = line.substr(line.find('\n') + 1);
+	for (auto e = 0; e < perfSample::NUM_EVENTS; ++e) { rec.erase(rec.rfind(',')); }
+	std::stringstream oldRec(line.substr(0, pos) + "\n" + rec + "\n");
+	EXPECT_EQ(-1, BenchHarness::read_csv(oldRec, base));
+}
@@ -9,6 +9,9 @@
 #include "../prec_timer.h"
 #include <math.h>
 #include <thread> // for std::this_thread::sleep_for
+#include <vector>
+#include <atomic>
+#include <string>
 
 
 using namespace std;
@@ -46,4 +49,98 @@ TEST_F(PrecisionTimerTest, LocalTimestampWithoutDate) {
 	EXPECT_FALSE(timestamp.empty());              // Ensure it's not empty
 }
 
+//sleeping does not consume CPU time, busy threads add up
+TEST_F(PrecisionTimerTest, CpuTimeIsNotWallTime) {
+	timer.cpu_tic();
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	EXPECT_LT(timer.cpu_toc(), 0.05);
 
+	timer.wall_tic();
+	timer.cpu_tic();
+	std::vector<std::thread> vt;
+	for (int t = 0; t < 2; ++t) {
+		vt.emplace_back([] {
+			PrecisionTimer pt;
+			pt.thread_tic();
+			volatile double x = 0;
+			while (pt.thread_toc() < 0.05) { x = x + 1.0; }
+		});
+	}
+	for (auto& th : vt) { th.join(); }
+	EXPECT_GE(timer.cpu_toc(), 0.1);
+	EXPECT_GE(timer.wall_toc(), 0.05);
+}
+
+TEST_F(PrecisionTimerTest, ThreadTimeMeasurement) {
+	timer.thread_tic();
+	volatile double x = 0;
+	for (int i = 0; i < 1000000; ++i) { x = x + 1.0; }
+	double elapsed = timer.thread_toc();
+	EXPECT_GT(elapsed, 0.0);
+	EXPECT_LT(elapsed, 10.0);
+}
+
+TEST(CycleCounterTest, Calibration) {
+	EXPECT_GT(CycleCounter::ticks_per_second(), 1e6);
+
+	CycleCounter cc;
+	cc.tic();
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	double sec = cc.toc_seconds();
+	EXPECT_GE(sec, 0.015);
+	EXPECT_LT(sec, 1.0);
+}
+
+TEST(TimerSlotsTest, ScopedTimerAccumulates) {
+	TimerSlots ts;
+	int id = ts.slot("sleep");
+	EXPECT_EQ(id, ts.slot("sleep"));
+	EXPECT_EQ(1, ts.number_of_slots());
+
+	for (int i = 0; i < 3; ++i) {
+		ScopedTimer st(id, ts);
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+	EXPECT_EQ(3u, ts.calls(id));
+	EXPECT_GE(ts.seconds(id), 0.012);
+
+	ts.reset();
+	EXPECT_EQ(0u, ts.calls(id));
+	EXPECT_EQ(0u, ts.ticks(id));
+}
+
+TEST(TimerSlotsTest, GlobalMacro) {
+	for (int i = 0; i < 4; ++i) {
+		SCOPED_TIMER("test_global_macro");
+	}
+	TimerSlots& ts = TimerSlots::instance();
+	int id = ts.slot("test_global_macro");
+	EXPECT_EQ(4u, ts.calls(id));
+	EXPECT_EQ("test_global_macro", ts.name(id));
+}
+
+TEST(TimerSlotsTest, ConcurrentRegistration) {
+	TimerSlots ts;
+	std::atomic<bool> done(false);
+	std::thread reader([&]() {
+		while (!done.load()) {
+			const int n = ts.number_of_slots();
+			for (int i = 0; i < n; ++i) {
+				ASSERT_EQ('s', ts.name(i)[0]);										//name written before it is published
+			}
+		}
+	});
+
+	std::vector<std::thread> vt;
+	for (int t = 0; t < 4; ++t) {
+		vt.emplace_back([&ts, t]() {
+			for (int i = 0; i < 16; ++i) { ts.slot("slot" + std::to_string(t * 16 + i)); }
+		});
+	}
+	for (auto& th : vt) { th.join(); }
+	done.store(true);
+	reader.join();
+
+	EXPECT_EQ(64, ts.number_of_slots());
+	EXPECT_EQ(-1, ts.slot("full"));
+}
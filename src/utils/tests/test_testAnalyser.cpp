@@ -12,8 +12,12 @@
 #include "utils/test_analyser.h"
 #include "utils/file.h"
 #include <thread>
+#ifdef __linux__
+#include <unistd.h>
+#endif
 
 using namespace std;
+using namespace bitgraph;
 
 #define NUM_REP	5
 #define NUM_ALG	2
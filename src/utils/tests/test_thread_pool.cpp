@@ -0,0 +1,244 @@
+/**
+* @file test_thread_pool.cpp
+* @brief Unit tests for the work-stealing thread pool (classes ThreadPool, TaskGroup, TaskFuture)
+* @details created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#include "gtest/gtest.h"
+#include "utils/thread_pool.h"
+#include "utils/prec_timer.h"
+#include <atomic>
+#include <chrono>
+#include <vector>
+#include <numeric>
+#include <stdexcept>
+
+#ifdef __unix__
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace bitgraph;
+
+namespace {
+
+	//recursive fibonacci - every call waits for a nested task
+	long long fib(ThreadPool& pool, int n) {
+		if (n < 12) { return (n < 2) ? n : fib(pool, n - 1) + fib(pool, n - 2); }
+		auto fut = com::async(pool, fib, std::ref(pool), n - 1);
+		long long b = fib(pool, n - 2);
+		return fut.get() + b;
+	}
+
+	//bitset with blocks, for parallel_for_blocks
+	struct Blocks {
+		int number_of_blocks() const { return 1000; }
+	};
+}
+
+TEST(ThreadPool, task_group) {
+
+	ThreadPool pool(3);
+	EXPECT_EQ(3, pool.number_of_workers());
+	EXPECT_EQ(-1, pool.worker_id());
+
+	std::atomic<int> cnt(0);
+	std::atomic<int> outside(0);
+	TaskGroup tg(pool);
+	for (auto i = 0; i < 10000; ++i) {
+		tg.run([&]() {
+			++cnt;
+			const int id = pool.worker_id();
+			if (id < -1 || id >= 3) { ++outside; }
+		});
+	}
+	tg.wait();
+
+	EXPECT_EQ(10000, cnt.load());
+	EXPECT_EQ(0, outside.load());
+	EXPECT_EQ(0, pool.number_of_pending());
+}
+
+TEST(ThreadPool, nested_futures) {
+
+	//more nested waits than workers - waiting threads run pending tasks
+	ThreadPool pool(2);
+	EXPECT_EQ(6765, fib(pool, 20));
+
+	//void future
+	std::atomic<int> x(0);
+	auto fut = com::async(pool, [&x]() { x.store(5); });
+	fut.get();
+	EXPECT_EQ(5, x.load());
+	EXPECT_FALSE(fut.valid());
+}
+
+TEST(ThreadPool, parallel_for) {
+
+	ThreadPool pool(2);
+
+	//every index exactly once
+	const int N = 100000;
+	std::vector<std::atomic<int>> seen(N);
+	for (auto& s : seen) { s.store(0); }
+	pool.parallel_for(0, N, 64, [&](int i) { ++seen[i]; });
+	for (auto i = 0; i < N; ++i) {
+		ASSERT_EQ(1, seen[i].load());
+	}
+
+	//ranges of at most grain elements cover the whole range
+	std::atomic<long long> sum(0);
+	std::atomic<int> maxLen(0);
+	pool.parallel_for_range(10, 1010, 7, [&](int b, int e) {
+		long long s = 0;
+		for (auto i = b; i < e; ++i) { s += i; }
+		sum += s;
+		int m = maxLen.load();
+		while (e - b > m && !maxLen.compare_exchange_weak(m, e - b)) {}
+	});
+	EXPECT_EQ(509500, sum.load());
+	EXPECT_GE(7, maxLen.load());
+
+	//tiles of bitblocks
+	std::atomic<int> nBlocks(0);
+	pool.parallel_for_blocks(Blocks(), 64, [&](int b, int e) { nBlocks += e - b; });
+	EXPECT_EQ(1000, nBlocks.load());
+
+	//empty range
+	pool.parallel_for(5, 5, 1, [&](int) { ADD_FAILURE(); });
+
+	//one call per thread index
+	std::vector<int> calls(5, 0);
+	pool.run(5, [&](int t) { ++calls[t]; });
+	EXPECT_EQ(vector<int>(5, 1), calls);
+}
+
+TEST(ThreadPool, cancel) {
+
+	ThreadPool pool(1);
+
+	//the only worker is blocked until the tasks are canceled
+	std::atomic<bool> go(false);
+	std::atomic<int> cnt(0);
+	auto blocker = com::async(pool, [&go]() { while (!go.load()) { std::this_thread::yield(); } });
+	while (pool.number_of_pending() > 0) { std::this_thread::yield(); }
+
+	TaskGroup tg(pool);
+	for (auto i = 0; i < 100; ++i) {
+		tg.run([&cnt]() { ++cnt; });
+	}
+	tg.cancel();
+	EXPECT_TRUE(tg.is_canceled());
+	go.store(true);
+	tg.wait();
+	blocker.get();
+
+	EXPECT_EQ(0, cnt.load());
+}
+
+TEST(ThreadPool, exceptions) {
+
+	ThreadPool pool(2);
+
+	TaskGroup tg(pool);
+	tg.run([]() { throw std::runtime_error("task"); });
+	tg.run([]() {});
+	EXPECT_THROW(tg.wait(), std::runtime_error);
+
+	auto fut = com::async(pool, [](int a) -> int { if (a > 0) { throw std::logic_error("future"); } return a; }, 1);
+	EXPECT_THROW(fut.get(), std::logic_error);
+
+	auto fut2 = com::async(pool, [](int a, int b) { return a + b; }, 2, 3);
+	EXPECT_EQ(5, fut2.get());
+}
+
+TEST(ThreadPool, blocking_wait) {
+
+	//the waiting thread blocks instead of spinning while the only task sleeps
+	ThreadPool pool(1);
+	std::atomic<bool> started(false);
+	TaskGroup tg(pool);
+	tg.run([&started]() {
+		started.store(true);
+		std::this_thread::sleep_for(std::chrono::milliseconds(300));
+	});
+	while (!started.load()) { std::this_thread::yield(); }
+
+	const double t0 = PrecisionTimer::thread_cpu_time();
+	tg.wait();
+	EXPECT_LT(PrecisionTimer::thread_cpu_time() - t0, 0.1);
+
+	//futures
+	auto fut = com::async(pool, []() { std::this_thread::sleep_for(std::chrono::milliseconds(50)); return 3; });
+	EXPECT_EQ(3, fut.get());
+
+	//woken up to run a task submitted while it waits
+	TaskGroup tg2(pool);
+	std::atomic<int> x(0);
+	tg2.run([&]() {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		tg2.run([&x]() { x.store(7); });							//the only worker is busy - run by the waiter
+		while (x.load() == 0) { std::this_thread::yield(); }
+	});
+	tg2.wait();
+	EXPECT_EQ(7, x.load());
+}
+
+TEST(ThreadPool, global_pool) {
+
+	ThreadPool& pool = ThreadPool::instance();
+	EXPECT_EQ(&pool, &ThreadPool::instance());
+	EXPECT_LE(1, pool.number_of_workers());
+
+	std::atomic<int> cnt(0);
+	com::run_parallel(4, [&cnt](int t) { cnt += t; });
+	EXPECT_EQ(6, cnt.load());
+}
+
+#ifdef __unix__
+TEST(ThreadPool, fork) {
+
+	//the global pool is busy when the process forks
+	std::atomic<bool> stop(false);
+	std::thread busy([&stop]() {
+		while (!stop.load()) {
+			com::run_parallel(4, [](int) { std::this_thread::sleep_for(std::chrono::microseconds(100)); });
+		}
+	});
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+	pid_t pid = ::fork();
+	ASSERT_NE(-1, pid);
+	if (pid == 0) {
+		//child: no workers - tasks are run by the waiting thread
+		std::atomic<int> cnt(0);
+		com::run_parallel(8, [&cnt](int t) { cnt += t; });
+		::_exit(cnt.load() == 28 ? 0 : 1);
+	}
+
+	//the child must not hang on the locks or workers of the parent
+	int status = 0;
+	pid_t r = 0;
+	for (auto i = 0; i < 500 && (r = ::waitpid(pid, &status, WNOHANG)) == 0; ++i) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	}
+	if (r == 0) {
+		::kill(pid, SIGKILL);
+		::waitpid(pid, &status, 0);
+	}
+	stop.store(true);
+	busy.join();
+
+	EXPECT_EQ(pid, r);
+	EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+	//the parent is not affected
+	std::atomic<int> cnt(0);
+	com::run_parallel(8, [&cnt](int t) { cnt += t; });
+	EXPECT_EQ(28, cnt.load());
+}
+#endif
@@ -0,0 +1,236 @@
+/**
+ * @file thread_pool.cpp
+ * @brief implementation of the work-stealing ThreadPool and TaskGroup classes in thread_pool.h
+ * @details: created 17/10/2026, last_update 17/10/2026
+ * @dev pss
+ **/
+
+#include "thread_pool.h"
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#define THREAD_POOL_ATFORK
+#endif
+
+namespace bitgraph {
+
+	namespace com {
+
+		thread_local ThreadPool* ThreadPool::tlPool_ = nullptr;
+		thread_local int ThreadPool::tlId_ = -1;
+
+		void ThreadPool::Queue::acquire()
+		{
+			int nSpin = 0;
+			while (lock_.test_and_set(std::memory_order_acquire)) {
+				if (++nSpin > 64) {
+					std::this_thread::yield();
+					nSpin = 0;
+				}
+			}
+		}
+
+		ThreadPool::ThreadPool(int nWorkers) :
+			nPending_(0), nSleeping_(0), next_(0), stop_(false), nWaiting_(0)
+		{
+			if (nWorkers <= 0) {
+				nWorkers = static_cast<int>(std::thread::hardware_concurrency());
+			}
+			nWorkers = std::max(nWorkers, 1);
+
+			queues_.reserve(nWorkers);
+			for (auto i = 0; i < nWorkers; ++i) {
+				queues_.emplace_back(new Queue());
+			}
+
+			workers_.reserve(nWorkers);
+			for (auto i = 0; i < nWorkers; ++i) {
+				workers_.emplace_back(&ThreadPool::work, this, i);
+			}
+		}
+
+		ThreadPool::~ThreadPool()
+		{
+			{
+				std::lock_guard<std::mutex> lck(mtx_);
+				stop_.store(true);
+			}
+			cv_.notify_all();
+			for (auto& th : workers_) { th.join(); }
+		}
+
+		ThreadPool& ThreadPool::instance()
+		{
+			static ThreadPool pool;
+#ifdef THREAD_POOL_ATFORK
+			static const int atfork = pthread_atfork(&ThreadPool::prepare_fork, &ThreadPool::parent_fork, &ThreadPool::child_fork);
+			(void)atfork;
+#endif
+			return pool;
+		}
+
+		void ThreadPool::prepare_fork()
+		{
+			//no thread holds two of these locks at a time - any order
+			ThreadPool& pool = instance();
+			for (auto& q : pool.queues_) { q->acquire(); }
+			pool.mtx_.lock();
+			pool.waitMtx_.lock();
+		}
+
+		void ThreadPool::parent_fork()
+		{
+			ThreadPool& pool = instance();
+			pool.waitMtx_.unlock();
+			pool.mtx_.unlock();
+			for (auto& q : pool.queues_) { q->release(); }
+		}
+
+		void ThreadPool::child_fork()
+		{
+			ThreadPool& pool = instance();
+			pool.waitMtx_.unlock();
+			pool.mtx_.unlock();
+
+			//tasks of the parent, and workers which do not exist in the child
+			for (auto& q : pool.queues_) {
+				q->q_.clear();
+				q->release();
+			}
+			for (auto& th : pool.workers_) { th.detach(); }
+			pool.workers_.clear();
+			pool.nPending_.store(0);
+			pool.nSleeping_.store(0);
+			pool.nWaiting_.store(0);
+
+			//the condition variables may record waiters of the parent - replaced, not destroyed
+			new (&pool.cv_) std::condition_variable();
+			new (&pool.waitCv_) std::condition_variable();
+		}
+
+		void ThreadPool::submit(task_t t)
+		{
+			int id = worker_id();
+			if (id < 0) {
+				id = static_cast<int>(next_.fetch_add(1, std::memory_order_relaxed) % queues_.size());
+			}
+
+			Queue& q = *queues_[id];
+			q.acquire();
+			q.q_.push_back(std::move(t));
+			q.release();
+
+			//a sleeping worker is woken up only if there is one (no system call otherwise)
+			nPending_.fetch_add(1);
+			if (nSleeping_.load() > 0) {
+				std::lock_guard<std::mutex> lck(mtx_);
+				cv_.notify_one();
+			}
+
+			//threads blocked in help_until may run the task
+			notify_waiters();
+		}
+
+		void ThreadPool::notify_waiters()
+		{
+			//pairs with the fence in help_until - either the waiter sees the new state or nWaiting_ is seen here
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			if (nWaiting_.load(std::memory_order_relaxed) > 0) {
+				std::lock_guard<std::mutex> lck(waitMtx_);
+				waitCv_.notify_all();
+			}
+		}
+
+		bool ThreadPool::pop(int id, task_t& t)
+		{
+			if (nPending_.load(std::memory_order_relaxed) == 0) { return false; }
+
+			//own deque - newest task
+			if (id >= 0) {
+				Queue& q = *queues_[id];
+				q.acquire();
+				if (!q.q_.empty()) {
+					t = std::move(q.q_.back());
+					q.q_.pop_back();
+					q.release();
+					nPending_.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+				q.release();
+			}
+
+			//steal - oldest task of another deque
+			const int nQ = static_cast<int>(queues_.size());
+			const int first = (id >= 0) ? id + 1 : static_cast<int>(next_.load(std::memory_order_relaxed) % nQ);
+			for (auto i = 0; i < nQ; ++i) {
+				const int v = (first + i) % nQ;
+				if (v == id) { continue; }
+				Queue& q = *queues_[v];
+				q.acquire();
+				if (!q.q_.empty()) {
+					t = std::move(q.q_.front());
+					q.q_.pop_front();
+					q.release();
+					nPending_.fetch_sub(1, std::memory_order_relaxed);
+					return true;
+				}
+				q.release();
+			}
+
+			return false;
+		}
+
+		bool ThreadPool::execute_one()
+		{
+			task_t t;
+			if (!pop(worker_id(), t)) { return false; }
+			t();
+			return true;
+		}
+
+		void ThreadPool::work(int id)
+		{
+			tlPool_ = this;
+			tlId_ = id;
+
+			task_t t;
+			int nIdle = 0;
+			while (true) {
+				if (pop(id, t)) {
+					t();
+					t = nullptr;
+					nIdle = 0;
+					continue;
+				}
+
+				//no work - spin for a while, then sleep until a task is submitted
+				if (++nIdle < SPIN_ROUNDS) {
+					if (stop_.load(std::memory_order_relaxed)) { break; }
+					continue;
+				}
+
+				std::unique_lock<std::mutex> lck(mtx_);
+				nSleeping_.fetch_add(1);
+				cv_.wait(lck, [this]() { return stop_.load() || nPending_.load() > 0; });
+				nSleeping_.fetch_sub(1);
+				if (stop_.load() && nPending_.load() == 0) { break; }
+				nIdle = 0;
+			}
+		}
+
+		void TaskGroup::wait()
+		{
+			join();
+
+			std::exception_ptr ex;
+			{
+				std::lock_guard<std::mutex> lck(mtx_);
+				std::swap(ex, ex_);
+			}
+			if (ex) { std::rethrow_exception(ex); }
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
@@ -0,0 +1,505 @@
+/**
+* @file thread_pool.h
+* @brief interface for class ThreadPool, a persistent work-stealing thread pool, with task groups
+*		 (TaskGroup), futures which do not spawn threads (TaskFuture) and parallel loops
+* @details: each worker owns a deque of tasks - it pushes and pops at the back (LIFO, cache-friendly for
+*			recursive splitting) and idle workers steal from the front of the other deques (FIFO, the largest
+*			pieces of work). Tasks submitted by threads outside the pool are spread round-robin over the deques.
+* @details: a thread that waits for a task group or a future executes pending tasks meanwhile, so tasks may
+*			wait for nested tasks without deadlock, and the waiting thread is one more worker. If there is
+*			nothing to run, it spins for a while and then blocks until a task is submitted or the group
+*			(future) is finished.
+* @details: idle workers spin for a short while before sleeping on a condition variable - a task pushed to a
+*			busy pool is dispatched without system calls.
+* @details: fork (POSIX) - the global pool is prepared with pthread_atfork. In the child it has no workers and
+*			no pending tasks, and the tasks submitted are run by the threads which wait for them.
+* @details: created 17/10/2026, last_update 17/10/2026
+* @dev pss
+**/
+
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <utility>
+#include <memory>
+#include <exception>
+#include <type_traits>
+#include <algorithm>
+
+namespace bitgraph {
+
+	namespace com {
+
+		class TaskGroup;
+
+		///////////////////
+		//
+		// ThreadPool class
+		//
+		// Persistent work-stealing thread pool
+		//
+		////////////////////
+
+		class ThreadPool {
+
+		public:
+			using task_t = std::function<void()>;
+
+			enum { SPIN_ROUNDS = 2048 };							//idle rounds of a worker before it sleeps
+
+			//////////////////////////////
+			//construction / destruction
+
+			/*
+			* @param nWorkers: number of worker threads (hardware threads if <= 0, at least 1)
+			*/
+			explicit ThreadPool(int nWorkers = 0);
+
+			//copy and move semantics disallowed
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool& operator =			(const ThreadPool&) = delete;
+			ThreadPool(ThreadPool&&) = delete;
+			ThreadPool& operator =			(ThreadPool&&) = delete;
+
+			/*
+			* @brief pending tasks are executed before the workers are joined
+			*/
+			~ThreadPool();
+
+			/*
+			* @brief global pool, with one worker for each hardware thread (created on first use)
+			* @details: safe to use in the child of a fork (see file header) - other pools are not
+			*/
+			static ThreadPool& instance();
+
+			////////////////
+			//setters and getters
+
+			int number_of_workers()							const { return static_cast<int>(workers_.size()); }
+
+			/*
+			* @brief index of the calling thread in this pool, -1 if it is not one of its workers
+			*/
+			int worker_id()									const { return (tlPool_ == this) ? tlId_ : -1; }
+
+			/*
+			* @brief number of tasks submitted and not yet started
+			*/
+			int number_of_pending()							const { return nPending_.load(std::memory_order_relaxed); }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief Enqueues task @t (in the deque of the calling worker, or round-robin if called from outside)
+			*/
+			void submit(task_t t);
+
+			/*
+			* @brief Runs one pending task in the calling thread (own deque first, then stealing)
+			* @returns true if a task was run
+			*/
+			bool execute_one();
+
+			/*
+			* @brief Runs pending tasks in the calling thread until @done() is true - if there are no pending
+			*		 tasks, the thread spins for a while and then blocks until a task is submitted or notify_waiters()
+			*		 is called
+			* @details: whoever makes @done() true must call notify_waiters() afterwards
+			*/
+			template<class Pred>
+			void help_until(Pred done);
+
+			/*
+			* @brief Wakes up the threads blocked in help_until (no system call if there are none)
+			*/
+			void notify_waiters();
+
+			/*
+			* @brief Calls @f(t) for t in [0, @n) as tasks of the pool - f(0) in the calling thread - and waits
+			*		 for all of them. Replacement for a group of threads running the same worker
+			*/
+			template<class Func>
+			void run(int n, Func f);
+
+			/*
+			* @brief Calls @f(first, last) for subranges of [@first, @last) of at most @grain elements (at least 1),
+			*		 split recursively so that idle workers steal the largest pieces. Waits for all of them
+			*/
+			template<class Func>
+			void parallel_for_range(int first, int last, int grain, Func f);
+
+			/*
+			* @brief Calls @f(i) for every i in [@first, @last), in tasks of @grain elements
+			*/
+			template<class Func>
+			void parallel_for(int first, int last, int grain, Func f);
+
+			/*
+			* @brief Calls @f(firstBlock, lastBlock) for tiles of @tile bitblocks of @bb - [0, bb.number_of_blocks())
+			*		 (for sparse bitsets, positions in the collection of non-empty blocks)
+			*/
+			template<class BitSet_t, class Func>
+			void parallel_for_blocks(const BitSet_t& bb, int tile, Func f) {
+				parallel_for_range(0, bb.number_of_blocks(), tile, f);
+			}
+
+			////////
+			//internals
+		private:
+
+			/*
+			* @brief deque of tasks of a worker, protected by a spin lock
+			*/
+			struct Queue {
+				std::atomic_flag lock_ = ATOMIC_FLAG_INIT;
+				std::deque<task_t> q_;
+
+				void acquire();
+				void release() { lock_.clear(std::memory_order_release); }
+			};
+
+			/*
+			* @brief main loop of worker @id
+			*/
+			void work(int id);
+
+			/*
+			* @brief pops a task - from the back of deque @id (if @id >= 0), then from the front of the others
+			* @returns true if a task was found
+			*/
+			bool pop(int id, task_t& t);
+
+			/*
+			* @brief pthread_atfork handlers of the global pool - locks are held across fork and the child
+			*		 drops the workers and the tasks of the parent
+			*/
+			static void prepare_fork();
+			static void parent_fork();
+			static void child_fork();
+
+			////////////////
+			// data members
+
+			std::vector<std::unique_ptr<Queue>> queues_;				//one deque per worker
+			std::vector<std::thread> workers_;
+
+			std::atomic<int> nPending_;									//tasks enqueued and not yet popped
+			std::atomic<int> nSleeping_;
+			std::atomic<unsigned> next_;								//round-robin deque of external submissions
+			std::atomic<bool> stop_;
+			std::mutex mtx_;
+			std::condition_variable cv_;
+			std::atomic<int> nWaiting_;									//threads blocked in help_until
+			std::mutex waitMtx_;
+			std::condition_variable waitCv_;
+
+			static thread_local ThreadPool* tlPool_;					//pool of the calling worker thread
+			static thread_local int tlId_;								//index of the calling worker thread
+		};
+
+		///////////////////
+		//
+		// TaskGroup class
+		//
+		// Set of tasks of a pool which are waited for together
+		//
+		////////////////////
+
+		class TaskGroup {
+		public:
+
+			//////////////////////////////
+			//construction / destruction
+
+			explicit TaskGroup(ThreadPool& pool = ThreadPool::instance()) :
+				pool_(pool), nPending_(0), canceled_(false)
+			{}
+
+			//copy and move semantics disallowed
+			TaskGroup(const TaskGroup&) = delete;
+			TaskGroup& operator =			(const TaskGroup&) = delete;
+			TaskGroup(TaskGroup&&) = delete;
+			TaskGroup& operator =			(TaskGroup&&) = delete;
+
+			/*
+			* @brief waits for the tasks of the group (exceptions are discarded)
+			*/
+			~TaskGroup() { join(); }
+
+			//////////////
+			// Main operations
+
+			/*
+			* @brief Enqueues @f() in the pool - it is skipped if the group is canceled before it starts
+			*/
+			template<class Func>
+			void run(Func f);
+
+			/*
+			* @brief Waits for all the tasks of the group, running pending tasks of the pool meanwhile.
+			*		 Rethrows the first exception thrown by a task, if any
+			*/
+			void wait();
+
+			/*
+			* @brief Tasks not yet started are skipped - running tasks may poll is_canceled() to stop early
+			*/
+			void cancel() { canceled_.store(true, std::memory_order_relaxed); }
+			bool is_canceled()								const { return canceled_.load(std::memory_order_relaxed); }
+
+			ThreadPool& pool() { return pool_; }
+
+			////////
+			//internals
+		private:
+
+			void join() { pool_.help_until([this]() { return nPending_.load(std::memory_order_acquire) == 0; }); }
+
+			////////////////
+			// data members
+
+			ThreadPool& pool_;
+			std::atomic<int> nPending_;									//tasks of the group not finished
+			std::atomic<bool> canceled_;
+			std::exception_ptr ex_;										//first exception thrown by a task
+			std::mutex mtx_;
+		};
+
+		///////////////////
+		//
+		// TaskFuture class
+		//
+		// Result of a task of a pool - waiting for it runs pending tasks instead of blocking
+		//
+		////////////////////
+
+		namespace _pool {
+
+			template<class T>
+			struct FutureState {
+				std::atomic<bool> ready_{ false };
+				std::exception_ptr ex_;
+				T value_{};
+
+				template<class Func>
+				void set(Func& f) { value_ = f(); }
+				T get() { return std::move(value_); }
+			};
+
+			template<>
+			struct FutureState<void> {
+				std::atomic<bool> ready_{ false };
+				std::exception_ptr ex_;
+
+				template<class Func>
+				void set(Func& f) { f(); }
+				void get() {}
+			};
+		}
+
+		template<class T>
+		class TaskFuture {
+		public:
+
+			TaskFuture() : pool_(nullptr) {}
+			TaskFuture(ThreadPool& pool, std::shared_ptr<_pool::FutureState<T>> st) : pool_(&pool), st_(std::move(st)) {}
+
+			bool valid()									const { return st_ != nullptr; }
+			bool is_ready()									const { return st_ && st_->ready_.load(std::memory_order_acquire); }
+
+			/*
+			* @brief waits for the result, running pending tasks of the pool meanwhile
+			*/
+			void wait()										const;
+
+			/*
+			* @brief waits for the result and returns it (only once) - rethrows the exception of the task, if any
+			*/
+			T get();
+
+		private:
+			ThreadPool* pool_;
+			std::shared_ptr<_pool::FutureState<T>> st_;
+		};
+
+		/*
+		* @brief return type of @f(args...) as run by async - also for pointers to member functions (args: object pointer, ...)
+		*/
+		template<class Func, class... Args>
+		using task_result_t = decltype(std::bind(std::declval<Func>(), std::declval<Args>()...)());
+
+		/*
+		* @brief Runs @f(args...) as a task of @pool
+		* @returns future with the result
+		*/
+		template<class Func, class... Args>
+		TaskFuture<task_result_t<Func, Args...>>
+			async(ThreadPool& pool, Func&& f, Args&&... args);
+
+		/*
+		* @brief Calls @f(t) for t in [0, @n) as tasks of the global pool (f(0) in the calling thread), and waits
+		*/
+		template<class Func>
+		inline
+			void run_parallel(int n, Func f) { ThreadPool::instance().run(n, f); }
+
+	}//end namespace com
+
+	using com::ThreadPool;
+	using com::TaskGroup;
+	using com::TaskFuture;
+
+}//end namespace bitgraph
+
+//////////////////////////////////////////////////////
+// IMPLEMENTATION - in header for generic code
+
+namespace bitgraph {
+
+	namespace com {
+
+		template<class Pred>
+		inline
+			void ThreadPool::help_until(Pred done)
+		{
+			int nIdle = 0;
+			while (!done()) {
+				if (execute_one()) {
+					nIdle = 0;
+				}
+				else if (++nIdle > SPIN_ROUNDS) {
+
+					//sleeps until there is a task to run or @done() (see notify_waiters)
+					std::unique_lock<std::mutex> lck(waitMtx_);
+					nWaiting_.fetch_add(1);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					waitCv_.wait(lck, [this, &done]() { return done() || nPending_.load() > 0; });
+					nWaiting_.fetch_sub(1);
+					nIdle = 0;
+				}
+			}
+		}
+
+		template<class Func>
+		inline
+			void ThreadPool::run(int n, Func f)
+		{
+			if (n <= 1) {
+				if (n == 1) { f(0); }
+				return;
+			}
+
+			TaskGroup tg(*this);
+			for (auto t = 1; t < n; ++t) {
+				tg.run([&f, t]() { f(t); });
+			}
+			f(0);
+			tg.wait();
+		}
+
+		template<class Func>
+		inline
+			void ThreadPool::parallel_for_range(int first, int last, int grain, Func f)
+		{
+			if (first >= last) { return; }
+			grain = std::max(grain, 1);
+
+			//splits [b, e) in halves - the upper halves are left for other workers
+			TaskGroup tg(*this);
+			std::function<void(int, int)> split = [&](int b, int e) {
+				while (e - b > grain) {
+					const int m = b + (e - b) / 2;
+					tg.run([&split, m, e]() { split(m, e); });
+					e = m;
+				}
+				if (!tg.is_canceled()) { f(b, e); }
+			};
+			split(first, last);
+			tg.wait();
+		}
+
+		template<class Func>
+		inline
+			void ThreadPool::parallel_for(int first, int last, int grain, Func f)
+		{
+			parallel_for_range(first, last, grain, [&f](int b, int e) {
+				for (auto i = b; i < e; ++i) { f(i); }
+			});
+		}
+
+		template<class Func>
+		inline
+			void TaskGroup::run(Func f)
+		{
+			nPending_.fetch_add(1, std::memory_order_relaxed);
+			ThreadPool* pool = &pool_;									//the group may be destroyed once nPending_ is 0
+			pool_.submit([this, pool, f]() mutable {
+				if (!is_canceled()) {
+					try {
+						f();
+					}
+					catch (...) {
+						std::lock_guard<std::mutex> lck(mtx_);
+						if (!ex_) { ex_ = std::current_exception(); }
+					}
+				}
+				if (nPending_.fetch_sub(1, std::memory_order_release) == 1) {
+					pool->notify_waiters();
+				}
+			});
+		}
+
+		template<class T>
+		inline
+			void TaskFuture<T>::wait() const
+		{
+			pool_->help_until([this]() { return st_->ready_.load(std::memory_order_acquire); });
+		}
+
+		template<class T>
+		inline
+			T TaskFuture<T>::get()
+		{
+			wait();
+			std::shared_ptr<_pool::FutureState<T>> st;
+			st.swap(st_);
+			if (st->ex_) { std::rethrow_exception(st->ex_); }
+			return st->get();
+		}
+
+		template<class Func, class... Args>
+		inline
+			TaskFuture<task_result_t<Func, Args...>>
+			async(ThreadPool& pool, Func&& f, Args&&... args)
+		{
+			using ret_t = task_result_t<Func, Args...>;
+
+			auto st = std::make_shared<_pool::FutureState<ret_t>>();
+			auto task = std::bind(std::forward<Func>(f), std::forward<Args>(args)...);
+			pool.submit([st, task, &pool]() mutable {
+				try {
+					st->set(task);
+				}
+				catch (...) {
+					st->ex_ = std::current_exception();
+				}
+				st->ready_.store(true, std::memory_order_release);
+				pool.notify_waiters();
+			});
+
+			return TaskFuture<ret_t>(pool, std::move(st));
+		}
+
+	}//end namespace com
+
+}//end namespace bitgraph
+
+#endif
@@ -0,0 +1,23 @@
+graph  [ hierarchic  1  directed  1 
+
+
+node  [ id 0 graphics  [ x 40 y 0 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 1 fontSize 7 ]  ]  
+node  [ id 1 graphics  [ x 32.3607 y -23.5114 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 2 fontSize 7 ]  ]  
+node  [ id 2 graphics  [ x 12.3607 y -38.0423 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 3 fontSize 7 ]  ]  
+node  [ id 3 graphics  [ x -12.3607 y -38.0423 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 4 fontSize 7 ]  ]  
+node  [ id 4 graphics  [ x -32.3607 y -23.5114 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 5 fontSize 7 ]  ]  
+node  [ id 5 graphics  [ x -40 y -4.89859e-15 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 6 fontSize 7 ]  ]  
+node  [ id 6 graphics  [ x -32.3607 y 23.5114 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 7 fontSize 7 ]  ]  
+node  [ id 7 graphics  [ x -12.3607 y 38.0423 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 8 fontSize 7 ]  ]  
+node  [ id 8 graphics  [ x 12.3607 y 38.0423 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 9 fontSize 7 ]  ]  
+node  [ id 9 graphics  [ x 32.3607 y 23.5114 w 11 h 11 type "roundrectangle" fill "#ffcc00"] LabelGraphics  [  text 10 fontSize 7 ]  ]  
+ edge   [  source  0 target 1 graphics  [   fill "#000000" ] ]
+ edge   [  source  1 target 3 graphics  [   fill "#000000" ] ]
+ edge   [  source  2 target 4 graphics  [   fill "#000000" ] ]
+ edge   [  source  2 target 5 graphics  [   fill "#000000" ] ]
+ edge   [  source  4 target 9 graphics  [   fill "#000000" ] ]
+ edge   [  source  5 target 8 graphics  [   fill "#000000" ] ]
+
+] 
+
+
@@ -0,0 +1,23 @@
+graph  [ hierarchic  1  directed  1 
+
+
+node  [ id 0 graphics  [ x 0 y 0 w 11 h 11 type "roundrectangle" fill "#FF0000"] LabelGraphics  [  text 1 fontSize 7 ]  ]  
+node  [ id 1 graphics  [ x 20 y 0 w 11 h 11 type "roundrectangle" fill "#FF0000"] LabelGraphics  [  text 2 fontSize 7 ]  ]  
+node  [ id 2 graphics  [ x 0 y 40 w 11 h 11 type "roundrectangle" fill "#FFFF00"] LabelGraphics  [  text 3 fontSize 7 ]  ]  
+node  [ id 3 graphics  [ x 20 y 40 w 11 h 11 type "roundrectangle" fill "#FFFF00"] LabelGraphics  [  text 4 fontSize 7 ]  ]  
+node  [ id 4 graphics  [ x 0 y 80 w 11 h 11 type "roundrectangle" fill "#008000"] LabelGraphics  [  text 5 fontSize 7 ]  ]  
+node  [ id 5 graphics  [ x 20 y 80 w 11 h 11 type "roundrectangle" fill "#008000"] LabelGraphics  [  text 6 fontSize 7 ]  ]  
+node  [ id 6 graphics  [ x 0 y 120 w 11 h 11 type "roundrectangle" fill "#00FFFF"] LabelGraphics  [  text 7 fontSize 7 ]  ]  
+node  [ id 7 graphics  [ x 20 y 120 w 11 h 11 type "roundrectangle" fill "#00FFFF"] LabelGraphics  [  text 8 fontSize 7 ]  ]  
+node  [ id 8 graphics  [ x 40 y 120 w 11 h 11 type "roundrectangle" fill "#00FFFF"] LabelGraphics  [  text 9 fontSize 7 ]  ]  
+node  [ id 9 graphics  [ x 60 y 120 w 11 h 11 type "roundrectangle" fill "#00FFFF"] LabelGraphics  [  text 10 fontSize 7 ]  ]  
+ edge   [  source  0 target 1 graphics  [   fill "#000000" ] ]
+ edge   [  source  1 target 3 graphics  [   fill "#000000" ] ]
+ edge   [  source  2 target 4 graphics  [   fill "#000000" ] ]
+ edge   [  source  2 target 5 graphics  [   fill "#000000" ] ]
+ edge   [  source  4 target 9 graphics  [   fill "#000000" ] ]
+ edge   [  source  5 target 8 graphics  [   fill "#000000" ] ]
+
+] 
+
+